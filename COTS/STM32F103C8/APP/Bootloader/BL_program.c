@@ -25,13 +25,13 @@
 
 //----------------------------< SYS -----------------------------/
 #include <stdarg.h>
-#include <stdio.h>
 #include <string.h>
 #include <stdint.h>
 
 //----------------------------< LIB -----------------------------/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "FMT.h"
 #include "crc.h"
 
 //----------------------------< MCAL -----------------------------/
@@ -97,10 +97,9 @@ BL_Status fetchHostCommand(void) {
  * @brief Send a formatted message to the host via UART.
  *
  * Formats a message string using the given format and arguments, then transmits
- * the message via UART. If an error occurs during formatting, a fallback message
- * is sent to indicate the error.
+ * the message via UART. Messages longer than the buffer are truncated.
  *
- * @param format The format string, similar to printf (e.g., %d, %s).
+ * @param format The format string, in the FMT printf subset (e.g., %d, %x, %s).
  * @param ... Additional arguments for the format string.
  */
 void sendMessageToHost(const char *format, ...) {
@@ -108,21 +107,10 @@ void sendMessageToHost(const char *format, ...) {
     va_list args;
 
     va_start(args, format);
-    int msg_len = vsnprintf(message, sizeof(message), format, args);
+    // FMT_VFormat always terminates and truncates to the buffer, so no error path is needed
+    uint16_t msg_len = FMT_VFormat(message, sizeof(message), format, args);
     va_end(args);
 
-    // Check for encoding error
-    if (msg_len < 0) {
-        // Send a fallback message to indicate an error
-        const char *error_message = "Error: Message encoding failed.";
-        HAL_UART_Transmit(&huart1, (uint8_t*)error_message, strlen(error_message), HAL_MAX_DELAY);
-        return;
-    } else if (msg_len >= sizeof(message)) {
-        // Handle truncation case
-        msg_len = sizeof(message) - 1;
-        message[msg_len] = '\0';
-    }
-
     // Transmit the formatted message
     HAL_UART_Transmit(&huart1, (uint8_t*)message, msg_len, HAL_MAX_DELAY);
 }
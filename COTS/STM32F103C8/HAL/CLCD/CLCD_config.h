@@ -3,4 +3,59 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.2                        *****************/
 /******* File Name : CLCD_config.h              *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef LCD_CONFIG_H
+#define LCD_CONFIG_H
+
+/**
+ * @brief Number of pending commands/characters the driver can buffer (must be a power of two).
+ *
+ * Writes are queued and sent one per software timer tick, so a full 2x16 screen plus cursor
+ * commands fits in the queue without the caller ever waiting.
+ */
+#define LCD_QUEUE_SIZE              64
+
+/**
+ * @brief Enable pulse width in microseconds.
+ *
+ * The HD44780 needs an enable pulse of at least 450 ns and data valid 360 ns after the rising edge
+ * of a read; the pulse is timed with the DWT cycle counter so it does not depend on the core clock.
+ */
+#define LCD_ENABLE_PULSE_US         1
+
+/**
+ * @brief Pace writes by polling the busy flag (LCD_BUSY_FLAG_ENABLED) or by fixed delays (LCD_BUSY_FLAG_DISABLED).
+ *
+ * With the busy flag, queued bytes are written back to back as soon as the LCD reports it is ready
+ * (about 40 us each) instead of one per software timer tick. It needs the RW pin wired and data pins
+ * that tolerate the LCD's 5 V output levels (FT pins) or a 3.3 V LCD.
+ */
+#define LCD_BUSY_FLAG_MODE          LCD_BUSY_FLAG_ENABLED
+
+/**
+ * @brief Longest busy-flag poll in microseconds before the driver falls back to fixed delays for good.
+ */
+#define LCD_BUSY_TIMEOUT_US         200
+
+/**
+ * @brief Maximum number of bytes written back to back in one software timer callback.
+ *
+ * Bounds the time spent in the timer interrupt to about LCD_BURST_LENGTH x 50 us.
+ */
+#define LCD_BURST_LENGTH            8
+
+/**
+ * @brief Frame buffer geometry: display rows (1 to 4) and columns (at most 40 / rows).
+ */
+#define LCD_ROWS                    2
+#define LCD_COLUMNS                 16
+
+/**
+ * @brief Period of the frame buffer flush in milliseconds.
+ *
+ * Every period the flush compares the frame buffer with the shadow copy of the display and
+ * queues writes for the changed cells only.
+ */
+#define LCD_FLUSH_PERIOD_MS         50
+
+#endif /**< LCD_CONFIG_H */
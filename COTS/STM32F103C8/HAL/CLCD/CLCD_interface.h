@@ -75,8 +75,13 @@ typedef struct {
  * necessary pins accordingly. It sends commands for setting up the display, clearing the screen,
  * and turning on the display.
  *
+ * The initialization sequence is queued and executed in the background by the software timer
+ * service, so this function returns immediately; characters and commands sent afterwards are
+ * queued behind it.
+ *
  * @param[in] config Pointer to the LCD configuration structure.
- * @note This function assumes that the required GPIO and STK (delay) modules have been initialized separately.
+ * @note This function assumes that the required GPIO module and the SWTMR service have been initialized separately.
+ * @note The configuration must stay valid (e.g. a global const) while requests are pending.
  * @warning Passing a NULL pointer as config will result in no action.
  */
 void HAL_LCD_Init(const LCD_Config_t *config);
@@ -84,14 +89,16 @@ void HAL_LCD_Init(const LCD_Config_t *config);
 /**
  * @brief Sends a command to the LCD module.
  *
- * This function sends a command to the LCD module based on the provided configuration.
- * It sets the RS pin to low for command mode and the RW pin to low for write operation.
- * Depending on the configured mode (4-bit or 8-bit), it calls the corresponding function
- * to send the command.
+ * This function queues a command for the LCD module based on the provided configuration.
+ * When it is written, the RS pin is set low for command mode and the RW pin low for write operation.
+ * Depending on the configured mode (4-bit or 8-bit), the corresponding function sends the command.
+ * The function returns without waiting; the command is executed within the next software timer ticks.
  *
  * @param[in] config Pointer to the LCD configuration structure.
  * @param[in] command The command to be sent to the LCD.
  * @note This function assumes that the required GPIO module has been initialized separately.
+ * @note When the request queue is full the caller waits for it to drain. Called from an interrupt
+ *       handler or with interrupts masked, it cannot wait and the request is dropped.
  * @warning If the mode in the configuration is neither 4-bit nor 8-bit, the function returns without action.
  */
 void HAL_LCD_SendCommand(const LCD_Config_t *config, uint8_t command);
@@ -99,14 +106,17 @@ void HAL_LCD_SendCommand(const LCD_Config_t *config, uint8_t command);
 /**
  * @brief Sends a character to the LCD module for display.
  *
- * This function sends a character to the LCD module based on the provided configuration.
- * It sets the RS pin to high for data mode and the RW pin to low for write operation.
- * Depending on the configured mode (4-bit or 8-bit), it calls the corresponding function
- * to send the character.
+ * This function queues a character for the LCD module based on the provided configuration.
+ * When it is written, the RS pin is set high for data mode and the RW pin low for write operation.
+ * Depending on the configured mode (4-bit or 8-bit), the corresponding function sends the character.
+ * The function returns without waiting; queued characters are written back to back as the busy flag
+ * allows, or one per software timer tick when the busy flag is not used (see LCD_BUSY_FLAG_MODE).
  *
  * @param[in] config Pointer to the LCD configuration structure.
  * @param[in] character The character to be sent to the LCD for display.
  * @note This function assumes that the required GPIO module has been initialized separately.
+ * @note When the request queue is full the caller waits for it to drain. Called from an interrupt
+ *       handler or with interrupts masked, it cannot wait and the request is dropped.
  * @warning If the mode in the configuration is neither 4-bit nor 8-bit, the function returns without action.
  */
 void HAL_LCD_SendChar(const LCD_Config_t *config, uint8_t character);
@@ -128,22 +138,38 @@ void HAL_LCD_SendString(const LCD_Config_t *config, const uint8_t *string);
  * @brief Displays a double-precision floating-point number on the LCD.
  *
  * This function displays a double-precision floating-point number on the LCD based on
- * the provided configuration. It separates the integer and fractional parts of the number,
- * displays the integer part directly, and then displays the fractional part with three decimal
- * places using LCD_SendChar function.
+ * the provided configuration, with three decimal places (truncated). The magnitude is
+ * split into a 32-bit unsigned integer part and thousandths and formatted with integer
+ * arithmetic; magnitudes of 4294967295 and above are shown as 4294967295.999.
  *
  * @param[in] config Pointer to the LCD configuration structure.
  * @param[in] number The double-precision floating-point number to be displayed on the LCD.
- * @note This function assumes that the required LCD character functions have been initialized separately.
+ *
+ * @deprecated The sign test, the split and the conversions are still software double-precision
+ *             operations on the Cortex-M3. Use HAL_LCD_SendFixedPoint, which needs no floating
+ *             point at all, or HAL_LCD_SendIntegerPart for whole numbers.
+ */
+void HAL_LCD_SendNumber(const LCD_Config_t *config, double number) __attribute__((deprecated));
+
+/**
+ * @brief Displays a signed fixed-point (Q format) number on the LCD.
+ *
+ * This function displays value / 2^fracBits with the given number of decimal places (truncated),
+ * using shifts and integer multiplies only.
+ *
+ * @param[in] config Pointer to the LCD configuration structure.
+ * @param[in] value The fixed-point value, e.g. a Q16.16 number.
+ * @param[in] fracBits The number of fraction bits (0 to FMT_FIXED_MAX_FRAC_BITS).
+ * @param[in] decimals The number of decimal places to display.
  */
-void HAL_LCD_SendNumber(const LCD_Config_t *config, double number);
+void HAL_LCD_SendFixedPoint(const LCD_Config_t *config, s32 value, u8 fracBits, u8 decimals);
 
 /**
  * @brief Displays the integer part of a signed integer on the LCD.
  *
  * This function displays the integer part of a signed integer value on the LCD based on
- * the provided configuration. It separates the digits of the integer part and displays
- * them sequentially using the LCD_SendChar function.
+ * the provided configuration. The digits are produced by FMT_S32ToDec without any
+ * division and displayed using HAL_LCD_SendString.
  *
  * @param[in] config Pointer to the LCD configuration structure.
  * @param[in] number The signed integer value whose integer part is to be displayed on the LCD.
@@ -176,4 +202,91 @@ void HAL_LCD_Clear(const LCD_Config_t *config);
  */
 void HAL_LCD_GoToXYPos(const LCD_Config_t *config, uint8_t x, uint8_t y);
 
+/**
+ * @brief Starts the frame buffer flush for an LCD.
+ *
+ * Clears the frame buffer and starts a periodic software timer that writes only the cells changed
+ * since the previous flush. Once started, the frame buffer owns the display: write it with
+ * HAL_LCD_FrameWrite and HAL_LCD_Printf instead of the direct character and cursor functions.
+ *
+ * @param[in] config Pointer to the LCD configuration structure, initialized with HAL_LCD_Init.
+ * @note The configuration must stay valid (e.g. a global const) while the flush runs.
+ */
+void HAL_LCD_FrameStart(const LCD_Config_t *config);
+
+/**
+ * @brief Fills the frame buffer with spaces.
+ *
+ * Only the cells that were not already blank are rewritten by the next flush, so this does not
+ * flicker like HAL_LCD_Clear.
+ */
+void HAL_LCD_FrameClear(void);
+
+/**
+ * @brief Writes a null-terminated string into the frame buffer.
+ *
+ * Characters beyond the last column are dropped; the rest of the row is left unchanged.
+ *
+ * @param[in] row The row (0 to LCD_ROWS - 1).
+ * @param[in] column The first column (0 to LCD_COLUMNS - 1).
+ * @param[in] string Pointer to the null-terminated string.
+ */
+void HAL_LCD_FrameWrite(uint8_t row, uint8_t column, const uint8_t *string);
+
+/**
+ * @brief Formats a string into the frame buffer.
+ *
+ * Formats with the FMT printf subset (see FMT_Format, including %q for Q16.16 values) and writes
+ * the result as HAL_LCD_FrameWrite does, so the output is clipped to the end of the row.
+ *
+ * @param[in] row The row (0 to LCD_ROWS - 1).
+ * @param[in] column The first column (0 to LCD_COLUMNS - 1).
+ * @param[in] format The printf-style format string.
+ */
+void HAL_LCD_Printf(uint8_t row, uint8_t column, const char *format, ...);
+
+/**
+ * @brief Glyph IDs from LCD_GLYPH_ID_RESERVED up are used by the driver (bar graph cells).
+ */
+#define LCD_GLYPH_ID_RESERVED   0xFFF0
+
+/**
+ * @brief Gets the character code of a custom glyph, uploading it to CGRAM on a cache miss.
+ *
+ * The 8 CGRAM slots are managed as a least-recently-used cache keyed by glyph ID. On a hit only
+ * the slot's age is refreshed; on a miss the least recently used slot is reassigned and the
+ * bitmap is uploaded by the next frame buffer flush, ahead of the cell writes. Write the returned
+ * code into the frame buffer (HAL_LCD_FrameWrite) to show the glyph.
+ *
+ * @param[in] glyphId Application-chosen glyph ID (below LCD_GLYPH_ID_RESERVED).
+ * @param[in] bitmap The 8 rows of the 5x8 glyph, bit 4 is the leftmost pixel.
+ * @return The character code (8 to 15) showing the glyph.
+ * @note A slot is reused when a ninth distinct glyph is requested, and every cell still showing
+ *       the evicted glyph changes with it, so keep at most 8 distinct glyphs on screen.
+ */
+uint8_t HAL_LCD_GlyphAcquire(uint16_t glyphId, const uint8_t bitmap[8]);
+
+/**
+ * @brief Draws a horizontal bar graph into the frame buffer.
+ *
+ * The bar spans width cells of 5 pixel columns each and is filled in proportion to value / max
+ * with single-column resolution. Full cells use the ROM block character and the one partly
+ * filled cell a cached CGRAM glyph, so each bar occupies at most one CGRAM slot and a live
+ * gauge only uploads a glyph when the partial fill changes to one not in the cache.
+ *
+ * @param[in] row The row (0 to LCD_ROWS - 1).
+ * @param[in] column The first column of the bar.
+ * @param[in] width The bar width in cells (clipped to the end of the row).
+ * @param[in] value The value to display (clamped to max).
+ * @param[in] max The full-scale value (must not be 0).
+ */
+void HAL_LCD_DrawBar(uint8_t row, uint8_t column, uint8_t width, uint32_t value, uint32_t max);
+
+/**
+ * @brief Checks whether queued LCD requests are still being written.
+ *
+ * @return 1 while commands or characters are pending, 0 once everything has been written to the LCD.
+ */
+u8 HAL_LCD_IsBusy(void);
+
 #endif /* LCD_DRIVER_H */
@@ -31,7 +31,145 @@
 #define _LCD_DDRAM_START                0x80  // Start address for Display Data RAM (DDRAM) in the LCD.
 /*****************************< End of Commands for initializing LCD. *****************************/
 
+/*****************************< Request queue *****************************/
+#if (LCD_QUEUE_SIZE & (LCD_QUEUE_SIZE - 1)) != 0
+#error "LCD_QUEUE_SIZE must be a power of two"
+#endif
+
+#define LCD_QUEUE_MASK          (LCD_QUEUE_SIZE - 1)
+
+#define LCD_REQUEST_COMMAND     0   /**< The request is written with RS = 0 */
+#define LCD_REQUEST_DATA        1   /**< The request is written with RS = 1 */
+
+/**< Request delay meaning "poll the busy flag", or wait one tick when the busy flag is not used */
+#define LCD_DELAY_POLL          0
+
+/*****************************< Busy flag *****************************/
+#define LCD_BUSY_FLAG_DISABLED  0
+#define LCD_BUSY_FLAG_ENABLED   1
+
+#if (LCD_BUSY_FLAG_MODE != LCD_BUSY_FLAG_DISABLED) && (LCD_BUSY_FLAG_MODE != LCD_BUSY_FLAG_ENABLED)
+#error "LCD_BUSY_FLAG_MODE must be LCD_BUSY_FLAG_ENABLED or LCD_BUSY_FLAG_DISABLED"
+#endif
+
+#if LCD_BURST_LENGTH < 1
+#error "LCD_BURST_LENGTH must be at least 1"
+#endif
+
+/**< Busy poll timeout in DWT cycles */
+#define LCD_BUSY_TIMEOUT_CYCLES MCAL_DWT_UsToCycles(LCD_BUSY_TIMEOUT_US)
+
+/**
+ * @brief One pending write to the LCD.
+ */
+typedef struct {
+    const LCD_Config_t *Config; /**< LCD the byte is written to */
+    uint8_t Value;              /**< Command or character code */
+    uint8_t Type;               /**< LCD_REQUEST_COMMAND or LCD_REQUEST_DATA */
+    uint16_t DelayTicks;        /**< Software timer ticks the LCD needs to execute the request, or LCD_DELAY_POLL */
+} LCD_Request_t;
+
+/*****************************< Frame buffer *****************************/
+#if (LCD_ROWS < 1) || (LCD_ROWS > 4) || (LCD_COLUMNS < 1) || ((LCD_ROWS * LCD_COLUMNS) > 80)
+#error "LCD_ROWS must be 1 to 4 and LCD_ROWS x LCD_COLUMNS at most 80"
+#endif
+
+/**< Requests one changed cell may need: a DDRAM address command and the character */
+#define LCD_CELL_REQUESTS       2
+
+/**< Cursor position unknown: the next changed cell always sets the address */
+#define LCD_CURSOR_UNKNOWN      0xFF
+
+/*****************************< CGRAM glyph cache *****************************/
+#define LCD_GLYPH_SLOTS         8       /**< CGRAM holds eight 5x8 glyphs */
+#define LCD_GLYPH_ROWS          8       /**< Bytes per glyph */
+#define LCD_GLYPH_CODE_BASE     0x08    /**< Codes 8..15 alias CGRAM 0..7 and, unlike 0, fit in C strings */
+#define LCD_GLYPH_ID_EMPTY      0xFFFF  /**< Slot holds no glyph */
+#define LCD_GLYPH_ID_BAR(N)     (LCD_GLYPH_ID_RESERVED + (N))   /**< Bar cell with N of 5 columns filled */
+#define LCD_CHAR_FULL_BLOCK     0xFF    /**< ROM character with every pixel on */
+
+/**< Requests one glyph upload takes: the CGRAM address command and the rows */
+#define LCD_GLYPH_REQUESTS      (1 + LCD_GLYPH_ROWS)
+
 /*****************************< Private function prototypes *****************************/ 
+/**
+ * @brief Empties the request queue and stops its timer.
+ */
+static void HAL_LCD_ResetQueue(void);
+
+/**
+ * @brief Appends a write request to the queue and wakes the queue timer if it is idle.
+ *
+ * @param[in] config Pointer to the LCD configuration structure (must stay valid until the request is written).
+ * @param[in] value The command or character code.
+ * @param[in] type LCD_REQUEST_COMMAND or LCD_REQUEST_DATA.
+ * @param[in] delayTicks Software timer ticks to wait after writing before the next request.
+ * @note When the queue is full this function waits for a free slot, so it must not be called with interrupts disabled.
+ */
+static void HAL_LCD_Enqueue(const LCD_Config_t *config, uint8_t value, uint8_t type, uint16_t delayTicks);
+
+/**
+ * @brief Queues the uploads of the CGRAM slots that were reassigned since the last flush.
+ *
+ * @return 1 if every pending slot was queued, 0 if the queue ran out of room.
+ */
+static uint8_t HAL_LCD_UploadGlyphs(void);
+
+/**
+ * @brief Software timer callback that queues writes for the frame buffer cells that differ from the shadow copy.
+ *
+ * Consecutive changed cells share one DDRAM address command. The flush stops when the queue cannot
+ * take another cell and resumes on the next period, so it never waits for queue space.
+ *
+ * @param[in] context Unused.
+ */
+static void HAL_LCD_FlushFrame(void *context);
+
+/**
+ * @brief Software timer callback that writes the pending requests.
+ *
+ * Writes up to LCD_BURST_LENGTH requests, polling the busy flag between them, and stops at the first
+ * request that needs a timed delay.
+ *
+ * @param[in] context Unused.
+ */
+static void HAL_LCD_ProcessQueue(void *context);
+
+/**
+ * @brief Writes one command or data byte to the LCD.
+ *
+ * @param[in] config Pointer to the LCD configuration structure.
+ * @param[in] value The byte to write.
+ * @param[in] type LCD_REQUEST_COMMAND or LCD_REQUEST_DATA.
+ */
+static void HAL_LCD_Write(const LCD_Config_t *config, uint8_t value, uint8_t type);
+
+/**
+ * @brief Polls the busy flag until the LCD is ready for the next byte.
+ *
+ * Switches the data pins to input, reads the busy flag with RW = 1 (two reads per poll in 4-bit mode)
+ * and restores the data pins to output.
+ *
+ * @param[in] config Pointer to the LCD configuration structure.
+ * @return 1 once the busy flag is clear, 0 if it stayed set for LCD_BUSY_TIMEOUT_US.
+ */
+static uint8_t HAL_LCD_WaitReady(const LCD_Config_t *config);
+
+/**
+ * @brief Sets the mode of the data pins used by the configured bus width.
+ *
+ * @param[in] config Pointer to the LCD configuration structure.
+ * @param[in] mode GPIO pin mode.
+ */
+static void HAL_LCD_SetDataPinsMode(const LCD_Config_t *config, uint8_t mode);
+
+/**
+ * @brief Generates one enable pulse so the LCD latches the data lines.
+ *
+ * @param[in] config Pointer to the LCD configuration structure.
+ */
+static void HAL_LCD_PulseEnable(const LCD_Config_t *config);
+
 /**
  * @brief Sends 4-bit data to the LCD.
  *
@@ -58,5 +196,4 @@ static void HAL_LCD_Send4Bits(const LCD_Config_t *config, uint8_t value);
  */
 static void HAL_LCD_Send8Bits(const LCD_Config_t *config, uint8_t value);
 
-
 #endif /**< LCD_PRIVATE_H */
\ No newline at end of file
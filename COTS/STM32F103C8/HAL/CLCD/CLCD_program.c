@@ -5,16 +5,80 @@
 /******* File Name : CLCD_program.c             *****************/
 /****************************************************************/
 
+/*****************************< SYS *****************************/
+#include <stdarg.h>
 /*****************************< LIB *****************************/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "FMT.h"
 /*****************************< MCAL *****************************/
 #include "GPIO_interface.h"
-#include "STK_interface.h"
+#include "SCB_interface.h"
+#include "DWT_interface.h"
+/*****************************< SERVICES *****************************/
+#include "SWTMR_interface.h"
 /*****************************< HAL *****************************/
 #include "CLCD_interface.h"
-#include "CLCD_private.h"
 #include "CLCD_config.h"
+#include "CLCD_private.h"
+/*****************************< Global Variable Section *****************************/
+/**
+ * @brief Pending writes, drained by HAL_LCD_ProcessQueue on each software timer expiry.
+ *
+ * Head and tail are free-running counters; the slot index is the counter masked with LCD_QUEUE_MASK.
+ */
+static LCD_Request_t LCD_Queue[LCD_QUEUE_SIZE];
+static volatile uint16_t LCD_QueueHead = 0;
+static volatile uint16_t LCD_QueueTail = 0;
+
+/**
+ * @brief Set while the queue timer is running (a write is in progress or requests are pending).
+ */
+static volatile uint8_t LCD_QueueBusy = 0;
+
+/**
+ * @brief Software timer that paces the writes.
+ */
+static SWTMR_Timer_t LCD_QueueTimer;
+
+/**
+ * @brief Cleared when a busy-flag poll times out; the driver then keeps to fixed delays.
+ */
+static uint8_t LCD_BusyFlagUsable = LCD_BUSY_FLAG_MODE;
+
+/**< DDRAM address of the first column of each row */
+static const uint8_t LCD_RowAddress[4] = {0x00, 0x40, 0x14, 0x54};
+
+/**
+ * @brief Frame buffer written by the application, and the shadow copy of what the display shows.
+ */
+static uint8_t LCD_Frame[LCD_ROWS][LCD_COLUMNS];
+static uint8_t LCD_Shadow[LCD_ROWS][LCD_COLUMNS];
+
+/**
+ * @brief Set by the frame writers, cleared by the flush once every change has been queued.
+ */
+static volatile uint8_t LCD_FrameDirty = 0;
+
+/**
+ * @brief LCD the frame buffer is flushed to, and the timer that runs the flush.
+ */
+static const LCD_Config_t *LCD_FrameConfig = NULL;
+static SWTMR_Timer_t LCD_FlushTimer;
+
+/**
+ * @brief Glyph held by each CGRAM slot, its bitmap, and the age stamp of its last use.
+ */
+static uint16_t LCD_GlyphId[LCD_GLYPH_SLOTS] = {LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY,
+                                                LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY, LCD_GLYPH_ID_EMPTY};
+static uint8_t LCD_GlyphBitmap[LCD_GLYPH_SLOTS][LCD_GLYPH_ROWS];
+static uint16_t LCD_GlyphStamp[LCD_GLYPH_SLOTS];
+static uint16_t LCD_GlyphClock = 0;
+
+/**
+ * @brief Bit n set while slot n waits to be uploaded by the flush.
+ */
+static volatile uint8_t LCD_GlyphPending = 0;
 /*****************************< Function Implementations *****************************/
 void HAL_LCD_Init(const LCD_Config_t *config) 
 {
@@ -23,6 +87,9 @@ void HAL_LCD_Init(const LCD_Config_t *config)
         return;
     }
 
+    /**< The enable pulse and the busy-flag timeout are timed with the cycle counter */
+    MCAL_DWT_Init();
+
     /**< Init the Mode of the en, rs, rw */
     MCAL_GPIO_SetPinMode(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_OUTPUT_PUSH_PULL_10MHZ);
     MCAL_GPIO_SetPinMode(config->rsPin.LCD_PortId, config->rsPin.LCD_PinId, GPIO_OUTPUT_PUSH_PULL_10MHZ);
@@ -48,11 +115,15 @@ void HAL_LCD_Init(const LCD_Config_t *config)
         return;
     }
     
-    MCAL_STK_SetDelay_ms(20);
-    HAL_LCD_SendCommand(config, _LCD_8BIT_MODE_2_LINE);
-    MCAL_STK_SetDelay_ms(5);
-    HAL_LCD_SendCommand(config, _LCD_8BIT_MODE_2_LINE);
-    MCAL_STK_SetBusyWait(150);
+    /**< Reset the request queue; everything below is only queued and paced by the software timer */
+    HAL_LCD_ResetQueue();
+
+    /**< Wait more than 15 ms after power on before the first command */
+    LCD_QueueBusy = 1;
+    SWTMR_StartOneShot(&LCD_QueueTimer, SWTMR_MsToTicks(20));
+
+    HAL_LCD_Enqueue(config, _LCD_8BIT_MODE_2_LINE, LCD_REQUEST_COMMAND, SWTMR_MsToTicks(5));
+    HAL_LCD_Enqueue(config, _LCD_8BIT_MODE_2_LINE, LCD_REQUEST_COMMAND, 1);
     HAL_LCD_SendCommand(config, _LCD_8BIT_MODE_2_LINE);
 
     HAL_LCD_SendCommand(config, _LCD_CLEAR);
@@ -68,44 +139,20 @@ void HAL_LCD_Init(const LCD_Config_t *config)
 
 void HAL_LCD_SendCommand(const LCD_Config_t *config, uint8_t command) 
 {
-    /**< Set RS pin to low for command --> RS = 0 */
-    MCAL_GPIO_SetPinValue(config->rsPin.LCD_PortId, config->rsPin.LCD_PinId, GPIO_LOW);
-    /**< Set RW pin to low for write  --> RW = 0 */
-    MCAL_GPIO_SetPinValue(config->rwPin.LCD_PortId, config->rwPin.LCD_PinId, GPIO_LOW);
-
-    if(config->mode == LCD_4BitMode)
-    {
-        HAL_LCD_Send4Bits(config, command);
-    }
-    else if(config->mode == LCD_8BitMode)
+    /**< Clear and return home take 1.52 ms and are left to the timer, every other command completes within 40 us */
+    if((command == _LCD_CLEAR) || (command == _LCD_RETURN_HOME))
     {
-        HAL_LCD_Send8Bits(config, command);
+        HAL_LCD_Enqueue(config, command, LCD_REQUEST_COMMAND, SWTMR_MsToTicks(2));
     }
     else
     {
-        return;
+        HAL_LCD_Enqueue(config, command, LCD_REQUEST_COMMAND, LCD_DELAY_POLL);
     }
 }
 
 void HAL_LCD_SendChar(const LCD_Config_t *config, uint8_t character) 
 {
-    /**< Set RS pin to low for data --> RS = 1 */
-    MCAL_GPIO_SetPinValue(config->rsPin.LCD_PortId, config->rsPin.LCD_PinId, GPIO_HIGH);
-    /**< Set RW pin to low for write  --> RW = 0 */
-    MCAL_GPIO_SetPinValue(config->rwPin.LCD_PortId, config->rwPin.LCD_PinId, GPIO_LOW);
-
-    if(config->mode == LCD_4BitMode)
-    {
-        HAL_LCD_Send4Bits(config, character);
-    }
-    else if(config->mode == LCD_8BitMode)
-    {
-        HAL_LCD_Send8Bits(config, character);
-    }
-    else
-    {
-        return;
-    }
+    HAL_LCD_Enqueue(config, character, LCD_REQUEST_DATA, LCD_DELAY_POLL);
 }
 
 void HAL_LCD_SendString(const LCD_Config_t *config, const uint8_t *string) 
@@ -120,49 +167,50 @@ void HAL_LCD_SendString(const LCD_Config_t *config, const uint8_t *string)
 }
 
 void HAL_LCD_SendIntegerPart(const LCD_Config_t *config, s32 number) {
-    u8 Local_Integer[11] = {0};
-    s8 Local_Counter = 0;
+    u8 Local_Text[FMT_DEC_BUFFER_SIZE];
 
-    /**< Handle negative numbers */ 
-    if (number < 0) {
-        HAL_LCD_SendChar(config, '-');
-        number *= -1;
-    }
-
-    /**< Extract digits of the integer part */ 
-    do {
-        Local_Integer[Local_Counter] = number % 10;
-        number /= 10;
-        Local_Counter++;
-    } while (number != 0);
+    FMT_S32ToDec((char *)Local_Text, number);
+    HAL_LCD_SendString(config, Local_Text);
+}
 
-    Local_Counter--;
+void HAL_LCD_SendNumber(const LCD_Config_t *config, double number) {
+    u8 Local_Text[FMT_DEC_BUFFER_SIZE + 4];
+    const char *Local_pSign = "";
+    u32 Local_Whole;
+    u32 Local_Thousandths;
 
-    /**< Display each digit */ 
-    for (; Local_Counter >= 0; Local_Counter--) {
-        HAL_LCD_SendChar(config, Local_Integer[Local_Counter] + '0');
+    if (number < 0.0)
+    {
+        Local_pSign = "-";
+        number = -number;
     }
-}
 
-void HAL_LCD_SendNumber(const LCD_Config_t *config, double number) {
-    /**< Display integer part */ 
-    u32 integerPart = (u32)number;
+    /**< The magnitude is split in unsigned integer and thousandths parts; the digits are then integer work */
+    if (number >= 4294967295.0)
+    {
+        Local_Whole = 0xFFFFFFFFUL;     /**< Saturate rather than convert out of range */
+        Local_Thousandths = 999U;
+    }
+    else
+    {
+        Local_Whole = (u32)number;
+        Local_Thousandths = (u32)((number - (double)Local_Whole) * 1000.0);
+    }
 
-    HAL_LCD_SendIntegerPart(config, (s32)integerPart); // Function to handle integer part
+    if ((Local_Whole == 0U) && (Local_Thousandths == 0U))
+    {
+        Local_pSign = "";
+    }
 
-    /**< Display decimal point */ 
-    HAL_LCD_SendChar(config, '.');
+    FMT_Format((char *)Local_Text, sizeof(Local_Text), "%s%u.%03u", Local_pSign, Local_Whole, Local_Thousandths);
+    HAL_LCD_SendString(config, Local_Text);
+}
 
-    /**< Display fractional part with 3 decimal points */ 
-    double fractionalPart = number - integerPart;
-    u8 decimalPlaces = 3;
+void HAL_LCD_SendFixedPoint(const LCD_Config_t *config, s32 value, u8 fracBits, u8 decimals) {
+    u8 Local_Text[FMT_DEC_BUFFER_SIZE + LCD_COLUMNS + 1];
 
-    for (u8 i = 0; i < decimalPlaces; ++i) {
-        fractionalPart *= 10;
-        u8 digit = (u8)fractionalPart;
-        HAL_LCD_SendChar(config, digit + '0');
-        fractionalPart -= digit;
-    }
+    FMT_FixedToDec((char *)Local_Text, value, fracBits, (decimals < LCD_COLUMNS) ? decimals : LCD_COLUMNS);
+    HAL_LCD_SendString(config, Local_Text);
 }
 
 void HAL_LCD_Clear(const LCD_Config_t *config) 
@@ -196,6 +244,442 @@ void HAL_LCD_GoToXYPos(const LCD_Config_t *config, uint8_t x, uint8_t y) {
     }
 }
 
+void HAL_LCD_FrameStart(const LCD_Config_t *config)
+{
+    if(config == NULL)
+    {
+        return;
+    }
+
+    SWTMR_Stop(&LCD_FlushTimer);
+
+    /**< HAL_LCD_Init clears the display, so it starts out matching a blank frame */
+    for(uint8_t Local_Row = 0; Local_Row < LCD_ROWS; Local_Row++)
+    {
+        for(uint8_t Local_Column = 0; Local_Column < LCD_COLUMNS; Local_Column++)
+        {
+            LCD_Frame[Local_Row][Local_Column] = ' ';
+            LCD_Shadow[Local_Row][Local_Column] = ' ';
+        }
+    }
+
+    /**< CGRAM content is unknown after power up: start with an empty glyph cache */
+    for(uint8_t Local_Slot = 0; Local_Slot < LCD_GLYPH_SLOTS; Local_Slot++)
+    {
+        LCD_GlyphId[Local_Slot] = LCD_GLYPH_ID_EMPTY;
+    }
+    LCD_GlyphPending = 0;
+
+    LCD_FrameConfig = config;
+    LCD_FrameDirty = 0;
+
+    SWTMR_Create(&LCD_FlushTimer, HAL_LCD_FlushFrame, NULL);
+    SWTMR_StartPeriodic(&LCD_FlushTimer, SWTMR_MsToTicks(LCD_FLUSH_PERIOD_MS));
+}
+
+void HAL_LCD_FrameClear(void)
+{
+    for(uint8_t Local_Row = 0; Local_Row < LCD_ROWS; Local_Row++)
+    {
+        for(uint8_t Local_Column = 0; Local_Column < LCD_COLUMNS; Local_Column++)
+        {
+            LCD_Frame[Local_Row][Local_Column] = ' ';
+        }
+    }
+
+    LCD_FrameDirty = 1;
+}
+
+void HAL_LCD_FrameWrite(uint8_t row, uint8_t column, const uint8_t *string)
+{
+    if((string == NULL) || (row >= LCD_ROWS))
+    {
+        return;
+    }
+
+    while((column < LCD_COLUMNS) && (*string != '\0'))
+    {
+        LCD_Frame[row][column] = *string;
+        column++;
+        string++;
+    }
+
+    LCD_FrameDirty = 1;
+}
+
+void HAL_LCD_Printf(uint8_t row, uint8_t column, const char *format, ...)
+{
+    uint8_t Local_Text[LCD_COLUMNS + 1];
+    va_list Local_Args;
+
+    va_start(Local_Args, format);
+    FMT_VFormat((char *)Local_Text, sizeof(Local_Text), format, Local_Args);
+    va_end(Local_Args);
+
+    HAL_LCD_FrameWrite(row, column, Local_Text);
+}
+
+uint8_t HAL_LCD_GlyphAcquire(uint16_t glyphId, const uint8_t bitmap[8])
+{
+    uint8_t Local_Slot = 0;
+    u32 Local_PrimaskState;
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    LCD_GlyphClock++;
+
+    /**< Hit: the glyph is already in CGRAM */
+    for(uint8_t i = 0; i < LCD_GLYPH_SLOTS; i++)
+    {
+        if(LCD_GlyphId[i] == glyphId)
+        {
+            LCD_GlyphStamp[i] = LCD_GlyphClock;
+            SCB_ExitCriticalSection(Local_PrimaskState);
+            return LCD_GLYPH_CODE_BASE + i;
+        }
+    }
+
+    /**< Miss: take an empty slot, or the one unused for the longest time (ages compare modulo 2^16) */
+    for(uint8_t i = 1; i < LCD_GLYPH_SLOTS; i++)
+    {
+        if(LCD_GlyphId[Local_Slot] == LCD_GLYPH_ID_EMPTY)
+        {
+            break;
+        }
+        if((LCD_GlyphId[i] == LCD_GLYPH_ID_EMPTY) ||
+           ((uint16_t)(LCD_GlyphClock - LCD_GlyphStamp[i]) > (uint16_t)(LCD_GlyphClock - LCD_GlyphStamp[Local_Slot])))
+        {
+            Local_Slot = i;
+        }
+    }
+
+    LCD_GlyphId[Local_Slot] = glyphId;
+    LCD_GlyphStamp[Local_Slot] = LCD_GlyphClock;
+    for(uint8_t i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        LCD_GlyphBitmap[Local_Slot][i] = (bitmap != NULL) ? (bitmap[i] & 0x1F) : 0;
+    }
+    SET_BIT(LCD_GlyphPending, Local_Slot);
+    LCD_FrameDirty = 1;
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    return LCD_GLYPH_CODE_BASE + Local_Slot;
+}
+
+void HAL_LCD_DrawBar(uint8_t row, uint8_t column, uint8_t width, uint32_t value, uint32_t max)
+{
+    uint8_t Local_Cells[LCD_COLUMNS + 1];
+    uint8_t Local_Bitmap[LCD_GLYPH_ROWS];
+    uint32_t Local_Columns;
+    uint8_t Local_Partial;
+    uint8_t i;
+
+    if((row >= LCD_ROWS) || (column >= LCD_COLUMNS) || (width == 0) || (max == 0))
+    {
+        return;
+    }
+
+    if(width > (LCD_COLUMNS - column))
+    {
+        width = LCD_COLUMNS - column;
+    }
+    if(value > max)
+    {
+        value = max;
+    }
+
+    /**< Filled pixel columns; 64-bit so value x width x 5 cannot overflow */
+    Local_Columns = (uint32_t)(((u64)value * width * 5U) / max);
+    Local_Partial = (uint8_t)(Local_Columns % 5U);
+
+    for(i = 0; i < width; i++)
+    {
+        Local_Cells[i] = (i < (Local_Columns / 5U)) ? LCD_CHAR_FULL_BLOCK : ' ';
+    }
+
+    /**< The one partly filled cell: its left Local_Partial columns are lit */
+    if(Local_Partial != 0)
+    {
+        for(i = 0; i < LCD_GLYPH_ROWS; i++)
+        {
+            Local_Bitmap[i] = (uint8_t)(0x1F << (5 - Local_Partial)) & 0x1F;
+        }
+        Local_Cells[Local_Columns / 5U] = HAL_LCD_GlyphAcquire(LCD_GLYPH_ID_BAR(Local_Partial), Local_Bitmap);
+    }
+
+    Local_Cells[width] = '\0';
+    HAL_LCD_FrameWrite(row, column, Local_Cells);
+}
+
+u8 HAL_LCD_IsBusy(void)
+{
+    return LCD_QueueBusy;
+}
+
+/*****************************< Private helper functions for the request queue *****************************/ 
+static void HAL_LCD_ResetQueue(void)
+{
+    u32 Local_PrimaskState = SCB_EnterCriticalSection();
+
+    SWTMR_Stop(&LCD_QueueTimer);
+    SWTMR_Create(&LCD_QueueTimer, HAL_LCD_ProcessQueue, NULL);
+    LCD_QueueHead = 0;
+    LCD_QueueTail = 0;
+    LCD_QueueBusy = 0;
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+}
+
+static void HAL_LCD_Enqueue(const LCD_Config_t *config, uint8_t value, uint8_t type, uint16_t delayTicks)
+{
+    u32 Local_PrimaskState;
+    uint8_t Local_Queued = 0;
+
+    if(config == NULL)
+    {
+        return;
+    }
+
+    /**< The free-space check and the insertion share one critical section, so the flush cannot fill
+         the queue in between; interrupts are let in between tries so the timer can drain it */
+    while(Local_Queued == 0)
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        if((u16)(LCD_QueueHead - LCD_QueueTail) < LCD_QUEUE_SIZE)
+        {
+            LCD_Queue[LCD_QueueHead & LCD_QUEUE_MASK].Config = config;
+            LCD_Queue[LCD_QueueHead & LCD_QUEUE_MASK].Value = value;
+            LCD_Queue[LCD_QueueHead & LCD_QUEUE_MASK].Type = type;
+            LCD_Queue[LCD_QueueHead & LCD_QUEUE_MASK].DelayTicks = delayTicks;
+            LCD_QueueHead++;
+            Local_Queued = 1;
+
+            /**< Wake the queue up on the next tick if it was idle */
+            if(LCD_QueueBusy == 0)
+            {
+                LCD_QueueBusy = 1;
+                SWTMR_StartOneShot(&LCD_QueueTimer, 1);
+            }
+        }
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+
+        /**< The queue only drains from the timer interrupt: an interrupt handler, or a caller with
+             interrupts masked, would wait forever, so the request is dropped instead */
+        if((Local_Queued == 0) && ((Local_PrimaskState != 0) || SCB_IsHandlerMode()))
+        {
+            break;
+        }
+    }
+}
+
+static void HAL_LCD_FlushFrame(void *context)
+{
+    uint8_t Local_Cursor = LCD_CURSOR_UNKNOWN;
+    uint8_t Local_Address;
+
+    (void)context;
+
+    if(LCD_FrameDirty == 0)
+    {
+        return;
+    }
+
+    /**< Clear first: a writer that runs meanwhile marks the frame dirty again for the next period */
+    LCD_FrameDirty = 0;
+
+    /**< Glyphs go first so no cell shows a reassigned slot with its old bitmap for a whole period */
+    if(HAL_LCD_UploadGlyphs() == 0)
+    {
+        LCD_FrameDirty = 1;
+        return;
+    }
+
+    for(uint8_t Local_Row = 0; Local_Row < LCD_ROWS; Local_Row++)
+    {
+        for(uint8_t Local_Column = 0; Local_Column < LCD_COLUMNS; Local_Column++)
+        {
+            if(LCD_Frame[Local_Row][Local_Column] == LCD_Shadow[Local_Row][Local_Column])
+            {
+                continue;
+            }
+
+            /**< Queue full: finish on the next period instead of waiting in the timer callback */
+            if((u16)(LCD_QueueHead - LCD_QueueTail) > (LCD_QUEUE_SIZE - LCD_CELL_REQUESTS))
+            {
+                LCD_FrameDirty = 1;
+                return;
+            }
+
+            /**< The LCD advances the cursor after each character, so only jumps need an address command */
+            Local_Address = LCD_RowAddress[Local_Row] + Local_Column;
+            if(Local_Address != Local_Cursor)
+            {
+                HAL_LCD_Enqueue(LCD_FrameConfig, _LCD_DDRAM_START | Local_Address, LCD_REQUEST_COMMAND, LCD_DELAY_POLL);
+            }
+
+            LCD_Shadow[Local_Row][Local_Column] = LCD_Frame[Local_Row][Local_Column];
+            HAL_LCD_Enqueue(LCD_FrameConfig, LCD_Shadow[Local_Row][Local_Column], LCD_REQUEST_DATA, LCD_DELAY_POLL);
+            Local_Cursor = Local_Address + 1;
+        }
+    }
+}
+
+static uint8_t HAL_LCD_UploadGlyphs(void)
+{
+    for(uint8_t Local_Slot = 0; Local_Slot < LCD_GLYPH_SLOTS; Local_Slot++)
+    {
+        if(GET_BIT(LCD_GlyphPending, Local_Slot) == 0)
+        {
+            continue;
+        }
+
+        if((u16)(LCD_QueueHead - LCD_QueueTail) > (LCD_QUEUE_SIZE - LCD_GLYPH_REQUESTS))
+        {
+            return 0;
+        }
+
+        /**< The CGRAM address auto-increments over the glyph's rows */
+        CLR_BIT(LCD_GlyphPending, Local_Slot);
+        HAL_LCD_Enqueue(LCD_FrameConfig, _LCD_CGRAM_START | (Local_Slot * LCD_GLYPH_ROWS), LCD_REQUEST_COMMAND, LCD_DELAY_POLL);
+        for(uint8_t i = 0; i < LCD_GLYPH_ROWS; i++)
+        {
+            HAL_LCD_Enqueue(LCD_FrameConfig, LCD_GlyphBitmap[Local_Slot][i], LCD_REQUEST_DATA, LCD_DELAY_POLL);
+        }
+    }
+
+    return 1;
+}
+
+static void HAL_LCD_ProcessQueue(void *context)
+{
+    LCD_Request_t *Local_pRequest;
+    const LCD_Config_t *Local_pConfig;
+    uint16_t Local_DelayTicks = 0;
+    uint8_t Local_Burst;
+
+    (void)context;
+
+    /**< Write requests back to back while the busy flag reports the LCD ready, at most LCD_BURST_LENGTH per expiry */
+    for(Local_Burst = 0; (Local_Burst < LCD_BURST_LENGTH) && (LCD_QueueTail != LCD_QueueHead); Local_Burst++)
+    {
+        Local_pRequest = &LCD_Queue[LCD_QueueTail & LCD_QUEUE_MASK];
+        Local_pConfig = Local_pRequest->Config;
+        Local_DelayTicks = Local_pRequest->DelayTicks;
+
+        HAL_LCD_Write(Local_pConfig, Local_pRequest->Value, Local_pRequest->Type);
+        LCD_QueueTail++;
+
+        if(Local_DelayTicks != LCD_DELAY_POLL)
+        {
+            break;  /**< Slow command: come back once the LCD has executed it */
+        }
+
+        if((LCD_BusyFlagUsable == 0) || (HAL_LCD_WaitReady(Local_pConfig) == 0))
+        {
+            /**< No busy flag (disabled, or RW not wired): one tick is longer than any short command */
+            LCD_BusyFlagUsable = 0;
+            Local_DelayTicks = 1;
+            break;
+        }
+    }
+
+    if(Local_DelayTicks != LCD_DELAY_POLL)
+    {
+        SWTMR_StartOneShot(&LCD_QueueTimer, Local_DelayTicks);
+    }
+    else if(LCD_QueueTail != LCD_QueueHead)
+    {
+        /**< Burst limit reached: continue on the next tick */
+        SWTMR_StartOneShot(&LCD_QueueTimer, 1);
+    }
+    else
+    {
+        /**< Nothing left to write */
+        LCD_QueueBusy = 0;
+    }
+}
+
+static void HAL_LCD_Write(const LCD_Config_t *config, uint8_t value, uint8_t type)
+{
+    /**< Set RS pin low for a command (RS = 0) or high for data (RS = 1) */
+    MCAL_GPIO_SetPinValue(config->rsPin.LCD_PortId, config->rsPin.LCD_PinId, (type == LCD_REQUEST_DATA) ? GPIO_HIGH : GPIO_LOW);
+    /**< Set RW pin to low for write  --> RW = 0 */
+    MCAL_GPIO_SetPinValue(config->rwPin.LCD_PortId, config->rwPin.LCD_PinId, GPIO_LOW);
+
+    if(config->mode == LCD_4BitMode)
+    {
+        HAL_LCD_Send4Bits(config, value);
+    }
+    else if(config->mode == LCD_8BitMode)
+    {
+        HAL_LCD_Send8Bits(config, value);
+    }
+    else
+    {
+        return;
+    }
+}
+
+static void HAL_LCD_PulseEnable(const LCD_Config_t *config)
+{
+    /**< Set the enable pin to high */
+    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_HIGH);
+    /**< Hold it for the minimum enable pulse width (450 ns) */
+    MCAL_DWT_DelayUs(LCD_ENABLE_PULSE_US);
+    /**< Set the enable pin to low, the LCD latches the data on this falling edge */
+    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_LOW);
+}
+
+static uint8_t HAL_LCD_WaitReady(const LCD_Config_t *config)
+{
+    uint8_t Local_BusyPin = (config->mode == LCD_4BitMode) ? 3 : 7;
+    uint8_t Local_Busy = 1;
+    u32 Local_Start;
+
+    /**< Read the status with RS = 0 and RW = 1; the pull-ups make a missing RW connection read as busy */
+    HAL_LCD_SetDataPinsMode(config, GPIO_INPUT_PULL_UP);
+    MCAL_GPIO_SetPinValue(config->rsPin.LCD_PortId, config->rsPin.LCD_PinId, GPIO_LOW);
+    MCAL_GPIO_SetPinValue(config->rwPin.LCD_PortId, config->rwPin.LCD_PinId, GPIO_HIGH);
+
+    Local_Start = MCAL_DWT_GetCycles();
+    do
+    {
+        /**< BF is on D7 while enable is high */
+        MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_HIGH);
+        MCAL_DWT_DelayUs(LCD_ENABLE_PULSE_US);
+        MCAL_GPIO_GetPinValue(config->dataPins[Local_BusyPin].LCD_PortId, config->dataPins[Local_BusyPin].LCD_PinId, &Local_Busy);
+        MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_LOW);
+        MCAL_DWT_DelayUs(LCD_ENABLE_PULSE_US);
+
+        /**< In 4-bit mode the low nibble (address counter) must be clocked out too */
+        if(config->mode == LCD_4BitMode)
+        {
+            HAL_LCD_PulseEnable(config);
+            MCAL_DWT_DelayUs(LCD_ENABLE_PULSE_US);
+        }
+    } while((Local_Busy != 0) && ((MCAL_DWT_GetCycles() - Local_Start) < LCD_BUSY_TIMEOUT_CYCLES));
+
+    MCAL_GPIO_SetPinValue(config->rwPin.LCD_PortId, config->rwPin.LCD_PinId, GPIO_LOW);
+    HAL_LCD_SetDataPinsMode(config, GPIO_OUTPUT_PUSH_PULL_10MHZ);
+
+    return (Local_Busy == 0) ? 1 : 0;
+}
+
+static void HAL_LCD_SetDataPinsMode(const LCD_Config_t *config, uint8_t mode)
+{
+    uint8_t Local_PinsCount = (config->mode == LCD_4BitMode) ? 4 : 8;
+
+    for(uint8_t i = 0; i < Local_PinsCount; i++)
+    {
+        /**< The output register selects the pull-up for an input, and is rewritten before every write */
+        MCAL_GPIO_SetPinValue(config->dataPins[i].LCD_PortId, config->dataPins[i].LCD_PinId, GPIO_HIGH);
+        MCAL_GPIO_SetPinMode(config->dataPins[i].LCD_PortId, config->dataPins[i].LCD_PinId, mode);
+    }
+}
+
 /*****************************< Private helper function to send 4 bits *****************************/ 
 static void HAL_LCD_Send4Bits(const LCD_Config_t *config, uint8_t value) 
 {
@@ -205,12 +689,7 @@ static void HAL_LCD_Send4Bits(const LCD_Config_t *config, uint8_t value)
         MCAL_GPIO_SetPinValue(config->dataPins[i].LCD_PortId, config->dataPins[i].LCD_PinId, value >> (4 + i) & 0x01);
     }
 
-    /**< Set the enable pin to high */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_HIGH);
-    /**< Set the Pulse time to be 5msec */
-    MCAL_STK_SetDelay_ms(5);
-    /**< Set the enable pin to low */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_LOW);
+    HAL_LCD_PulseEnable(config);
 
     /**< Shift the 4-LSB command to the 4-MSB */
     value <<= 4;
@@ -221,12 +700,7 @@ static void HAL_LCD_Send4Bits(const LCD_Config_t *config, uint8_t value)
         MCAL_GPIO_SetPinValue(config->dataPins[i].LCD_PortId, config->dataPins[i].LCD_PinId, value >> (4 + i) & 0x01);
     }
 
-    /**< Set the enable pin to high */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_HIGH);
-    /**< Set the Pulse time to be 5msec */
-    MCAL_STK_SetDelay_ms(5);
-    /**< Set the enable pin to low */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_LOW);
+    HAL_LCD_PulseEnable(config);
 }
 
 /*****************************< Private helper function to send 8 bits *****************************/ 
@@ -238,12 +712,6 @@ static void HAL_LCD_Send8Bits(const LCD_Config_t *config, uint8_t value)
         MCAL_GPIO_SetPinValue(config->dataPins[i].LCD_PortId, config->dataPins[i].LCD_PinId, value >> i & 0x01);
     }
 
-    /**< Set the enable pin to high */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_HIGH);
-    /**< Set the Pulse time to be 5msec */
-    MCAL_STK_SetDelay_ms(5);
-    /**< Set the enable pin to low */
-    MCAL_GPIO_SetPinValue(config->enablePin.LCD_PortId, config->enablePin.LCD_PinId, GPIO_LOW);
+    HAL_LCD_PulseEnable(config);
 }
 
-
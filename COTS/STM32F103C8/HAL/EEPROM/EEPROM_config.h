@@ -0,0 +1,53 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : EEPROM_config.h            *****************/
+/****************************************************************/
+#ifndef EEPROM_CONFIG_H_
+#define EEPROM_CONFIG_H_
+
+/**
+ * @brief 7-bit I2C address of the 24Cxx (A2..A0 strapped low).
+ */
+#define EEPROM_I2C_ADDRESS          0x50
+
+/**
+ * @brief Memory size in bytes.
+ *
+ * 24C02: 256, 24C04: 512, 24C08: 1024, 24C16: 2048, 24C32: 4096, 24C64: 8192, 24C512: 65536.
+ */
+#define EEPROM_SIZE_BYTES           4096UL
+
+/**
+ * @brief Page size in bytes (a power of two).
+ *
+ * 24C02: 8, 24C04/08/16: 16, 24C32/64: 32, 24C512: 128.
+ */
+#define EEPROM_PAGE_SIZE            32
+
+/**
+ * @brief Number of memory address bytes sent after the device address.
+ *
+ * 1 for the 24C01..24C16, where the upper address bits go into the device address, and 2 from
+ * the 24C32 up.
+ */
+#define EEPROM_ADDRESS_BYTES        2
+
+/**
+ * @brief Longest internal write cycle tolerated by the ACK polling, in microseconds.
+ *
+ * The datasheets give tWR = 5 ms (10 ms for the oldest parts); the device does not acknowledge its
+ * address until the cycle has finished.
+ */
+#define EEPROM_WRITE_TIMEOUT_US     10000UL
+
+/**
+ * @brief Most bytes fetched by one sequential read.
+ *
+ * HAL_EEPROM_Read splits longer ranges, so no single transaction holds the bus for long: 256
+ * bytes take about 6 ms at 400 kHz (23 ms at 100 kHz), well within the I2C deadline.
+ */
+#define EEPROM_READ_CHUNK           256U
+
+#endif /**< EEPROM_CONFIG_H_ */
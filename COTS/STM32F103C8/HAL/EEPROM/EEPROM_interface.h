@@ -0,0 +1,83 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : EEPROM_interface.h         *****************/
+/****************************************************************/
+#ifndef EEPROM_INTERFACE_H_
+#define EEPROM_INTERFACE_H_
+
+/**
+ * @brief Initialize the 24Cxx EEPROM driver.
+ *
+ * Clears the page cache and checks that the device acknowledges its address (waiting for a write
+ * cycle that may still be running from before a reset).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The EEPROM answered.
+ * @retval E_NOT_OK No acknowledge within EEPROM_WRITE_TIMEOUT_US.
+ *
+ * @note I2C_Init must have been called.
+ */
+Std_ReturnType HAL_EEPROM_Init(void);
+
+/**
+ * @brief Write bytes to the EEPROM.
+ *
+ * Writes are split on page boundaries, since a page write wraps around inside its page. Bytes that
+ * continue the pending run of the current page are gathered in a page cache and written together
+ * once the page is complete, when a write goes to another page or does not continue the run, or on
+ * HAL_EEPROM_Flush. Appending small records therefore costs one write cycle (and one cycle of wear)
+ * per page instead of one per record. Whole pages are written straight from Copy_pData.
+ *
+ * The function does not wait for the write cycle it starts; the next access polls the device
+ * address until it is acknowledged.
+ *
+ * @param[in] Copy_Address First memory address.
+ * @param[in] Copy_pData The bytes to write.
+ * @param[in] Copy_Length Number of bytes.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The bytes are written or cached.
+ * @retval E_NOT_OK Invalid arguments, a range beyond EEPROM_SIZE_BYTES, or an I2C failure.
+ */
+Std_ReturnType HAL_EEPROM_Write(u32 Copy_Address, const u8 *Copy_pData, u16 Copy_Length);
+
+/**
+ * @brief Read bytes from the EEPROM.
+ *
+ * Pending cached bytes are written first, so a read always returns the latest data. The range is
+ * read in sequential reads (address write, repeated start, read) of at most EEPROM_READ_CHUNK
+ * bytes each, so other I2C users get the bus between chunks.
+ *
+ * @param[in] Copy_Address First memory address.
+ * @param[out] Copy_pData Buffer for the bytes.
+ * @param[in] Copy_Length Number of bytes.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The bytes were read.
+ * @retval E_NOT_OK Invalid arguments, a range beyond EEPROM_SIZE_BYTES, or an I2C failure.
+ */
+Std_ReturnType HAL_EEPROM_Read(u32 Copy_Address, u8 *Copy_pData, u16 Copy_Length);
+
+/**
+ * @brief Write the bytes held in the page cache.
+ *
+ * Call before powering down, or after the last record of a burst.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     Nothing was pending or the page write was started.
+ * @retval E_NOT_OK The page write failed.
+ */
+Std_ReturnType HAL_EEPROM_Flush(void);
+
+/**
+ * @brief Wait for the running write cycle to finish.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The EEPROM is ready.
+ * @retval E_NOT_OK No acknowledge within EEPROM_WRITE_TIMEOUT_US.
+ */
+Std_ReturnType HAL_EEPROM_WaitReady(void);
+
+#endif /**< EEPROM_INTERFACE_H_ */
@@ -0,0 +1,61 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : EEPROM_private.h           *****************/
+/****************************************************************/
+#ifndef EEPROM_PRIVATE_H_
+#define EEPROM_PRIVATE_H_
+
+#if (EEPROM_PAGE_SIZE & (EEPROM_PAGE_SIZE - 1)) != 0
+#error "EEPROM_PAGE_SIZE must be a power of two"
+#endif
+
+#if (EEPROM_ADDRESS_BYTES != 1) && (EEPROM_ADDRESS_BYTES != 2)
+#error "EEPROM_ADDRESS_BYTES must be 1 or 2"
+#endif
+
+#define EEPROM_PAGE_MASK        ((u32)EEPROM_PAGE_SIZE - 1U)
+
+/**< Write cycle timeout in DWT cycles */
+#define EEPROM_WRITE_TIMEOUT_CYCLES     MCAL_DWT_UsToCycles(EEPROM_WRITE_TIMEOUT_US)
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Start a page write (the range must not cross a page boundary).
+ *
+ * @param[in] Copy_Address First memory address.
+ * @param[in] Copy_pData The bytes.
+ * @param[in] Copy_Length Number of bytes (1..EEPROM_PAGE_SIZE).
+ *
+ * @return E_OK if the device acknowledged every byte.
+ */
+static Std_ReturnType EEPROM_WritePage(u32 Copy_Address, const u8 *Copy_pData, u8 Copy_Length);
+
+/**
+ * @brief Put the memory address into EEPROM_TxBuffer.
+ *
+ * @param[in] Copy_Address The memory address.
+ *
+ * @return The 7-bit device address to use (with the block bits on one-address-byte parts).
+ */
+static u8 EEPROM_PrepareAddress(u32 Copy_Address);
+
+/**
+ * @brief Run one I2C transaction and wait for its end.
+ *
+ * @param[in,out] Copy_pTransaction The transaction.
+ *
+ * @return The final I2C transaction status.
+ */
+static u8 EEPROM_Execute(I2C_Transaction_t *Copy_pTransaction);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< EEPROM_PRIVATE_H_ */
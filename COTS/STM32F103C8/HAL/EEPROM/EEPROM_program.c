@@ -0,0 +1,264 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : EEPROM_program.c           *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "DWT_interface.h"
+#include "I2C_interface.h"
+/*****************************< HAL *****************************/
+#include "EEPROM_interface.h"
+#include "EEPROM_config.h"
+#include "EEPROM_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Page cache: the dirty bytes are the contiguous run [EEPROM_DirtyFirst, EEPROM_DirtyEnd) of page EEPROM_CachePage */
+static u8 EEPROM_Cache[EEPROM_PAGE_SIZE];
+static u32 EEPROM_CachePage = 0;
+static u8 EEPROM_DirtyFirst = 0;
+static u8 EEPROM_DirtyEnd = 0;      /**< Equal to EEPROM_DirtyFirst when nothing is pending */
+
+/**< Memory address followed by at most one page, as sent in a page write */
+static u8 EEPROM_TxBuffer[EEPROM_ADDRESS_BYTES + EEPROM_PAGE_SIZE];
+
+/**< Set when a write cycle was started and not yet seen to finish */
+static u8 EEPROM_WriteInProgress = 0;
+/*****************************< Function Implementations *****************************/
+Std_ReturnType HAL_EEPROM_Init(void)
+{
+    /**< The ACK polling timeout is measured with the cycle counter */
+    MCAL_DWT_Init();
+
+    EEPROM_CachePage = 0;
+    EEPROM_DirtyFirst = 0;
+    EEPROM_DirtyEnd = 0;
+
+    /**< A write cycle may still be running from before a reset: poll once to find out */
+    EEPROM_WriteInProgress = 1;
+
+    return HAL_EEPROM_WaitReady();
+}
+
+Std_ReturnType HAL_EEPROM_Write(u32 Copy_Address, const u8 *Copy_pData, u16 Copy_Length)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u32 Local_Page;
+    u8 Local_Offset;
+    u8 Local_Chunk;
+    u8 Local_Index;
+
+    if ((Copy_pData == NULL) || (Copy_Length == 0) || ((Copy_Address + Copy_Length) > EEPROM_SIZE_BYTES))
+    {
+        return E_NOT_OK;
+    }
+
+    while ((Copy_Length != 0) && (Local_FunctionStatus == E_OK))
+    {
+        /**< Part of the write that stays inside the current page */
+        Local_Page = Copy_Address & ~EEPROM_PAGE_MASK;
+        Local_Offset = (u8)(Copy_Address & EEPROM_PAGE_MASK);
+        Local_Chunk = (u8)(EEPROM_PAGE_SIZE - Local_Offset);
+        if (Local_Chunk > Copy_Length)
+        {
+            Local_Chunk = (u8)Copy_Length;
+        }
+
+        if (Local_Chunk == EEPROM_PAGE_SIZE)
+        {
+            /**< A whole page needs no gathering; it supersedes any cached bytes of the same page */
+            if (Local_Page == EEPROM_CachePage)
+            {
+                EEPROM_DirtyFirst = 0;
+                EEPROM_DirtyEnd = 0;
+            }
+            Local_FunctionStatus = EEPROM_WritePage(Copy_Address, Copy_pData, Local_Chunk);
+        }
+        else
+        {
+            /**< A page write is one contiguous run: write out the cache unless the new bytes extend or overlap it */
+            if ((EEPROM_DirtyEnd != EEPROM_DirtyFirst) &&
+                ((Local_Page != EEPROM_CachePage) || (Local_Offset > EEPROM_DirtyEnd) ||
+                 ((Local_Offset + Local_Chunk) < EEPROM_DirtyFirst)))
+            {
+                Local_FunctionStatus = HAL_EEPROM_Flush();
+            }
+
+            if (EEPROM_DirtyEnd == EEPROM_DirtyFirst)
+            {
+                EEPROM_CachePage = Local_Page;
+                EEPROM_DirtyFirst = Local_Offset;
+                EEPROM_DirtyEnd = Local_Offset;
+            }
+
+            for (Local_Index = 0; Local_Index < Local_Chunk; Local_Index++)
+            {
+                EEPROM_Cache[Local_Offset + Local_Index] = Copy_pData[Local_Index];
+            }
+
+            if (Local_Offset < EEPROM_DirtyFirst)
+            {
+                EEPROM_DirtyFirst = Local_Offset;
+            }
+            if ((Local_Offset + Local_Chunk) > EEPROM_DirtyEnd)
+            {
+                EEPROM_DirtyEnd = (u8)(Local_Offset + Local_Chunk);
+            }
+
+            /**< The page is complete: no later write can add to it */
+            if ((Local_FunctionStatus == E_OK) && (EEPROM_DirtyFirst == 0) && (EEPROM_DirtyEnd == EEPROM_PAGE_SIZE))
+            {
+                Local_FunctionStatus = HAL_EEPROM_Flush();
+            }
+        }
+
+        Copy_Address += Local_Chunk;
+        Copy_pData += Local_Chunk;
+        Copy_Length -= Local_Chunk;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_EEPROM_Read(u32 Copy_Address, u8 *Copy_pData, u16 Copy_Length)
+{
+    I2C_Transaction_t Local_Transaction = {0};
+    u16 Local_Chunk;
+
+    if ((Copy_pData == NULL) || (Copy_Length == 0) || ((Copy_Address + Copy_Length) > EEPROM_SIZE_BYTES))
+    {
+        return E_NOT_OK;
+    }
+
+    if ((HAL_EEPROM_Flush() != E_OK) || (HAL_EEPROM_WaitReady() != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    while (Copy_Length > 0)
+    {
+        Local_Chunk = (Copy_Length > EEPROM_READ_CHUNK) ? (u16)EEPROM_READ_CHUNK : Copy_Length;
+
+        /**< Dummy write of the address, then a sequential read across as many pages as the chunk spans */
+        Local_Transaction.Address = EEPROM_PrepareAddress(Copy_Address);
+        Local_Transaction.pWriteData = EEPROM_TxBuffer;
+        Local_Transaction.WriteLength = EEPROM_ADDRESS_BYTES;
+        Local_Transaction.pReadData = Copy_pData;
+        Local_Transaction.ReadLength = Local_Chunk;
+
+        if (EEPROM_Execute(&Local_Transaction) != I2C_STATUS_DONE)
+        {
+            return E_NOT_OK;
+        }
+
+        Copy_Address += Local_Chunk;
+        Copy_pData += Local_Chunk;
+        Copy_Length -= Local_Chunk;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType HAL_EEPROM_Flush(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_First = EEPROM_DirtyFirst;
+    u8 Local_End = EEPROM_DirtyEnd;
+
+    if (Local_End != Local_First)
+    {
+        /**< The cache is released even on failure, so one bad write does not block every later one */
+        EEPROM_DirtyFirst = 0;
+        EEPROM_DirtyEnd = 0;
+        Local_FunctionStatus = EEPROM_WritePage(EEPROM_CachePage + Local_First, &EEPROM_Cache[Local_First], (u8)(Local_End - Local_First));
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_EEPROM_WaitReady(void)
+{
+    I2C_Transaction_t Local_Transaction = {0};
+    u32 Local_Start;
+
+    if (EEPROM_WriteInProgress == 0)
+    {
+        return E_OK;
+    }
+
+    /**< ACK polling: the device ignores its address until the write cycle is over */
+    Local_Transaction.Address = EEPROM_I2C_ADDRESS;
+    Local_Start = MCAL_DWT_GetCycles();
+
+    do
+    {
+        if (EEPROM_Execute(&Local_Transaction) == I2C_STATUS_DONE)
+        {
+            EEPROM_WriteInProgress = 0;
+            return E_OK;
+        }
+    } while ((MCAL_DWT_GetCycles() - Local_Start) < EEPROM_WRITE_TIMEOUT_CYCLES);
+
+    return E_NOT_OK;
+}
+/*****************************< Private Functions *****************************/
+static Std_ReturnType EEPROM_WritePage(u32 Copy_Address, const u8 *Copy_pData, u8 Copy_Length)
+{
+    I2C_Transaction_t Local_Transaction = {0};
+    u8 Local_Index;
+
+    if (HAL_EEPROM_WaitReady() != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_Transaction.Address = EEPROM_PrepareAddress(Copy_Address);
+    for (Local_Index = 0; Local_Index < Copy_Length; Local_Index++)
+    {
+        EEPROM_TxBuffer[EEPROM_ADDRESS_BYTES + Local_Index] = Copy_pData[Local_Index];
+    }
+    Local_Transaction.pWriteData = EEPROM_TxBuffer;
+    Local_Transaction.WriteLength = (u16)(EEPROM_ADDRESS_BYTES + Copy_Length);
+
+    if (EEPROM_Execute(&Local_Transaction) != I2C_STATUS_DONE)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Do not wait for tWR here: the next access polls for it */
+    EEPROM_WriteInProgress = 1;
+
+    return E_OK;
+}
+
+static u8 EEPROM_PrepareAddress(u32 Copy_Address)
+{
+#if EEPROM_ADDRESS_BYTES == 2
+    EEPROM_TxBuffer[0] = (u8)(Copy_Address >> 8);
+    EEPROM_TxBuffer[1] = (u8)Copy_Address;
+    return EEPROM_I2C_ADDRESS;
+#else
+    /**< Address bits 8..10 select the 256-byte block through the device address */
+    EEPROM_TxBuffer[0] = (u8)Copy_Address;
+    return (u8)(EEPROM_I2C_ADDRESS | ((Copy_Address >> 8) & 0x07U));
+#endif
+}
+
+static u8 EEPROM_Execute(I2C_Transaction_t *Copy_pTransaction)
+{
+    if (I2C_Submit(Copy_pTransaction) != E_OK)
+    {
+        return I2C_STATUS_BUS_ERROR;
+    }
+
+    while (Copy_pTransaction->Status == I2C_STATUS_PENDING)
+    {
+        I2C_ProcessTimeouts();
+    }
+
+    return Copy_pTransaction->Status;
+}
+/*****************************< End of Function Implementations *****************************/
@@ -3,4 +3,61 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : KPD_config.h               *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef KPD_CONFIG_H_
+#define KPD_CONFIG_H_
+
+/**
+ * @brief Row pins (inputs with pull-up, one EXTI line each).
+ *
+ * All rows are on KPD_ROW_PORT and must use different pin numbers, since pin n of every port
+ * shares EXTI line n.
+ */
+#define KPD_ROW_PORT        GPIO_PORTA
+#define KPD_ROW0_PIN        GPIO_PIN0
+#define KPD_ROW1_PIN        GPIO_PIN1
+#define KPD_ROW2_PIN        GPIO_PIN2
+#define KPD_ROW3_PIN        GPIO_PIN3
+
+/**
+ * @brief Column pins (open-drain outputs).
+ */
+#define KPD_COL_PORT        GPIO_PORTB
+#define KPD_COL0_PIN        GPIO_PIN12
+#define KPD_COL1_PIN        GPIO_PIN13
+#define KPD_COL2_PIN        GPIO_PIN14
+#define KPD_COL3_PIN        GPIO_PIN15
+
+/**
+ * @brief Key codes reported for each row (outer) and column (inner).
+ */
+#define KPD_KEY_MAP         {{'1', '2', '3', 'A'}, \
+                             {'4', '5', '6', 'B'}, \
+                             {'7', '8', '9', 'C'}, \
+                             {'*', '0', '#', 'D'}}
+
+/**
+ * @brief Matrix scan period while a key is active, in milliseconds.
+ */
+#define KPD_SCAN_PERIOD_MS      5
+
+/**
+ * @brief Consecutive scans a key must read the same before its change is reported.
+ *
+ * With a 5 ms scan period, 4 scans give 20 ms of debouncing.
+ */
+#define KPD_DEBOUNCE_SCANS      4
+
+/**
+ * @brief Busy-loop iterations between driving a column and reading the rows.
+ *
+ * Gives the row lines time to settle through the pull-ups; 10 iterations are plenty at 72 MHz.
+ */
+#define KPD_SETTLE_LOOPS        10
+
+/**
+ * @brief Number of key events the queue can hold (must be a power of two).
+ */
+#define KPD_EVENT_QUEUE_SIZE    16
+
+#endif /**< KPD_CONFIG_H_ */
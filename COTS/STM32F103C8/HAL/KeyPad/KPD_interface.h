@@ -3,4 +3,62 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : KPD_interface.h            *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef KPD_INTERFACE_H_
+#define KPD_INTERFACE_H_
+
+/**
+ * @name Keypad Event Types
+ * @{
+ */
+#define KPD_KEY_PRESSED     0   /**< The key went down (after debouncing) */
+#define KPD_KEY_RELEASED    1   /**< The key went up (after debouncing) */
+/** @} */
+
+/**
+ * @brief Keypad event, as returned by HAL_KPD_GetEvent.
+ */
+typedef struct
+{
+    u8 Key;     /**< Key code from KPD_KEY_MAP */
+    u8 Type;    /**< KPD_KEY_PRESSED or KPD_KEY_RELEASED */
+} KPD_Event_t;
+
+/**
+ * @brief Initialize the 4x4 matrix keypad.
+ *
+ * The columns are open-drain outputs parked low and the rows are pulled-up inputs whose EXTI lines
+ * trigger on the falling edge. While no key is pressed the driver does no work at all: the first
+ * press wakes it through EXTI, it then scans the matrix every KPD_SCAN_PERIOD_MS with per-key
+ * debouncing, and it parks again once every key has been released.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The keypad is waiting for a key press.
+ * @retval E_NOT_OK The pins or the scan timer could not be configured.
+ *
+ * @note The GPIO/AFIO clocks and the SWTMR service must be initialized first, and the NVIC
+ *       interrupts of the row EXTI lines must be enabled by the application.
+ */
+Std_ReturnType HAL_KPD_Init(void);
+
+/**
+ * @brief Take the oldest key event from the event queue.
+ *
+ * @param[out] Copy_pEvent Receives the event.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     An event was copied to Copy_pEvent.
+ * @retval E_NOT_OK The queue is empty or Copy_pEvent is NULL.
+ *
+ * @note Events are produced in interrupt context; call this from a single task.
+ */
+Std_ReturnType HAL_KPD_GetEvent(KPD_Event_t *Copy_pEvent);
+
+/**
+ * @brief Check whether the keypad is being scanned.
+ *
+ * @return 1 while a key is pressed or being debounced, 0 while the keypad is parked on EXTI.
+ */
+u8 HAL_KPD_IsScanning(void);
+
+#endif /**< KPD_INTERFACE_H_ */
@@ -3,4 +3,62 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : KPD_private.h              *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef KPD_PRIVATE_H_
+#define KPD_PRIVATE_H_
+
+/**< Matrix size */
+#define KPD_ROWS                4
+#define KPD_COLS                4
+
+#if (KPD_EVENT_QUEUE_SIZE & (KPD_EVENT_QUEUE_SIZE - 1)) != 0
+#error "KPD_EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+#define KPD_EVENT_QUEUE_MASK    (KPD_EVENT_QUEUE_SIZE - 1)
+
+/**< Bit of a key in the 16-bit matrix image */
+#define KPD_KEY_BIT(ROW, COL)   ((ROW) * KPD_COLS + (COL))
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Drive every column low and re-arm the row EXTI lines (idle state).
+ */
+static void KPD_Park(void);
+
+/**
+ * @brief EXTI callback of the row lines: stop listening and start scanning.
+ */
+static void KPD_WakeUp(void);
+
+/**
+ * @brief Scan timer callback: sample the matrix, debounce and queue events.
+ *
+ * @param[in] Copy_pvContext Unused.
+ */
+static void KPD_Scan(void *Copy_pvContext);
+
+/**
+ * @brief Read the whole matrix.
+ *
+ * @return The raw matrix image, bit KPD_KEY_BIT(row, col) set when the key reads pressed.
+ */
+static u16 KPD_ReadMatrix(void);
+
+/**
+ * @brief Queue one key event; the event is dropped when the queue is full.
+ *
+ * @param[in] Copy_Key The key code.
+ * @param[in] Copy_Type KPD_KEY_PRESSED or KPD_KEY_RELEASED.
+ */
+static void KPD_PushEvent(u8 Copy_Key, u8 Copy_Type);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< KPD_PRIVATE_H_ */
@@ -3,4 +3,232 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : KPD_program.c              *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "GPIO_interface.h"
+#include "EXTI_interface.h"
+/*****************************< SERVICES *****************************/
+#include "SWTMR_interface.h"
+/*****************************< HAL *****************************/
+#include "KPD_interface.h"
+#include "KPD_config.h"
+#include "KPD_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Pin tables */
+static const u8 KPD_RowPins[KPD_ROWS] = {KPD_ROW0_PIN, KPD_ROW1_PIN, KPD_ROW2_PIN, KPD_ROW3_PIN};
+static const u8 KPD_ColPins[KPD_COLS] = {KPD_COL0_PIN, KPD_COL1_PIN, KPD_COL2_PIN, KPD_COL3_PIN};
+
+/**< Key codes */
+static const u8 KPD_KeyMap[KPD_ROWS][KPD_COLS] = KPD_KEY_MAP;
+
+/**< Debounced key states (bit set = pressed) */
+static u16 KPD_StableState = 0;
+
+/**< Consecutive scans each key has disagreed with its debounced state */
+static u8 KPD_DebounceCount[KPD_ROWS * KPD_COLS];
+
+/**< Scan timer, running only while a key is active */
+static SWTMR_Timer_t KPD_ScanTimer;
+
+/**
+ * @brief Key events, produced by the scan and consumed by HAL_KPD_GetEvent.
+ *
+ * Head and tail are free-running counters; the slot index is the counter masked with KPD_EVENT_QUEUE_MASK.
+ */
+static KPD_Event_t KPD_EventQueue[KPD_EVENT_QUEUE_SIZE];
+static volatile u8 KPD_EventHead = 0;
+static volatile u8 KPD_EventTail = 0;
+/*****************************< Function Implementations *****************************/
+Std_ReturnType HAL_KPD_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < KPD_COLS; Local_Index++)
+    {
+        Local_FunctionStatus &= MCAL_GPIO_SetPinMode(KPD_COL_PORT, KPD_ColPins[Local_Index], GPIO_OUTPUT_OPEN_DRAIN_2MHZ);
+    }
+
+    for (Local_Index = 0; Local_Index < KPD_ROWS; Local_Index++)
+    {
+        /**< Input with pull-up: the ODR bit selects the pull-up */
+        Local_FunctionStatus &= MCAL_GPIO_SetPinMode(KPD_ROW_PORT, KPD_RowPins[Local_Index], GPIO_INPUT_PULL_UP);
+        Local_FunctionStatus &= MCAL_GPIO_SetPinValue(KPD_ROW_PORT, KPD_RowPins[Local_Index], GPIO_HIGH);
+
+        Local_FunctionStatus &= MCAL_EXTI_InitEXTIForGPIO(KPD_RowPins[Local_Index], KPD_ROW_PORT);
+        Local_FunctionStatus &= MCAL_EXTI_SetTrigger(KPD_RowPins[Local_Index], EXTI_FALLING_EDGE);
+        Local_FunctionStatus &= MCAL_EXTI_SetCallback(KPD_RowPins[Local_Index], KPD_WakeUp);
+    }
+
+    for (Local_Index = 0; Local_Index < (KPD_ROWS * KPD_COLS); Local_Index++)
+    {
+        KPD_DebounceCount[Local_Index] = 0;
+    }
+
+    KPD_StableState = 0;
+    KPD_EventHead = 0;
+    KPD_EventTail = 0;
+
+    Local_FunctionStatus &= SWTMR_Create(&KPD_ScanTimer, KPD_Scan, NULL);
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        KPD_Park();
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_KPD_GetEvent(KPD_Event_t *Copy_pEvent)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_Tail = KPD_EventTail;
+
+    if ((Copy_pEvent != NULL) && (Local_Tail != KPD_EventHead))
+    {
+        *Copy_pEvent = KPD_EventQueue[Local_Tail & KPD_EVENT_QUEUE_MASK];
+        KPD_EventTail = (u8)(Local_Tail + 1);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+u8 HAL_KPD_IsScanning(void)
+{
+    return SWTMR_IsActive(&KPD_ScanTimer);
+}
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+static void KPD_Park(void)
+{
+    u8 Local_Index;
+
+    /**< With every column low, any key press pulls its row low */
+    for (Local_Index = 0; Local_Index < KPD_COLS; Local_Index++)
+    {
+        MCAL_GPIO_SetPinValue(KPD_COL_PORT, KPD_ColPins[Local_Index], GPIO_LOW);
+    }
+
+    /**< Drop the edges latched while scanning, then listen again */
+    for (Local_Index = 0; Local_Index < KPD_ROWS; Local_Index++)
+    {
+        MCAL_EXTI_ClearPending(KPD_RowPins[Local_Index]);
+        MCAL_EXTI_EnableLine(KPD_RowPins[Local_Index]);
+    }
+}
+
+static void KPD_WakeUp(void)
+{
+    u8 Local_Index;
+
+    /**< The scan toggles the rows, so stop listening until the keypad is idle again */
+    for (Local_Index = 0; Local_Index < KPD_ROWS; Local_Index++)
+    {
+        MCAL_EXTI_DisableLine(KPD_RowPins[Local_Index]);
+    }
+
+    /**< Release every column (open-drain high = floating) before scanning them one by one */
+    for (Local_Index = 0; Local_Index < KPD_COLS; Local_Index++)
+    {
+        MCAL_GPIO_SetPinValue(KPD_COL_PORT, KPD_ColPins[Local_Index], GPIO_HIGH);
+    }
+
+    SWTMR_StartPeriodic(&KPD_ScanTimer, SWTMR_MsToTicks(KPD_SCAN_PERIOD_MS));
+}
+
+static void KPD_Scan(void *Copy_pvContext)
+{
+    u16 Local_Raw = KPD_ReadMatrix();
+    u16 Local_Changed = Local_Raw ^ KPD_StableState;
+    u8 Local_Row;
+    u8 Local_Col;
+    u8 Local_Bit;
+
+    (void)Copy_pvContext;
+
+    for (Local_Row = 0; Local_Row < KPD_ROWS; Local_Row++)
+    {
+        for (Local_Col = 0; Local_Col < KPD_COLS; Local_Col++)
+        {
+            Local_Bit = KPD_KEY_BIT(Local_Row, Local_Col);
+
+            if (GET_BIT(Local_Changed, Local_Bit) == 0)
+            {
+                /**< Agrees with its debounced state: any bounce in progress is over */
+                KPD_DebounceCount[Local_Bit] = 0;
+            }
+            else if (++KPD_DebounceCount[Local_Bit] >= KPD_DEBOUNCE_SCANS)
+            {
+                KPD_DebounceCount[Local_Bit] = 0;
+                TOG_BIT(KPD_StableState, Local_Bit);
+                KPD_PushEvent(KPD_KeyMap[Local_Row][Local_Col],
+                              (GET_BIT(KPD_StableState, Local_Bit) != 0) ? KPD_KEY_PRESSED : KPD_KEY_RELEASED);
+            }
+        }
+    }
+
+    /**< Nothing pressed and nothing bouncing: go back to sleeping on EXTI */
+    if ((KPD_StableState | Local_Raw) == 0)
+    {
+        SWTMR_Stop(&KPD_ScanTimer);
+        KPD_Park();
+    }
+}
+
+static u16 KPD_ReadMatrix(void)
+{
+    u16 Local_Matrix = 0;
+    u8 Local_Row;
+    u8 Local_Col;
+    u8 Local_PinValue;
+    volatile u16 Local_Loop;
+
+    for (Local_Col = 0; Local_Col < KPD_COLS; Local_Col++)
+    {
+        MCAL_GPIO_SetPinValue(KPD_COL_PORT, KPD_ColPins[Local_Col], GPIO_LOW);
+        for (Local_Loop = 0; Local_Loop < KPD_SETTLE_LOOPS; Local_Loop++)
+        {
+        }
+
+        /**< A pressed key connects its row to the driven column */
+        for (Local_Row = 0; Local_Row < KPD_ROWS; Local_Row++)
+        {
+            MCAL_GPIO_GetPinValue(KPD_ROW_PORT, KPD_RowPins[Local_Row], &Local_PinValue);
+            if (Local_PinValue == GPIO_LOW)
+            {
+                SET_BIT(Local_Matrix, KPD_KEY_BIT(Local_Row, Local_Col));
+            }
+        }
+
+        MCAL_GPIO_SetPinValue(KPD_COL_PORT, KPD_ColPins[Local_Col], GPIO_HIGH);
+    }
+
+    return Local_Matrix;
+}
+
+static void KPD_PushEvent(u8 Copy_Key, u8 Copy_Type)
+{
+    u8 Local_Head = KPD_EventHead;
+
+    if ((u8)(Local_Head - KPD_EventTail) < KPD_EVENT_QUEUE_SIZE)
+    {
+        KPD_EventQueue[Local_Head & KPD_EVENT_QUEUE_MASK].Key = Copy_Key;
+        KPD_EventQueue[Local_Head & KPD_EVENT_QUEUE_MASK].Type = Copy_Type;
+        KPD_EventHead = (u8)(Local_Head + 1);
+    }
+}
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+/*****************************< End of Function Implementations *****************************/
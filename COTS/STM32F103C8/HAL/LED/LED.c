@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 16 Sep 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.2                        *****************/
 /******* File Name : LED_program.c              *****************/
 /****************************************************************/
 
@@ -10,9 +10,90 @@
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
 #include "GPIO_interface.h"
-#include "STK_interface.h"
+#include "TIM_interface.h"
+#include "SCB_interface.h"
+/*****************************< SERVICES *****************************/
+#include "SWTMR_interface.h"
 /*****************************< HAL *****************************/
 #include "LED.h"
+/*****************************< Private Section *****************************/
+#if (LED_MAX_LEDS < 1) || (LED_MAX_LEDS > 255)
+#error "LED_MAX_LEDS must be between 1 and 255"
+#endif
+
+#define LED_PORTS_COUNT         3
+#define LED_NO_PWM              0xFF
+#define LED_NOT_REGISTERED      0xFF    /**< Never a valid identifier: LED_MAX_LEDS is at most 255 */
+
+/**< Timer channels on their default (not remapped) pins */
+typedef struct {
+    u8 Port;
+    u8 Pin;
+    u8 Timer;
+    u8 Channel;
+} LED_PwmPin_t;
+
+static const LED_PwmPin_t LED_PwmPins[] = {
+    {LED_PORTA, LED_PIN0, TIM_2, TIM_CHANNEL1}, {LED_PORTA, LED_PIN1, TIM_2, TIM_CHANNEL2},
+    {LED_PORTA, LED_PIN2, TIM_2, TIM_CHANNEL3}, {LED_PORTA, LED_PIN3, TIM_2, TIM_CHANNEL4},
+    {LED_PORTA, LED_PIN6, TIM_3, TIM_CHANNEL1}, {LED_PORTA, LED_PIN7, TIM_3, TIM_CHANNEL2},
+    {LED_PORTB, LED_PIN0, TIM_3, TIM_CHANNEL3}, {LED_PORTB, LED_PIN1, TIM_3, TIM_CHANNEL4},
+    {LED_PORTB, LED_PIN6, TIM_4, TIM_CHANNEL1}, {LED_PORTB, LED_PIN7, TIM_4, TIM_CHANNEL2},
+    {LED_PORTB, LED_PIN8, TIM_4, TIM_CHANNEL3}, {LED_PORTB, LED_PIN9, TIM_4, TIM_CHANNEL4},
+};
+
+#define LED_PWM_PINS_COUNT      (sizeof(LED_PwmPins) / sizeof(LED_PwmPins[0]))
+
+/**< Pattern table, indexed by LED_Pattern_t */
+static const LED_Step_t LED_StepsBlinkSlow[] = {LED_HOLD(100, 500), LED_HOLD(0, 500)};
+static const LED_Step_t LED_StepsBlinkFast[] = {LED_HOLD(100, 100), LED_HOLD(0, 100)};
+static const LED_Step_t LED_StepsHeartbeat[] = {LED_HOLD(100, 100), LED_HOLD(0, 150), LED_HOLD(100, 100), LED_HOLD(0, 650)};
+static const LED_Step_t LED_StepsBreathing[] = {LED_RAMP(100, 1500), LED_RAMP(0, 1500)};
+static const LED_Step_t LED_StepsBlinkCode[] = {LED_HOLD(100, 200), LED_HOLD(0, 300), LED_REPEAT(0), LED_HOLD(0, 1500)};
+static const LED_Step_t LED_StepsBlinkN[] = {{100, 1}, {0, 1}, LED_REPEAT(0)}; /**< Stretched by the LED's tick divider */
+
+static const LED_PatternDef_t LED_Patterns[LED_PATTERNS_COUNT] = {
+    {LED_StepsBlinkSlow, sizeof(LED_StepsBlinkSlow) / sizeof(LED_Step_t), 1},
+    {LED_StepsBlinkFast, sizeof(LED_StepsBlinkFast) / sizeof(LED_Step_t), 1},
+    {LED_StepsHeartbeat, sizeof(LED_StepsHeartbeat) / sizeof(LED_Step_t), 1},
+    {LED_StepsBreathing, sizeof(LED_StepsBreathing) / sizeof(LED_Step_t), 1},
+    {LED_StepsBlinkCode, sizeof(LED_StepsBlinkCode) / sizeof(LED_Step_t), 1},
+    {LED_StepsBlinkN, sizeof(LED_StepsBlinkN) / sizeof(LED_Step_t), 0},
+};
+
+/**< Per-LED engine state */
+typedef struct {
+    const LED_PatternDef_t *pPattern;   /**< Running pattern, NULL when the LED holds a fixed level */
+    u16 Divider;                        /**< Engine ticks per pattern tick */
+    u16 DividerCount;
+    u8 Port;
+    u8 Pin;
+    u8 PwmIndex;                        /**< Entry of LED_PwmPins, or LED_NO_PWM */
+    u8 Level;                           /**< Current brightness in percent */
+    u8 StartLevel;                      /**< Level at the start of the current step (ramp origin) */
+    u8 StepIndex;                       /**< Current step */
+    u8 NextStep;                        /**< Step loaded when the current one ends */
+    u8 TicksLeft;                       /**< Pattern ticks left in the current step */
+    u8 PassesLeft;                      /**< Passes left before the next repeat marker lets go, 0 when not counting */
+    u8 Count;                           /**< Repeat count of markers with a zero level */
+} LED_State_t;
+
+static LED_State_t LED_States[LED_MAX_LEDS];
+static volatile u8 LED_Count = 0;
+
+/**< Timers already set up for PWM */
+static u8 LED_PwmTimersStarted = 0;
+
+/**< Engine timer */
+static SWTMR_Timer_t LED_EffectTimer;
+
+static u8 LED_FindLed(u8 Copy_Port, u8 Copy_Pin);
+static u8 LED_FindPwmPin(u8 Copy_Port, u8 Copy_Pin);
+static Std_ReturnType LED_StartPwm(u8 Copy_PwmIndex);
+static Std_ReturnType LED_Run(u8 Copy_LedId, LED_Pattern_t Copy_Pattern, u8 Copy_Count, u16 Copy_Divider);
+static void LED_ApplyLevel(LED_State_t *Copy_pState, u8 Copy_Level);
+static u8 LED_LoadNextStep(LED_State_t *Copy_pState);
+static void LED_Tick(void *Copy_pvContext);
 /*****************************< Function Implementations *****************************/
 /**
  * @defgroup Public_Functions LED Driver
@@ -27,53 +108,392 @@ Std_ReturnType HAL_LED_Init(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 
 Std_ReturnType HAL_LED_On(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
+    u8 Local_LedId = LED_FindLed(Copy_LedPortId, Copy_LedPinId);
+
+    /**< A registered LED may be a PWM output: go through the engine so its level stays in step */
+    if (Local_LedId != LED_NOT_REGISTERED)
+    {
+        return HAL_LED_SetBrightness(Local_LedId, 100);
+    }
+
     return MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_HIGH);
 }
 
 Std_ReturnType HAL_LED_Off(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
+    u8 Local_LedId = LED_FindLed(Copy_LedPortId, Copy_LedPinId);
+
+    if (Local_LedId != LED_NOT_REGISTERED)
+    {
+        return HAL_LED_SetBrightness(Local_LedId, 0);
+    }
+
     return MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_LOW);
 }
 
 Std_ReturnType HAL_LED_Toggle(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId)
 {
+    u8 Local_LedId = LED_FindLed(Copy_LedPortId, Copy_LedPinId);
+
+    if (Local_LedId != LED_NOT_REGISTERED)
+    {
+        return HAL_LED_SetBrightness(Local_LedId, (LED_States[Local_LedId].Level != 0) ? 0 : 100);
+    }
+
     return MCAL_GPIO_TogglePin(Copy_LedPortId, Copy_LedPinId);
 }
 
 Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime)
 {
-    if(MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_HIGH) == E_NOT_OK)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_Ticks = LED_MS_TO_TICKS(Copy_BlinkTime);
+    u8 Local_LedId;
+
+    if ((Local_Ticks != 0) && (Local_Ticks <= 0xFFFF) &&
+        (HAL_LED_Register(Copy_LedPortId, Copy_LedPinId, &Local_LedId) == E_OK))
     {
-        return E_NOT_OK;
+        Local_FunctionStatus = LED_Run(Local_LedId, LED_PATTERN_BLINK_N, 1, (u16)Local_Ticks);
     }
 
-    if(MCAL_STK_SetDelay_ms(Copy_BlinkTime) == E_NOT_OK)
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_Ticks = LED_MS_TO_TICKS(Copy_BlinkTime);
+    u8 Local_LedId;
+
+    if ((Local_Ticks != 0) && (Local_Ticks <= 0xFFFF) &&
+        (HAL_LED_Register(Copy_LedPortId, Copy_LedPinId, &Local_LedId) == E_OK))
+    {
+        Local_FunctionStatus = LED_Run(Local_LedId, LED_PATTERN_BLINK_N, 2, (u16)Local_Ticks);
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_Register(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, u8 *Copy_pLedId)
+{
+    u8 Local_Id = LED_Count;
+    u8 Local_Existing;
+    LED_State_t *Local_pState;
+
+    if ((Copy_pLedId == NULL) || (Copy_LedPortId >= LED_PORTS_COUNT) || (Copy_LedPinId > LED_PIN15))
     {
         return E_NOT_OK;
     }
 
-    if(MCAL_GPIO_SetPinValue(Copy_LedPortId, Copy_LedPinId, GPIO_LOW) == E_NOT_OK)
+    Local_Existing = LED_FindLed(Copy_LedPortId, Copy_LedPinId);
+    if (Local_Existing != LED_NOT_REGISTERED)
+    {
+        *Copy_pLedId = Local_Existing; /**< Already registered */
+        return E_OK;
+    }
+
+    if (Local_Id >= LED_MAX_LEDS)
     {
         return E_NOT_OK;
     }
 
+    /**< The first registration starts the engine */
+    if (Local_Id == 0)
+    {
+        if ((SWTMR_Create(&LED_EffectTimer, LED_Tick, NULL) != E_OK) ||
+            (SWTMR_StartPeriodic(&LED_EffectTimer, SWTMR_MsToTicks(LED_EFFECT_TICK_MS)) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    Local_pState = &LED_States[Local_Id];
+    Local_pState->pPattern = NULL;
+    Local_pState->Port = Copy_LedPortId;
+    Local_pState->Pin = Copy_LedPinId;
+    Local_pState->PwmIndex = LED_FindPwmPin(Copy_LedPortId, Copy_LedPinId);
+    Local_pState->Level = 0;
+
+    if (Local_pState->PwmIndex != LED_NO_PWM)
+    {
+        if ((LED_StartPwm(Local_pState->PwmIndex) != E_OK) ||
+            (MCAL_GPIO_SetPinMode(Copy_LedPortId, Copy_LedPinId, GPIO_OUTPUT_AF_PUSH_PULL_2MHZ) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+    }
+    else
+    {
+        if ((HAL_LED_Init(Copy_LedPortId, Copy_LedPinId) != E_OK) || (HAL_LED_Off(Copy_LedPortId, Copy_LedPinId) != E_OK))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    /**< Publish the LED last: the engine only looks at the first LED_Count entries */
+    LED_Count = Local_Id + 1;
+
+    *Copy_pLedId = Local_Id;
+
     return E_OK;
 }
 
-Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime)
+Std_ReturnType HAL_LED_StartPattern(u8 Copy_LedId, LED_Pattern_t Copy_Pattern)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    /**< The blink code patterns take a count, see HAL_LED_SetBlinkCode and HAL_LED_BlinkOnce */
+    if (Copy_Pattern < LED_PATTERN_BLINK_CODE)
+    {
+        Local_FunctionStatus = LED_Run(Copy_LedId, Copy_Pattern, 0, 1);
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_SetBlinkCode(u8 Copy_LedId, u8 Copy_Count)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (Copy_Count != 0)
+    {
+        Local_FunctionStatus = LED_Run(Copy_LedId, LED_PATTERN_BLINK_CODE, Copy_Count, 1);
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_SetBrightness(u8 Copy_LedId, u8 Copy_Percent)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if ((Copy_LedId < LED_Count) && (Copy_Percent <= 100))
+    {
+        /**< LED_Tick runs in interrupt context: detach the pattern and set the level as one step */
+        Local_PrimaskState = SCB_EnterCriticalSection();
+        LED_States[Copy_LedId].pPattern = NULL;
+        LED_ApplyLevel(&LED_States[Copy_LedId], Copy_Percent);
+        SCB_ExitCriticalSection(Local_PrimaskState);
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_LED_StopPattern(u8 Copy_LedId)
+{
+    return HAL_LED_SetBrightness(Copy_LedId, 0);
+}
+
+/**
+ * @} // End of Public_Functions
+ */
+
+/**
+ * @defgroup Private_Functions LED Effects Engine
+ * @{
+ */
+
+static u8 LED_FindLed(u8 Copy_Port, u8 Copy_Pin)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < LED_Count; Local_Index++)
+    {
+        if ((LED_States[Local_Index].Port == Copy_Port) && (LED_States[Local_Index].Pin == Copy_Pin))
+        {
+            return Local_Index;
+        }
+    }
+
+    return LED_NOT_REGISTERED;
+}
+
+static u8 LED_FindPwmPin(u8 Copy_Port, u8 Copy_Pin)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < LED_PWM_PINS_COUNT; Local_Index++)
+    {
+        if ((LED_PwmPins[Local_Index].Port == Copy_Port) && (LED_PwmPins[Local_Index].Pin == Copy_Pin) &&
+            ((LED_PWM_TIMERS & (1U << LED_PwmPins[Local_Index].Timer)) != 0))
+        {
+            return Local_Index;
+        }
+    }
+
+    return LED_NO_PWM;
+}
+
+static Std_ReturnType LED_StartPwm(u8 Copy_PwmIndex)
 {
-    if(HAL_LED_BlinkOnce(Copy_LedPortId, Copy_LedPinId, Copy_BlinkTime) == E_NOT_OK)
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    const LED_PwmPin_t *Local_pPwm = &LED_PwmPins[Copy_PwmIndex];
+
+    /**< Each timer's time base is set up once; the LED starts dark */
+    if (GET_BIT(LED_PwmTimersStarted, Local_pPwm->Timer) == 0)
+    {
+        Local_FunctionStatus &= MCAL_TIM_InitTimebase(Local_pPwm->Timer, LED_PWM_FREQUENCY_HZ * LED_PWM_STEPS, LED_PWM_STEPS - 1);
+        Local_FunctionStatus &= MCAL_TIM_Start(Local_pPwm->Timer);
+        if (Local_FunctionStatus == E_OK)
+        {
+            SET_BIT(LED_PwmTimersStarted, Local_pPwm->Timer);
+        }
+    }
+
+    Local_FunctionStatus &= MCAL_TIM_InitPWM(Local_pPwm->Timer, Local_pPwm->Channel, TIM_PWM_ACTIVE_HIGH, 0);
+
+    return Local_FunctionStatus;
+}
+
+static Std_ReturnType LED_Run(u8 Copy_LedId, LED_Pattern_t Copy_Pattern, u8 Copy_Count, u16 Copy_Divider)
+{
+    LED_State_t *Local_pState;
+    u32 Local_PrimaskState;
+
+    if ((Copy_LedId >= LED_Count) || (Copy_Pattern >= LED_PATTERNS_COUNT))
     {
         return E_NOT_OK;
     }
 
-    MCAL_STK_SetDelay_ms(Copy_BlinkTime);
+    Local_pState = &LED_States[Copy_LedId];
 
-    HAL_LED_BlinkOnce(Copy_LedPortId, Copy_LedPinId, Copy_BlinkTime);
+    /**< LED_Tick runs in interrupt context: the engine must never see a half-written state */
+    Local_PrimaskState = SCB_EnterCriticalSection();
+    Local_pState->Divider = Copy_Divider;
+    Local_pState->DividerCount = 1;
+    Local_pState->NextStep = 0;
+    Local_pState->TicksLeft = 0;
+    Local_pState->PassesLeft = 0;
+    Local_pState->Count = Copy_Count;
+    Local_pState->pPattern = &LED_Patterns[Copy_Pattern];
+    SCB_ExitCriticalSection(Local_PrimaskState);
 
     return E_OK;
 }
 
+static void LED_ApplyLevel(LED_State_t *Copy_pState, u8 Copy_Level)
+{
+    const LED_PwmPin_t *Local_pPwm;
+
+    if (Copy_pState->PwmIndex != LED_NO_PWM)
+    {
+        /**< The compare value is the brightness; a compare of LED_PWM_STEPS keeps the output high */
+        Local_pPwm = &LED_PwmPins[Copy_pState->PwmIndex];
+        MCAL_TIM_SetCompare(Local_pPwm->Timer, Local_pPwm->Channel, Copy_Level);
+    }
+    else if ((Copy_Level >= LED_GPIO_ON_LEVEL) != (Copy_pState->Level >= LED_GPIO_ON_LEVEL))
+    {
+        MCAL_GPIO_SetPinValue(Copy_pState->Port, Copy_pState->Pin, (Copy_Level >= LED_GPIO_ON_LEVEL) ? GPIO_HIGH : GPIO_LOW);
+    }
+
+    Copy_pState->Level = Copy_Level;
+}
+
+static u8 LED_LoadNextStep(LED_State_t *Copy_pState)
+{
+    const LED_PatternDef_t *Local_pPattern = Copy_pState->pPattern;
+    const LED_Step_t *Local_pStep;
+    u8 Local_Next = Copy_pState->NextStep;
+    u16 Local_Guard;
+
+    /**< Bounded walk: a pattern made only of repeat markers cannot hang the engine */
+    for (Local_Guard = 0; Local_Guard < (2U * Local_pPattern->StepsCount); Local_Guard++)
+    {
+        if (Local_Next >= Local_pPattern->StepsCount)
+        {
+            if (Local_pPattern->Loop == 0)
+            {
+                break;
+            }
+            Local_Next = 0;
+        }
+
+        Local_pStep = &Local_pPattern->pSteps[Local_Next];
+
+        if (Local_pStep->Ticks != 0)
+        {
+            Copy_pState->StepIndex = Local_Next;
+            Copy_pState->NextStep = Local_Next + 1;
+            Copy_pState->TicksLeft = Local_pStep->Ticks;
+            Copy_pState->StartLevel = Copy_pState->Level;
+            return 1;
+        }
+
+        /**< Repeat marker: the first arrival loads the pass count, later ones count it down */
+        if (Copy_pState->PassesLeft == 0)
+        {
+            Copy_pState->PassesLeft = ((Local_pStep->Level & LED_STEP_LEVEL_MASK) != 0) ? (Local_pStep->Level & LED_STEP_LEVEL_MASK) : Copy_pState->Count;
+        }
+
+        if ((Copy_pState->PassesLeft != 0) && (--Copy_pState->PassesLeft != 0))
+        {
+            Local_Next = 0;
+        }
+        else
+        {
+            Local_Next++;
+        }
+    }
+
+    return 0;
+}
+
+static void LED_Tick(void *Copy_pvContext)
+{
+    LED_State_t *Local_pState;
+    const LED_Step_t *Local_pStep;
+    u8 Local_LedsCount = LED_Count;
+    u8 Local_Id;
+    u8 Local_Level;
+    u8 Local_Elapsed;
+
+    (void)Copy_pvContext;
+
+    for (Local_Id = 0; Local_Id < Local_LedsCount; Local_Id++)
+    {
+        Local_pState = &LED_States[Local_Id];
+
+        if (Local_pState->pPattern == NULL)
+        {
+            continue;
+        }
+
+        /**< Slowed-down patterns advance once every Divider engine ticks */
+        if (--Local_pState->DividerCount != 0)
+        {
+            continue;
+        }
+        Local_pState->DividerCount = Local_pState->Divider;
+
+        if ((Local_pState->TicksLeft == 0) && (LED_LoadNextStep(Local_pState) == 0))
+        {
+            /**< One-shot pattern finished */
+            Local_pState->pPattern = NULL;
+            LED_ApplyLevel(Local_pState, 0);
+            continue;
+        }
+
+        Local_pStep = &Local_pState->pPattern->pSteps[Local_pState->StepIndex];
+        Local_Level = Local_pStep->Level & LED_STEP_LEVEL_MASK;
+
+        if ((Local_pStep->Level & LED_STEP_RAMP) != 0)
+        {
+            /**< Linear ramp from the step's start level, reaching the target on its last tick */
+            Local_Elapsed = (u8)(Local_pStep->Ticks - Local_pState->TicksLeft + 1);
+            Local_Level = (u8)((s16)Local_pState->StartLevel +
+                               (((s16)Local_Level - (s16)Local_pState->StartLevel) * Local_Elapsed) / Local_pStep->Ticks);
+        }
+
+        if (Local_Level != Local_pState->Level)
+        {
+            LED_ApplyLevel(Local_pState, Local_Level);
+        }
+
+        Local_pState->TicksLeft--;
+    }
+}
+
 /**
- * @} // End of Public_Functions
+ * @} // End of Private_Functions
  */
@@ -11,7 +11,35 @@
  *                     Configuration Section                    *
  ****************************************************************/
 
+/**
+ * @brief Maximum Number of LEDs Driven by the Effects Engine
+ */
+#define LED_MAX_LEDS                4
+
+/**
+ * @brief Effects Engine Tick in Milliseconds
+ *
+ * One software timer advances the pattern of every registered LED each tick. Pattern step
+ * durations are rounded to whole ticks and a single step lasts at most 255 ticks.
+ */
+#define LED_EFFECT_TICK_MS          10
 
+/**
+ * @brief Timers the Effects Engine May Use for Hardware PWM
+ *
+ * Bit mask of (1 << TIM_2), (1 << TIM_3) and (1 << TIM_4). A registered LED on a channel pin of
+ * an allowed timer is dimmed by that timer's PWM output; any other pin is switched on and off.
+ * TIM3 is left out by default because the seven-segment driver uses it for multiplexing.
+ */
+#define LED_PWM_TIMERS              ((1U << TIM_2) | (1U << TIM_4))
+
+/**
+ * @brief Hardware PWM Frequency in Hz
+ *
+ * The PWM timers count LED_PWM_STEPS steps per period, so the timer clock must be a multiple of
+ * LED_PWM_FREQUENCY_HZ x LED_PWM_STEPS; otherwise setting a brightness fails.
+ */
+#define LED_PWM_FREQUENCY_HZ        1000UL
 
 /****************************************************************
  *                 End of Configuration Section                 *
@@ -68,6 +96,22 @@ typedef enum {
  */
 typedef u32 LED_Delay_ms_t;
 
+/**
+ * @brief LED Pattern Enumeration
+ *
+ * Patterns run by the effects engine. Looping patterns run until HAL_LED_StopPattern or
+ * HAL_LED_SetBrightness; one-shot patterns switch the LED off when they end.
+ */
+typedef enum {
+    LED_PATTERN_BLINK_SLOW, /**< 500 ms on, 500 ms off */
+    LED_PATTERN_BLINK_FAST, /**< 100 ms on, 100 ms off */
+    LED_PATTERN_HEARTBEAT,  /**< Two short beats followed by a pause */
+    LED_PATTERN_BREATHING,  /**< Brightness ramps up and down over three seconds (needs a PWM pin) */
+    LED_PATTERN_BLINK_CODE, /**< Blink code: N short flashes followed by a long pause, see HAL_LED_SetBlinkCode */
+    LED_PATTERN_BLINK_N,    /**< One-shot: N flashes, see HAL_LED_BlinkOnce and HAL_LED_BlinkTwice */
+    LED_PATTERNS_COUNT      /**< Number of patterns */
+} LED_Pattern_t;
+
 /**
  * @} (LED_Parameters)
  */
@@ -92,7 +136,8 @@ Std_ReturnType HAL_LED_Init(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId);
 /**
  * @brief Turn On an LED
  *
- * Turns on the specified LED.
+ * Turns on the specified LED. An LED registered with the effects engine (see HAL_LED_Register)
+ * stops its pattern and goes to full brightness.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -103,7 +148,8 @@ Std_ReturnType HAL_LED_On(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId);
 /**
  * @brief Turn Off an LED
  *
- * Turns off the specified LED.
+ * Turns off the specified LED. An LED registered with the effects engine stops its pattern and
+ * goes dark.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -114,7 +160,8 @@ Std_ReturnType HAL_LED_Off(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId);
 /**
  * @brief Toggle an LED
  *
- * Toggles the state of the specified LED.
+ * Toggles the state of the specified LED. An LED registered with the effects engine stops its
+ * pattern and goes to full brightness if it was lit at any level, dark otherwise.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
@@ -125,11 +172,13 @@ Std_ReturnType HAL_LED_Toggle(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId
 /**
  * @brief Blink an LED Once
  *
- * Blinks the specified LED once with a specified delay.
+ * Starts one flash of the specified LED: on for Copy_BlinkTime, then off. The function returns
+ * at once; the effects engine completes the flash. The LED is registered on first use and keeps
+ * its LED_MAX_LEDS slot afterwards.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
- * @param[in] Copy_BlinkTime The delay in milliseconds for each blink.
+ * @param[in] Copy_BlinkTime The on time and the off time of the flash in milliseconds.
  * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurs.
  */
 Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime);
@@ -137,15 +186,75 @@ Std_ReturnType HAL_LED_BlinkOnce(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPi
 /**
  * @brief Blink an LED Twice
  *
- * Blinks the specified LED twice with a specified delay between blinks.
+ * Starts two flashes of the specified LED with Copy_BlinkTime on and Copy_BlinkTime off each.
+ * The function returns at once; the effects engine completes the flashes. The LED is registered
+ * on first use and keeps its LED_MAX_LEDS slot afterwards.
  *
  * @param[in] Copy_LedPortId The ID of the LED port.
  * @param[in] Copy_LedPinId The ID of the LED pin.
- * @param[in] Copy_BlinkTime The delay in milliseconds for each blink.
+ * @param[in] Copy_BlinkTime The on time and the off time of each flash in milliseconds.
  * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurs.
  */
 Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, LED_Delay_ms_t Copy_BlinkTime);
 
+/**
+ * @brief Register an LED with the Effects Engine
+ *
+ * Configures the LED pin and adds it to the LEDs driven by the effects engine; the first
+ * registration also starts the engine's software timer. When the pin is a channel of a timer
+ * allowed by LED_PWM_TIMERS, the pin is switched to alternate function and the LED is dimmed by
+ * hardware PWM, otherwise it is a plain output switched on at 50 % brightness and above.
+ * Registering an already registered LED returns its existing identifier.
+ *
+ * @param[in] Copy_LedPortId The ID of the LED port.
+ * @param[in] Copy_LedPinId The ID of the LED pin.
+ * @param[out] Copy_pLedId Receives the identifier used by the other effects functions.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if the pin is invalid,
+ *         LED_MAX_LEDS LEDs are registered or the timer could not be started.
+ *
+ * @note The SWTMR service must be initialized first. The clocks of the GPIO port, of AFIO and of
+ *       the PWM timers must be enabled by the application. HAL_LED_On, HAL_LED_Off and
+ *       HAL_LED_Toggle keep working on a registered LED: they set its brightness through the engine.
+ */
+Std_ReturnType HAL_LED_Register(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedPinId, u8 *Copy_pLedId);
+
+/**
+ * @brief Start a Pattern on a Registered LED
+ *
+ * @param[in] Copy_LedId The identifier returned by HAL_LED_Register.
+ * @param[in] Copy_Pattern The pattern to run (LED_PATTERN_BLINK_SLOW .. LED_PATTERN_BREATHING).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an argument is invalid.
+ */
+Std_ReturnType HAL_LED_StartPattern(u8 Copy_LedId, LED_Pattern_t Copy_Pattern);
+
+/**
+ * @brief Start a Blink Code on a Registered LED
+ *
+ * Repeats Copy_Count short flashes followed by a long pause until the pattern is stopped.
+ *
+ * @param[in] Copy_LedId The identifier returned by HAL_LED_Register.
+ * @param[in] Copy_Count The number of flashes (1 .. 255).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an argument is invalid.
+ */
+Std_ReturnType HAL_LED_SetBlinkCode(u8 Copy_LedId, u8 Copy_Count);
+
+/**
+ * @brief Stop the Pattern of a Registered LED and Set a Fixed Brightness
+ *
+ * @param[in] Copy_LedId The identifier returned by HAL_LED_Register.
+ * @param[in] Copy_Percent The brightness in percent (0 .. 100).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an argument is invalid.
+ */
+Std_ReturnType HAL_LED_SetBrightness(u8 Copy_LedId, u8 Copy_Percent);
+
+/**
+ * @brief Stop the Pattern of a Registered LED and Switch It Off
+ *
+ * @param[in] Copy_LedId The identifier returned by HAL_LED_Register.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if the identifier is invalid.
+ */
+Std_ReturnType HAL_LED_StopPattern(u8 Copy_LedId);
+
 /**
  * @} (end of LED_Functions)
  */
@@ -158,8 +267,37 @@ Std_ReturnType HAL_LED_BlinkTwice(LED_Port_t Copy_LedPortId, LED_Pin_t Copy_LedP
  *                     Private Section                          *
  ****************************************************************/
 
+/**< Brightness steps per PWM period: the compare value is the brightness in percent */
+#define LED_PWM_STEPS               100U
+
+/**< Level at and above which an LED without PWM is switched on */
+#define LED_GPIO_ON_LEVEL           50U
+
+/**
+ * Pattern step: hold (or ramp linearly to) a brightness level for a number of engine ticks.
+ * A step of zero ticks is a repeat marker: the steps before it run Level times in total, or
+ * the LED's blink count times when Level is zero (Level is at most 127).
+ */
+typedef struct {
+    u8 Level;       /**< Brightness in percent (LED_STEP_LEVEL_MASK), OR-ed with LED_STEP_RAMP */
+    u8 Ticks;       /**< Duration in engine ticks, 0 for a repeat marker */
+} LED_Step_t;
+
+#define LED_STEP_LEVEL_MASK         0x7FU   /**< Brightness bits of LED_Step_t.Level */
+#define LED_STEP_RAMP               0x80U   /**< Ramp from the previous level instead of jumping */
 
+/**< Pattern: a run of steps, looping or one-shot */
+typedef struct {
+    const LED_Step_t *pSteps;
+    u8 StepsCount;
+    u8 Loop;
+} LED_PatternDef_t;
 
+/**< Pattern step builders; durations are given in milliseconds */
+#define LED_MS_TO_TICKS(MS)         (((MS) + LED_EFFECT_TICK_MS - 1) / LED_EFFECT_TICK_MS)
+#define LED_HOLD(LEVEL, MS)         {(LEVEL), LED_MS_TO_TICKS(MS)}
+#define LED_RAMP(LEVEL, MS)         {(LEVEL) | LED_STEP_RAMP, LED_MS_TO_TICKS(MS)}
+#define LED_REPEAT(TIMES)           {(TIMES), 0}
 
 /****************************************************************
  *                 End of Private Section                       *
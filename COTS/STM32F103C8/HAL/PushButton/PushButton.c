@@ -6,120 +6,306 @@
 /****************************************************************/
 
 /*****************************< LIB *****************************/
-#include <stdbool.h>
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
 #include "GPIO_interface.h"
-#include "STK_interface.h"
+/*****************************< SERVICES *****************************/
+#include "SWTMR_interface.h"
 /*****************************< HAL *****************************/
 #include "PushButton.h"
+/*****************************< Private Section *****************************/
+#if (PB_MAX_BUTTONS < 1) || (PB_MAX_BUTTONS > 32)
+#error "PB_MAX_BUTTONS must be between 1 and 32"
+#endif
+
+#if (PB_EVENT_QUEUE_SIZE & (PB_EVENT_QUEUE_SIZE - 1)) != 0
+#error "PB_EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+#define PB_EVENT_QUEUE_MASK     (PB_EVENT_QUEUE_SIZE - 1)
+#define PB_PORTS_COUNT          3
+
+/**< Timing limits in samples */
+#define PB_LONG_PRESS_SAMPLES   (PB_LONG_PRESS_MS / PB_SAMPLE_PERIOD_MS)
+#define PB_DOUBLE_CLICK_SAMPLES (PB_DOUBLE_CLICK_MS / PB_SAMPLE_PERIOD_MS)
+
+/**< Registered buttons */
+static u8 PB_ButtonPort[PB_MAX_BUTTONS];
+static u8 PB_ButtonPin[PB_MAX_BUTTONS];
+static volatile u8 PB_ButtonsCount = 0;
+
+/**< Ports holding at least one button, and the pins of each port that are active low */
+static u8 PB_PortsUsed = 0;
+static u16 PB_PortActiveLow[PB_PORTS_COUNT];
+
+/**
+ * Vertical counter: bit n of PB_Count1:PB_Count0 is a 2-bit counter for button n. Each button
+ * whose sample differs from its debounced state counts, and flips its state on the fourth
+ * consecutive differing sample; a matching sample resets the counter.
+ */
+static u32 PB_State = 0;                    /**< Debounced states (bit set = pressed) */
+static u32 PB_Count0 = 0xFFFFFFFFUL;
+static u32 PB_Count1 = 0xFFFFFFFFUL;
+
+/**< Gesture tracking */
+static u32 PB_ClickPending = 0;             /**< Released after a short click, waiting for a second press */
+static u32 PB_LongPressed = 0;              /**< Long press already reported for the current press */
+static u32 PB_SecondClick = 0;              /**< The current press completed a double click */
+static u16 PB_Samples[PB_MAX_BUTTONS];      /**< Samples since the last press (held) or release (click pending) */
+
+/**< Sampling timer */
+static SWTMR_Timer_t PB_SampleTimer;
+
+/**< Event queue: head and tail are free-running counters masked with PB_EVENT_QUEUE_MASK */
+static PushButton_Event_t PB_EventQueue[PB_EVENT_QUEUE_SIZE];
+static volatile u8 PB_EventHead = 0;
+static volatile u8 PB_EventTail = 0;
+
+static void PB_SampleButtons(void *Copy_pvContext);
+static void PB_UpdateGestures(u8 Copy_ButtonId, u32 Copy_Toggled);
+static void PB_PushEvent(u8 Copy_ButtonId, u8 Copy_Type);
 /*****************************< Function Implementations *****************************/
 /**
- * @defgroup Public_Functions LED Driver
+ * @defgroup Public_Functions Push Button Driver
  * @{
  */
 
 Std_ReturnType HAL_PushButton_Init(PushButton_Port_t Copy_ButtonPortId, LED_Pin_t Copy_ButtonPinId, PushButton_State_t Copy_ActiveLevel)
 {
-    if (Copy_ActiveLevel != ACTIVE_HIGH && Copy_ActiveLevel != ACTIVE_LOW) 
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    /**< Input with pull-up or pull-down: the ODR bit selects which one */
+    if (Copy_ActiveLevel == ACTIVE_LOW)
     {
-        return E_NOT_OK; /**< Invalid pull-up/down configuration */
+        if (MCAL_GPIO_SetPinMode(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_INPUT_PULL_UP) == E_OK)
+        {
+            Local_FunctionStatus = MCAL_GPIO_SetPinValue(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_HIGH);
+        }
+    }
+    else if (Copy_ActiveLevel == ACTIVE_HIGH)
+    {
+        if (MCAL_GPIO_SetPinMode(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_INPUT_PULL_DOWN) == E_OK)
+        {
+            Local_FunctionStatus = MCAL_GPIO_SetPinValue(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_LOW);
+        }
     }
     else
     {
-        /**< Initialize Push Button to be input with pull-up or pull-down */
-        #if(Copy_ActiveLevel == ACTIVE_LOW)
-            Copy_ActiveLevel = GPIO_INPUT_PULL_UP;
-            if(MCAL_GPIO_SetPinMode(Copy_ButtonPortId, Copy_ButtonPinId, Copy_ActiveLevel) == E_NOT_OK)
-            {
-                return E_NOT_OK; /**< GPIO initialization failed */
-            }
+        Local_FunctionStatus = E_NOT_OK; /**< Invalid pull-up/down configuration */
+    }
 
-            MCAL_GPIO_SetPinValue(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_HIGH);
+    return Local_FunctionStatus;
+}
 
-            return E_OK;
+Std_ReturnType HAL_PushButton_Register(PushButton_Port_t Copy_ButtonPortId, LED_Pin_t Copy_ButtonPinId,
+                                       PushButton_State_t Copy_ActiveLevel, u8 *Copy_pButtonId)
+{
+    u8 Local_Id = PB_ButtonsCount;
+    u8 Local_Index;
 
-        #elif(Copy_ActiveLevel == ACTIVE_HIGH)
-            Copy_ActiveLevel = GPIO_INPUT_PULL_DOWN;
-            if(MCAL_GPIO_SetPinMode(Copy_ButtonPortId, Copy_ButtonPinId, Copy_ActiveLevel) == E_NOT_OK)
-            {
-                return E_NOT_OK; /**< GPIO initialization failed */
-            }
+    if ((Copy_pButtonId == NULL) || (Local_Id >= PB_MAX_BUTTONS) || (Copy_ButtonPortId >= PB_PORTS_COUNT))
+    {
+        return E_NOT_OK;
+    }
 
-            MCAL_GPIO_SetPinValue(Copy_ButtonPortId, Copy_ButtonPinId, GPIO_LOW);
+    for (Local_Index = 0; Local_Index < Local_Id; Local_Index++)
+    {
+        if ((PB_ButtonPort[Local_Index] == Copy_ButtonPortId) && (PB_ButtonPin[Local_Index] == Copy_ButtonPinId))
+        {
+            return E_NOT_OK; /**< Already registered */
+        }
+    }
 
-            return E_OK;
+    if (HAL_PushButton_Init(Copy_ButtonPortId, Copy_ButtonPinId, Copy_ActiveLevel) != E_OK)
+    {
+        return E_NOT_OK;
+    }
 
-        #else
-            #error "Unexpected condition in HAL_PushButton_Init"            
-        #endif
+    PB_ButtonPort[Local_Id] = Copy_ButtonPortId;
+    PB_ButtonPin[Local_Id] = Copy_ButtonPinId;
+    PB_Samples[Local_Id] = 0;
+    if (Copy_ActiveLevel == ACTIVE_LOW)
+    {
+        SET_BIT(PB_PortActiveLow[Copy_ButtonPortId], Copy_ButtonPinId);
     }
+    SET_BIT(PB_PortsUsed, Copy_ButtonPortId);
+
+    /**< Publish the button last: the sampler only looks at the first PB_ButtonsCount entries */
+    PB_ButtonsCount = Local_Id + 1;
+
+    *Copy_pButtonId = Local_Id;
+
+    return E_OK;
+}
+
+Std_ReturnType HAL_PushButton_StartDebouncer(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (SWTMR_Create(&PB_SampleTimer, PB_SampleButtons, NULL) == E_OK)
+    {
+        Local_FunctionStatus = SWTMR_StartPeriodic(&PB_SampleTimer, SWTMR_MsToTicks(PB_SAMPLE_PERIOD_MS));
+    }
+
+    return Local_FunctionStatus;
 }
 
-Std_ReturnType HAL_PushButton_Read(u8 Copy_ButtonPortId, u8 Copy_ButtonPinId, u8 *Copy_ButtonState, u32 numIterations)
+Std_ReturnType HAL_PushButton_GetEvent(PushButton_Event_t *Copy_pEvent)
 {
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_Tail = PB_EventTail;
+
+    if ((Copy_pEvent != NULL) && (Local_Tail != PB_EventHead))
+    {
+        *Copy_pEvent = PB_EventQueue[Local_Tail & PB_EVENT_QUEUE_MASK];
+        PB_EventTail = (u8)(Local_Tail + 1);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_PushButton_Read(u8 Copy_ButtonPortId, u8 Copy_ButtonPinId, u8 *Copy_ButtonState)
+{
+    u8 Local_Count = PB_ButtonsCount;
+    u8 Local_Index;
+
     if (Copy_ButtonState == NULL)
     {
         return E_NOT_OK; /**< Invalid pointer */
     }
 
-    /**< Start the SysTick timer */
-    MCAL_STK_Init(SYSTICK_RELOAD_VALUE); /**< Initialize SysTick with a suitable reload value. */ 
-    MCAL_STK_Start();
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        if ((PB_ButtonPort[Local_Index] == Copy_ButtonPortId) && (PB_ButtonPin[Local_Index] == Copy_ButtonPinId))
+        {
+            *Copy_ButtonState = (u8)((PB_State >> Local_Index) & 1UL);
+            return E_OK;
+        }
+    }
 
-    /**< Variables to store button state */
-    bool currentButtonState;
-    bool lastButtonState;
+    return E_NOT_OK; /**< Not registered */
+}
 
-    /**< Variables to track time for debounce */
-    static u32 lastDebounceTime = 0;
+/**
+ * @} (End of Public_Functions) 
+ */
+
+/**
+ * @defgroup Private_Functions Push Button Driver Internals
+ * @{
+ */
+
+static void PB_SampleButtons(void *Copy_pvContext)
+{
+    u16 Local_PortValue[PB_PORTS_COUNT] = {0, 0, 0};
+    u8 Local_Count = PB_ButtonsCount;
+    u32 Local_Raw = 0;
+    u32 Local_Delta;
+    u32 Local_Toggled;
+    u32 Local_Busy;
+    u8 Local_Index;
 
-    u32 stableCount = 0; /**< Count of stable readings */ 
+    (void)Copy_pvContext;
 
-    /**< Repeat the reading and debouncing for the specified number of iterations */ 
-    for (u32 i = 0; i < numIterations; i++)
+    /**< One IDR read per port; flip active-low pins so that 1 always means pressed */
+    for (Local_Index = 0; Local_Index < PB_PORTS_COUNT; Local_Index++)
     {
-        /**< Read the current button state */
-        if (MCAL_GPIO_GetPinValue(Copy_ButtonPortId, Copy_ButtonPinId, &currentButtonState) != E_OK)
+        if (GET_BIT(PB_PortsUsed, Local_Index) != 0)
         {
-            return E_NOT_OK; /**< Error reading button state */
+            MCAL_GPIO_GetPortValue(Local_Index, &Local_PortValue[Local_Index]);
+            Local_PortValue[Local_Index] ^= PB_PortActiveLow[Local_Index];
         }
+    }
 
-        u32 currentMillis = MCAL_STK_GetElapsedCounts(); // Get the current time in milliseconds
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        Local_Raw |= (u32)((Local_PortValue[PB_ButtonPort[Local_Index]] >> PB_ButtonPin[Local_Index]) & 1U) << Local_Index;
+    }
 
-        /**< Check if the button state has changed and is stable for the debounce delay */ 
-        if (currentButtonState != lastButtonState)
-        {
-            /**< Update the last button state */
-            lastButtonState = currentButtonState;
+    /**< Debounce all buttons at once */
+    Local_Delta = Local_Raw ^ PB_State;
+    PB_Count0 = ~(PB_Count0 & Local_Delta);
+    PB_Count1 = PB_Count0 ^ (PB_Count1 & Local_Delta);
+    Local_Toggled = Local_Delta & PB_Count0 & PB_Count1;
+    PB_State ^= Local_Toggled;
 
-            /**< Update the last debounce time */
-            lastDebounceTime = currentMillis;
+    /**< Only buttons that changed, are held, or wait for a second click need timing */
+    Local_Busy = Local_Toggled | PB_State | PB_ClickPending;
+    for (Local_Index = 0; Local_Busy != 0; Local_Index++, Local_Busy >>= 1)
+    {
+        if ((Local_Busy & 1UL) != 0)
+        {
+            PB_UpdateGestures(Local_Index, Local_Toggled);
         }
+    }
+}
 
-        /**< Check if the button state has been stable for the debounce delay */
-        if ((currentMillis - lastDebounceTime) >= DEBOUNCE_DELAY_MS)
+static void PB_UpdateGestures(u8 Copy_ButtonId, u32 Copy_Toggled)
+{
+    u32 Local_Bit = 1UL << Copy_ButtonId;
+
+    if ((Copy_Toggled & Local_Bit) != 0)
+    {
+        if ((PB_State & Local_Bit) != 0)
         {
-            /**< Increment the stable count */
-            stableCount++;
+            PB_PushEvent(Copy_ButtonId, PB_EVENT_PRESSED);
 
-            /**< If the button state has been stable for a sufficient number of times, consider it stable */ 
-            if (stableCount >= (numIterations-2))
+            if ((PB_ClickPending & Local_Bit) != 0)
             {
-                /**< Assign the debounced button state to the output parameter */
-                *Copy_ButtonState = currentButtonState;
-                return E_OK;
+                PB_ClickPending &= ~Local_Bit;
+                PB_SecondClick |= Local_Bit;
+                PB_PushEvent(Copy_ButtonId, PB_EVENT_DOUBLE_CLICK);
             }
+            PB_Samples[Copy_ButtonId] = 0;
         }
+        else
+        {
+            PB_PushEvent(Copy_ButtonId, PB_EVENT_RELEASED);
 
-        /**< Button state is not stable yet, return the previous state */
-        *Copy_ButtonState = lastButtonState;
+            /**< Only a short first click can start a double click */
+            if (((PB_LongPressed | PB_SecondClick) & Local_Bit) == 0)
+            {
+                PB_ClickPending |= Local_Bit;
+                PB_Samples[Copy_ButtonId] = 0;
+            }
+            PB_LongPressed &= ~Local_Bit;
+            PB_SecondClick &= ~Local_Bit;
+        }
     }
+    else if ((PB_State & Local_Bit) != 0)
+    {
+        if (PB_Samples[Copy_ButtonId] < PB_LONG_PRESS_SAMPLES)
+        {
+            if (++PB_Samples[Copy_ButtonId] == PB_LONG_PRESS_SAMPLES)
+            {
+                PB_LongPressed |= Local_Bit;
+                PB_PushEvent(Copy_ButtonId, PB_EVENT_LONG_PRESS);
+            }
+        }
+    }
+    else if (++PB_Samples[Copy_ButtonId] >= PB_DOUBLE_CLICK_SAMPLES)
+    {
+        /**< Double-click window elapsed */
+        PB_ClickPending &= ~Local_Bit;
+    }
+}
 
-    return E_NOT_OK; /**< Button state not stable after the specified number of iterations */
+static void PB_PushEvent(u8 Copy_ButtonId, u8 Copy_Type)
+{
+    u8 Local_Head = PB_EventHead;
+
+    /**< Drop the event when the queue is full */
+    if ((u8)(Local_Head - PB_EventTail) < PB_EVENT_QUEUE_SIZE)
+    {
+        PB_EventQueue[Local_Head & PB_EVENT_QUEUE_MASK].ButtonId = Copy_ButtonId;
+        PB_EventQueue[Local_Head & PB_EVENT_QUEUE_MASK].Type = Copy_Type;
+        PB_EventHead = (u8)(Local_Head + 1);
+    }
 }
 
 /**
- * @} (End of Public_Functions) 
- */
\ No newline at end of file
+ * @} (End of Private_Functions)
+ */
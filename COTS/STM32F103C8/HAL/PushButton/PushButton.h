@@ -17,24 +17,51 @@
  */
 
 /**
- * @brief Debounce Delay in Milliseconds
+ * @brief Sampling Period in Milliseconds
  *
- * This constant defines the debounce delay in milliseconds. It is used to ensure
- * that button state changes are stable for a certain period before being considered valid.
- * Adjust the value as needed depending on your specific application and hardware characteristics.
+ * All registered buttons are sampled together every PB_SAMPLE_PERIOD_MS by a software timer.
+ * A change is accepted after four consecutive equal samples, so the debounce time is
+ * 4 x PB_SAMPLE_PERIOD_MS.
  */
-#define DEBOUNCE_DELAY_MS 2 /**< Define a debounce delay in milliseconds (adjust as needed) */
+#define PB_SAMPLE_PERIOD_MS     5
 
 /**
- * @brief SysTick Reload Value
- *
- * This constant defines the maximum value that can be loaded into the SysTick timer.
- * When initializing the SysTick timer, this value is used to set the timer's initial
- * count and determines the duration of the timer before it overflows.
- * In this case, it's set to the maximum 24-bit value (0x00FFFFFF), resulting in a timer
- * that counts down from this value to 0 before overflowing.
+ * @brief Hold Time for a Long Press in Milliseconds
+ */
+#define PB_LONG_PRESS_MS        1000
+
+/**
+ * @brief Maximum Time Between a Release and the Next Press for a Double Click in Milliseconds
+ */
+#define PB_DOUBLE_CLICK_MS      300
+
+/**
+ * @brief Maximum Number of Registered Buttons (at most 32, one bit each in the debouncer)
+ */
+#define PB_MAX_BUTTONS          32
+
+/**
+ * @brief Number of Button Events the Queue Can Hold (must be a power of two)
  */
-#define SYSTICK_RELOAD_VALUE    0x00FFFFFF /**< Define a systick reload value (adjust as needed) */
+#define PB_EVENT_QUEUE_SIZE     16
+
+/**
+ * @brief Push Button Event Types
+ */
+typedef enum {
+    PB_EVENT_PRESSED,       /**< The button went down (debounced) */
+    PB_EVENT_RELEASED,      /**< The button went up (debounced) */
+    PB_EVENT_LONG_PRESS,    /**< The button has been held for PB_LONG_PRESS_MS */
+    PB_EVENT_DOUBLE_CLICK   /**< The button was pressed again within PB_DOUBLE_CLICK_MS of a short click */
+} PushButton_EventType_t;
+
+/**
+ * @brief Push Button Event
+ */
+typedef struct {
+    u8 ButtonId;    /**< Identifier returned by HAL_PushButton_Register */
+    u8 Type;        /**< One of PushButton_EventType_t */
+} PushButton_Event_t;
 
 /**
  * @brief Push Button Enumeration
@@ -93,12 +120,50 @@ typedef enum {
  * @param[in] Copy_ActiveLevel The active level of the push button (ACTIVE_HIGH or ACTIVE_LOW).
  * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
  */
-Std_ReturnType HAL_PushButton_Init(PushButton_Port_t Copy_ButtonPortId, LED_Pin_t Copy_ButtonPinId, PushButton_State_t ActiveLevel);
+Std_ReturnType HAL_PushButton_Init(PushButton_Port_t Copy_ButtonPortId, LED_Pin_t Copy_ButtonPinId, PushButton_State_t Copy_ActiveLevel);
+
+/**
+ * @brief Registers a Push Button with the debouncer.
+ *
+ * This function initializes the button pin (see HAL_PushButton_Init) and adds the button to the
+ * set sampled by the debouncer. Buttons may be registered before or after the debouncer starts.
+ *
+ * @param[in] Copy_ButtonPortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param[in] Copy_ButtonPinId The ID of the GPIO pin (e.g., GPIO_PIN0, GPIO_PIN1, etc.).
+ * @param[in] Copy_ActiveLevel The active level of the push button (ACTIVE_HIGH or ACTIVE_LOW).
+ * @param[out] Copy_pButtonId Receives the identifier reported in the button's events.
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if the pin is invalid,
+ *         already registered, or PB_MAX_BUTTONS buttons are registered.
+ */
+Std_ReturnType HAL_PushButton_Register(PushButton_Port_t Copy_ButtonPortId, LED_Pin_t Copy_ButtonPinId,
+                                       PushButton_State_t Copy_ActiveLevel, u8 *Copy_pButtonId);
+
+/**
+ * @brief Starts the debouncer.
+ *
+ * This function starts a periodic software timer that samples every registered button with one
+ * input data register read per port, debounces all of them at once with a vertical counter, and
+ * queues press, release, long-press and double-click events.
+ *
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
+ *
+ * @note The SWTMR service must be initialized first.
+ */
+Std_ReturnType HAL_PushButton_StartDebouncer(void);
+
+/**
+ * @brief Takes the oldest button event from the event queue.
+ *
+ * @param[out] Copy_pEvent Receives the event.
+ * @return Std_ReturnType Returns E_OK if an event was copied, or E_NOT_OK if the queue is empty or Copy_pEvent is NULL.
+ */
+Std_ReturnType HAL_PushButton_GetEvent(PushButton_Event_t *Copy_pEvent);
 
 /**
  * @brief Reads the state of a Push Button.
  *
- * This function reads the current state of the specified push button (pressed or not pressed).
+ * This function returns the debounced state of the specified push button (pressed or not pressed)
+ * without waiting. The button must have been registered with HAL_PushButton_Register.
  *
  * @param[in] Copy_ButtonPortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
  * @param[in] Copy_ButtonPinId The ID of the GPIO pin (e.g., GPIO_PIN0, GPIO_PIN1, etc.).
@@ -3,4 +3,56 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : SSD_config.h               *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef SSD_CONFIG_H_
+#define SSD_CONFIG_H_
+
+/**
+ * @brief Display type.
+ *
+ * - SSD_COMMON_CATHODE: a segment is lit by driving its pin high.
+ * - SSD_COMMON_ANODE  : a segment is lit by driving its pin low.
+ */
+#define SSD_TYPE                    SSD_COMMON_CATHODE
+
+/**
+ * @brief Level that selects a digit (GPIO_HIGH or GPIO_LOW), depending on the digit drivers.
+ */
+#define SSD_DIGIT_ACTIVE_LEVEL      GPIO_LOW
+
+/**
+ * @brief Segment pins, in the order a, b, c, d, e, f, g, dp, all on SSD_SEGMENT_PORT.
+ */
+#define SSD_SEGMENT_PORT            GPIO_PORTA
+#define SSD_SEGMENT_PINS            {GPIO_PIN0, GPIO_PIN1, GPIO_PIN2, GPIO_PIN3, \
+                                     GPIO_PIN4, GPIO_PIN5, GPIO_PIN6, GPIO_PIN7}
+
+/**
+ * @brief Digit select pins, leftmost first, all on SSD_DIGIT_PORT.
+ *
+ * When SSD_DIGIT_PORT is SSD_SEGMENT_PORT, each refresh slot switches the segments and the digit
+ * with a single port write.
+ */
+#define SSD_DIGIT_PORT              GPIO_PORTA
+#define SSD_DIGITS_COUNT            4
+#define SSD_DIGIT_PINS              {GPIO_PIN8, GPIO_PIN9, GPIO_PIN10, GPIO_PIN11}
+
+/**
+ * @brief Timer driving the refresh (TIM_2, TIM_3 or TIM_4). Its channel 1 compare sets the brightness.
+ */
+#define SSD_TIMER                   TIM_3
+
+/**
+ * @brief Full-display refresh rate in Hz.
+ *
+ * Each digit is lit SSD_REFRESH_RATE_HZ times per second. The timer clock must be a multiple of
+ * SSD_REFRESH_RATE_HZ * SSD_DIGITS_COUNT * 100.
+ */
+#define SSD_REFRESH_RATE_HZ         100
+
+/**
+ * @brief Brightness after HAL_SSD_Init, 0 to 100 percent.
+ */
+#define SSD_DEFAULT_BRIGHTNESS      100
+
+#endif /**< SSD_CONFIG_H_ */
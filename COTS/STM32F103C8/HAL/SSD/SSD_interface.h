@@ -2,5 +2,103 @@
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
-/******* File Name : SSD_interface.             *****************/
-/****************************************************************/
\ No newline at end of file
+/******* File Name : SSD_interface.h            *****************/
+/****************************************************************/
+#ifndef SSD_INTERFACE_H_
+#define SSD_INTERFACE_H_
+
+/**
+ * @name SSD Special Characters
+ * @brief Values accepted by HAL_SSD_SetDigit besides the hexadecimal digits 0x0 to 0xF.
+ * @{
+ */
+#define SSD_BLANK           16  /**< All segments off */
+#define SSD_MINUS           17  /**< Segment g only */
+/** @} */
+
+/**
+ * @name SSD Segment Bits
+ * @brief Bit layout used by HAL_SSD_SetSegments.
+ * @{
+ */
+#define SSD_SEGMENT_A       0x01
+#define SSD_SEGMENT_B       0x02
+#define SSD_SEGMENT_C       0x04
+#define SSD_SEGMENT_D       0x08
+#define SSD_SEGMENT_E       0x10
+#define SSD_SEGMENT_F       0x20
+#define SSD_SEGMENT_G       0x40
+#define SSD_SEGMENT_DP      0x80
+/** @} */
+
+/**
+ * @brief Initialize the multiplexed seven-segment display.
+ *
+ * This function configures the segment and digit pins, precomputes the port patterns of every
+ * character, and starts SSD_TIMER. From then on the timer interrupt lights one digit per slot
+ * with a single masked port write (two when the digits and segments are on different ports),
+ * and blanks it early from the compare interrupt to set the brightness.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The display is running (all digits blank).
+ * @retval E_NOT_OK The pins or the timer could not be configured.
+ *
+ * @note The GPIO and timer clocks must be enabled first, and the timer's NVIC interrupt must be
+ *       enabled by the application.
+ */
+Std_ReturnType HAL_SSD_Init(void);
+
+/**
+ * @brief Show a character on one digit.
+ *
+ * Only the RAM frame buffer is written; the new pattern appears at the digit's next refresh slot.
+ *
+ * @param[in] Copy_Digit The digit (0 = leftmost, up to SSD_DIGITS_COUNT - 1).
+ * @param[in] Copy_Value 0x0 to 0xF, SSD_BLANK or SSD_MINUS. The decimal point is turned off.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid digit or value.
+ */
+Std_ReturnType HAL_SSD_SetDigit(u8 Copy_Digit, u8 Copy_Value);
+
+/**
+ * @brief Show a raw segment pattern on one digit.
+ *
+ * @param[in] Copy_Digit The digit (0 = leftmost, up to SSD_DIGITS_COUNT - 1).
+ * @param[in] Copy_Segments OR of SSD_SEGMENT_A .. SSD_SEGMENT_DP.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid digit.
+ */
+Std_ReturnType HAL_SSD_SetSegments(u8 Copy_Digit, u8 Copy_Segments);
+
+/**
+ * @brief Turn the decimal point of one digit on or off.
+ *
+ * @param[in] Copy_Digit The digit (0 = leftmost, up to SSD_DIGITS_COUNT - 1).
+ * @param[in] Copy_State 1 to light the decimal point, 0 to turn it off.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid digit.
+ */
+Std_ReturnType HAL_SSD_SetDecimalPoint(u8 Copy_Digit, u8 Copy_State);
+
+/**
+ * @brief Show an unsigned decimal number, right-aligned with leading blanks.
+ *
+ * @param[in] Copy_Number The number to show.
+ *
+ * @return E_OK on success, E_NOT_OK if the number does not fit in SSD_DIGITS_COUNT digits
+ *         (the display is left unchanged).
+ */
+Std_ReturnType HAL_SSD_DisplayNumber(u32 Copy_Number);
+
+/**
+ * @brief Set the display brightness.
+ *
+ * The brightness is the fraction of each digit's refresh slot during which the digit is lit.
+ *
+ * @param[in] Copy_Percent 0 (off) to 100 (full brightness).
+ *
+ * @return E_OK on success, E_NOT_OK if Copy_Percent is above 100.
+ */
+Std_ReturnType HAL_SSD_SetBrightness(u8 Copy_Percent);
+
+#endif /**< SSD_INTERFACE_H_ */
@@ -3,4 +3,66 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : SSD_private.h              *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+#ifndef SSD_PRIVATE_H_
+#define SSD_PRIVATE_H_
+
+/**
+ * @name SSD Type Options
+ * @{
+ */
+#define SSD_COMMON_CATHODE          0
+#define SSD_COMMON_ANODE            1
+/** @} */
+
+#if (SSD_TYPE != SSD_COMMON_CATHODE) && (SSD_TYPE != SSD_COMMON_ANODE)
+#error "Invalid SSD_TYPE value. Please choose SSD_COMMON_CATHODE or SSD_COMMON_ANODE."
+#endif
+
+#if (SSD_DIGITS_COUNT < 1) || (SSD_DIGITS_COUNT > 8)
+#error "SSD_DIGITS_COUNT must be between 1 and 8."
+#endif
+
+/**< Number of segment pins (a to g and dp) */
+#define SSD_SEGMENTS_COUNT          8
+
+/**< Brightness steps per refresh slot (timer counts per slot) */
+#define SSD_BRIGHTNESS_STEPS        100
+
+/**< Timer channel whose compare match blanks the digit */
+#define SSD_BLANK_CHANNEL           TIM_CHANNEL1
+
+/**< Number of entries of the character table (0x0 to 0xF, SSD_BLANK, SSD_MINUS) */
+#define SSD_CHARACTERS_COUNT        18
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Convert a segment pattern to the segment port pattern, applying the display polarity.
+ *
+ * @param[in] Copy_Segments OR of SSD_SEGMENT_A .. SSD_SEGMENT_DP.
+ *
+ * @return The levels of the segment pins (within SSD_SegmentMask).
+ */
+static u16 SSD_EncodeSegments(u8 Copy_Segments);
+
+/**
+ * @brief Timer update callback: light the next digit.
+ */
+static void SSD_ShowNextDigit(void);
+
+/**
+ * @brief Timer compare callback: blank the digit for the rest of the slot.
+ *
+ * @param[in] Copy_Value Captured compare value (unused).
+ */
+static void SSD_BlankDigit(u16 Copy_Value);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< SSD_PRIVATE_H_ */
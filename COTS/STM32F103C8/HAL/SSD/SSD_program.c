@@ -3,4 +3,271 @@
 /******* Date      : 16 Sep 2023                *****************/
 /******* Version   : 0.1                        *****************/
 /******* File Name : SSD_program.c              *****************/
-/****************************************************************/
\ No newline at end of file
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "GPIO_interface.h"
+#include "TIM_interface.h"
+/*****************************< HAL *****************************/
+#include "SSD_interface.h"
+#include "SSD_config.h"
+#include "SSD_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Segment patterns of the characters, bit 0 = a ... bit 6 = g */
+static const u8 SSD_CharacterSegments[SSD_CHARACTERS_COUNT] = {
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,     /**< 0 to 7 */
+    0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71,     /**< 8 to F */
+    0x00, 0x40                                          /**< Blank, minus */
+};
+
+/**< Pin tables */
+static const u8 SSD_SegmentPins[SSD_SEGMENTS_COUNT] = SSD_SEGMENT_PINS;
+static const u8 SSD_DigitPins[SSD_DIGITS_COUNT] = SSD_DIGIT_PINS;
+
+/**< Segment port patterns of the characters, built by HAL_SSD_Init (polarity applied) */
+static u16 SSD_CharacterPatterns[SSD_CHARACTERS_COUNT];
+
+/**< Port masks and patterns built by HAL_SSD_Init */
+static u16 SSD_SegmentMask = 0;                     /**< All segment pins */
+static u16 SSD_DecimalPointMask = 0;                /**< The dp pin */
+static u16 SSD_DigitMask = 0;                       /**< All digit select pins */
+static u16 SSD_DigitsOff = 0;                       /**< Digit port pattern with no digit selected */
+static u16 SSD_DigitOn[SSD_DIGITS_COUNT];           /**< Digit port pattern selecting each digit */
+
+/**< Frame buffer: segment port pattern of each digit */
+static volatile u16 SSD_Frame[SSD_DIGITS_COUNT];
+
+/**< Digit lit during the current slot */
+static u8 SSD_CurrentDigit = 0;
+
+/**< Brightness in percent (also the blanking compare value) */
+static volatile u8 SSD_Brightness = SSD_DEFAULT_BRIGHTNESS;
+/*****************************< Function Implementations *****************************/
+Std_ReturnType HAL_SSD_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_Index;
+
+    /**< Port masks */
+    SSD_SegmentMask = 0;
+    for (Local_Index = 0; Local_Index < SSD_SEGMENTS_COUNT; Local_Index++)
+    {
+        SSD_SegmentMask |= (u16)(1U << SSD_SegmentPins[Local_Index]);
+        Local_FunctionStatus &= MCAL_GPIO_SetPinMode(SSD_SEGMENT_PORT, SSD_SegmentPins[Local_Index], GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    }
+    SSD_DecimalPointMask = (u16)(1U << SSD_SegmentPins[SSD_SEGMENTS_COUNT - 1]);
+
+    SSD_DigitMask = 0;
+    for (Local_Index = 0; Local_Index < SSD_DIGITS_COUNT; Local_Index++)
+    {
+        SSD_DigitMask |= (u16)(1U << SSD_DigitPins[Local_Index]);
+        Local_FunctionStatus &= MCAL_GPIO_SetPinMode(SSD_DIGIT_PORT, SSD_DigitPins[Local_Index], GPIO_OUTPUT_PUSH_PULL_2MHZ);
+    }
+
+    /**< Digit select patterns */
+#if SSD_DIGIT_ACTIVE_LEVEL == GPIO_HIGH
+    SSD_DigitsOff = 0;
+    for (Local_Index = 0; Local_Index < SSD_DIGITS_COUNT; Local_Index++)
+    {
+        SSD_DigitOn[Local_Index] = (u16)(1U << SSD_DigitPins[Local_Index]);
+    }
+#else
+    SSD_DigitsOff = SSD_DigitMask;
+    for (Local_Index = 0; Local_Index < SSD_DIGITS_COUNT; Local_Index++)
+    {
+        SSD_DigitOn[Local_Index] = SSD_DigitMask & (u16)~(1U << SSD_DigitPins[Local_Index]);
+    }
+#endif
+
+    /**< Character lookup table in port space, so a refresh is a plain copy */
+    for (Local_Index = 0; Local_Index < SSD_CHARACTERS_COUNT; Local_Index++)
+    {
+        SSD_CharacterPatterns[Local_Index] = SSD_EncodeSegments(SSD_CharacterSegments[Local_Index]);
+    }
+
+    for (Local_Index = 0; Local_Index < SSD_DIGITS_COUNT; Local_Index++)
+    {
+        SSD_Frame[Local_Index] = SSD_CharacterPatterns[SSD_BLANK];
+    }
+
+    /**< Start blank */
+    MCAL_GPIO_SetPortMaskedValue(SSD_DIGIT_PORT, SSD_DigitMask, SSD_DigitsOff);
+    MCAL_GPIO_SetPortMaskedValue(SSD_SEGMENT_PORT, SSD_SegmentMask, SSD_CharacterPatterns[SSD_BLANK]);
+
+    SSD_CurrentDigit = 0;
+    SSD_Brightness = SSD_DEFAULT_BRIGHTNESS;
+
+    /**< One update per digit slot, SSD_BRIGHTNESS_STEPS counts per slot; the compare blanks the digit */
+    Local_FunctionStatus &= MCAL_TIM_InitTimebase(SSD_TIMER, (u32)SSD_REFRESH_RATE_HZ * SSD_DIGITS_COUNT * SSD_BRIGHTNESS_STEPS,
+                                                  SSD_BRIGHTNESS_STEPS - 1);
+    Local_FunctionStatus &= MCAL_TIM_SetCompare(SSD_TIMER, SSD_BLANK_CHANNEL, SSD_DEFAULT_BRIGHTNESS);
+    Local_FunctionStatus &= MCAL_TIM_EnableUpdateInterrupt(SSD_TIMER, SSD_ShowNextDigit);
+    Local_FunctionStatus &= MCAL_TIM_EnableCaptureCompareInterrupt(SSD_TIMER, SSD_BLANK_CHANNEL, SSD_BlankDigit);
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = MCAL_TIM_Start(SSD_TIMER);
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_SSD_SetDigit(u8 Copy_Digit, u8 Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if ((Copy_Digit < SSD_DIGITS_COUNT) && (Copy_Value < SSD_CHARACTERS_COUNT))
+    {
+        SSD_Frame[Copy_Digit] = SSD_CharacterPatterns[Copy_Value];
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_SSD_SetSegments(u8 Copy_Digit, u8 Copy_Segments)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (Copy_Digit < SSD_DIGITS_COUNT)
+    {
+        SSD_Frame[Copy_Digit] = SSD_EncodeSegments(Copy_Segments);
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_SSD_SetDecimalPoint(u8 Copy_Digit, u8 Copy_State)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u16 Local_On = SSD_EncodeSegments(SSD_SEGMENT_DP) & SSD_DecimalPointMask;
+
+    if (Copy_Digit < SSD_DIGITS_COUNT)
+    {
+        if (Copy_State != 0)
+        {
+            SSD_Frame[Copy_Digit] = (SSD_Frame[Copy_Digit] & (u16)~SSD_DecimalPointMask) | Local_On;
+        }
+        else
+        {
+            SSD_Frame[Copy_Digit] = (SSD_Frame[Copy_Digit] & (u16)~SSD_DecimalPointMask) | (Local_On ^ SSD_DecimalPointMask);
+        }
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_SSD_DisplayNumber(u32 Copy_Number)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u16 Local_Patterns[SSD_DIGITS_COUNT];
+    s8 Local_Digit;
+
+    /**< Convert into a local copy first, so an overflow leaves the display unchanged */
+    for (Local_Digit = SSD_DIGITS_COUNT - 1; Local_Digit >= 0; Local_Digit--)
+    {
+        if ((Copy_Number == 0) && (Local_Digit != (SSD_DIGITS_COUNT - 1)))
+        {
+            Local_Patterns[Local_Digit] = SSD_CharacterPatterns[SSD_BLANK];
+        }
+        else
+        {
+            Local_Patterns[Local_Digit] = SSD_CharacterPatterns[Copy_Number % 10];
+            Copy_Number /= 10;
+        }
+    }
+
+    if (Copy_Number == 0)
+    {
+        for (Local_Digit = 0; Local_Digit < SSD_DIGITS_COUNT; Local_Digit++)
+        {
+            SSD_Frame[Local_Digit] = Local_Patterns[Local_Digit];
+        }
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType HAL_SSD_SetBrightness(u8 Copy_Percent)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (Copy_Percent <= SSD_BRIGHTNESS_STEPS)
+    {
+        /**< A compare value of SSD_BRIGHTNESS_STEPS is never reached: the digit stays lit the whole slot */
+        SSD_Brightness = Copy_Percent;
+        Local_FunctionStatus = MCAL_TIM_SetCompare(SSD_TIMER, SSD_BLANK_CHANNEL, Copy_Percent);
+    }
+
+    return Local_FunctionStatus;
+}
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+static u16 SSD_EncodeSegments(u8 Copy_Segments)
+{
+    u16 Local_Pattern = 0;
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < SSD_SEGMENTS_COUNT; Local_Index++)
+    {
+        if (GET_BIT(Copy_Segments, Local_Index) != 0)
+        {
+            Local_Pattern |= (u16)(1U << SSD_SegmentPins[Local_Index]);
+        }
+    }
+
+#if SSD_TYPE == SSD_COMMON_ANODE
+    Local_Pattern ^= SSD_SegmentMask;
+#endif
+
+    return Local_Pattern;
+}
+
+static void SSD_ShowNextDigit(void)
+{
+    u8 Local_Digit = SSD_CurrentDigit + 1;
+
+    if (Local_Digit >= SSD_DIGITS_COUNT)
+    {
+        Local_Digit = 0;
+    }
+    SSD_CurrentDigit = Local_Digit;
+
+    if (SSD_Brightness == 0)
+    {
+        return;
+    }
+
+#if SSD_SEGMENT_PORT == SSD_DIGIT_PORT
+    /**< Segments and digit select change in the same BSRR write: no ghosting, one bus access */
+    MCAL_GPIO_SetPortMaskedValue(SSD_SEGMENT_PORT, SSD_SegmentMask | SSD_DigitMask,
+                                 SSD_Frame[Local_Digit] | SSD_DigitOn[Local_Digit]);
+#else
+    /**< The compare interrupt already deselected the previous digit, unless brightness is 100 % */
+    MCAL_GPIO_SetPortMaskedValue(SSD_DIGIT_PORT, SSD_DigitMask, SSD_DigitsOff);
+    MCAL_GPIO_SetPortMaskedValue(SSD_SEGMENT_PORT, SSD_SegmentMask, SSD_Frame[Local_Digit]);
+    MCAL_GPIO_SetPortMaskedValue(SSD_DIGIT_PORT, SSD_DigitMask, SSD_DigitOn[Local_Digit]);
+#endif
+}
+
+static void SSD_BlankDigit(u16 Copy_Value)
+{
+    (void)Copy_Value;
+
+    MCAL_GPIO_SetPortMaskedValue(SSD_DIGIT_PORT, SSD_DigitMask, SSD_DigitsOff);
+}
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+/*****************************< End of Function Implementations *****************************/
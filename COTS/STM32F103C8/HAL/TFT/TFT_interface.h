@@ -114,9 +114,19 @@ typedef struct {
  * @param Copy_psSpiPeripheral Pointer to the SPI peripheral used for communication with the TFT.
  *
  * @note This function sends a series of commands to configure the TFT display.
+ * @note The function does not block: it starts the reset pulse and returns, the remaining steps
+ *       (about 800 ms of controller delays) are paced by the software timer service. Poll
+ *       TFT_IsReady before drawing. The SWTMR service must already be initialized.
  */
 void TFT_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral);
 
+/**
+ * @brief Checks whether the initialization started by TFT_Init has completed.
+ *
+ * @return 1 if the display is ready for drawing, 0 otherwise.
+ */
+u8 TFT_IsReady(void);
+
 /**
  * @brief Clears the TFT screen by filling it with the default background color.
  *
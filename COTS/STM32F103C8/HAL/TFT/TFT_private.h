@@ -202,6 +202,32 @@
 
 /** @} TFT_Command_and_Some_Macros_Private */
 
+/**
+ * @addtogroup TFT_Init_Sequence_Private
+ * @{
+ */
+
+/**
+ * @brief Flag OR-ed into the argument count of a TFT_InitSequence entry that is followed by a delay byte.
+ */
+#define TFT_INIT_DELAY_FLAG         0x80
+
+/**
+ * @brief Unit of the delay byte of a TFT_InitSequence entry in milliseconds.
+ */
+#define TFT_INIT_DELAY_UNIT_MS      10
+
+/**
+ * @brief Initialization states of the TFT display.
+ */
+#define TFT_INIT_STATE_IDLE             0   /**< TFT_Init has not been called */
+#define TFT_INIT_STATE_RESET_LOW        1   /**< Next step asserts the reset pin */
+#define TFT_INIT_STATE_RESET_RELEASE    2   /**< Next step releases the reset pin */
+#define TFT_INIT_STATE_SEQUENCE         3   /**< Next step sends commands from TFT_InitSequence */
+#define TFT_INIT_STATE_READY            4   /**< The display is initialized */
+
+/** @} TFT_Init_Sequence_Private */
+
 /**
  * @addtogroup TFT_Private_Functions TFT Private Functions
  * @brief Internal/private functions for the TFT Displays module.
@@ -412,36 +438,17 @@ static void TFT_SetYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Cop
 static void TFT_SetXYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral, u16 Copy_XPosition, u16 Copy_YPosition);
 
 /**
- * @brief Internal function to initialize the TFT display controller.
- *
- * This function is used internally to initialize the TFT display controller
- * based on the configuration settings provided in the TFT_Config_t structure.
- * It configures the display controller's parameters and settings to ensure proper
- * communication and display behavior.
+ * @brief Internal function that advances the non-blocking initialization of the TFT display.
  *
- * @param Copy_TftDisplay Pointer to the TFT display configuration structure.
- * @param Copy_SpiPeripheral The SPI peripheral used for communication.
+ * This function is the callback of the initialization software timer. Each call performs the
+ * next step of the reset pulse, then sends the commands of TFT_InitSequence up to the next
+ * command that needs a delay, and re-arms the timer for that delay instead of busy waiting.
  *
- * @note This function should be called during the initialization process of the TFT display module.
+ * @param Copy_pvContext Unused.
  *
- * @note Example Usage:
- * @code
- * /// Create a TFT display configuration structure
- * TFT_Config_t tftConfig = {
- *     .TFT_Port = PORTA_INDEX,
- *     .TFT_CsPin = GPIO_PIN0,
- *     .TFT_RsPin = GPIO_PIN1,
- *     /// ... other configuration settings ...
- * };
- *
- * /// Select the SPI peripheral (e.g., SPI_1)
- * SPI_Peripheral_t spiPeripheral = SPI_1;
- *
- * /// Initialize the TFT display controller
- * TFT_InitController(&tftConfig, spiPeripheral);
- * @endcode
+ * @note The display and SPI peripheral are taken from the values saved by TFT_Init.
  */
-static void TFT_InitController(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral);
+static void TFT_InitStep(void *Copy_pvContext);
 
 /**
  * @brief Internal function to draw a character on the TFT display.
@@ -28,14 +28,64 @@
 /**<=========================================================================================*/
 #include "GPIO_interface.h"
 #include "SPI_interface.h"
-#include "STK_interface.h"
+
+/**<============================================================================================*/
+/*******************************************< SERVICES *******************************************/
+/**<============================================================================================*/
+#include "SWTMR_interface.h"
 
 /**<========================================================================================*/
 /*******************************************< HAL *******************************************/
 /**<========================================================================================*/
 #include "TFT_interface.h"
-#include "TFT_private.h"
 #include "TFT_config.h"
+#include "TFT_private.h"
+/*****************************< Global Variable Section *****************************/
+/**
+ * @brief ST7735S initialization sequence.
+ *
+ * Each entry is: command, argument count (OR-ed with TFT_INIT_DELAY_FLAG when a delay follows),
+ * the arguments, and then the delay in units of TFT_INIT_DELAY_UNIT_MS if flagged.
+ */
+static const u8 TFT_InitSequence[] = {
+    TFT_SWRESET, TFT_INIT_DELAY_FLAG | 0, 15,                       /**< Software reset, wait 150 ms */
+    TFT_SLPOUT, TFT_INIT_DELAY_FLAG | 0, 50,                        /**< Exit sleep mode, wait 500 ms */
+    TFT_FRMCTR1, 3, 0x01, 0x2C, 0x2D,                               /**< Frame rate control - normal mode */
+    TFT_FRMCTR2, 3, 0x01, 0x2C, 0x2D,                               /**< Frame rate control - idle mode */
+    TFT_FRMCTR3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,             /**< Frame rate control - partial mode */
+    TFT_INVCTR, 1, 0x07,                                            /**< Display inversion control */
+    TFT_PWCTR1, 3, 0xA2, 0x02, 0x84,                                /**< Power control */
+    TFT_PWCTR2, 1, 0xC5,                                            /**< Power control */
+    TFT_PWCTR3, 2, 0x0A, 0x00,                                      /**< Power control */
+    TFT_PWCTR4, 2, 0x8A, 0x2A,                                      /**< Power control */
+    TFT_PWCTR5, 2, 0x8A, 0xEE,                                      /**< Power control */
+    TFT_VMCTR1, 1, 0x0E,                                            /**< VCOM control */
+    TFT_INVOFF, 0,                                                  /**< Disable display inversion */
+    TFT_MADCTL, 1, 0xC0,                                            /**< Memory access control */
+#if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _16BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
+    TFT_COLMOD, 1, TFT_DISPLAY_COLORS,                              /**< Pixel format */
+#else
+    TFT_COLMOD, 0,
+    TFT_INVON, 0,
+#endif
+    TFT_CASET, 4, 0x00, 0x00, 0x00, 0x7F,                           /**< Column address */
+    TFT_RASET, 4, 0x00, 0x00, 0x00, 0x7F,                           /**< Row address */
+    0xE0, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,       /**< Gamma (positive polarity) */
+              0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+    0xE1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,       /**< Gamma (negative polarity) */
+              0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+    TFT_NORON, TFT_INIT_DELAY_FLAG | 0, 1,                          /**< Normal display mode on, wait 10 ms */
+    TFT_DISPON, TFT_INIT_DELAY_FLAG | 0, 10                         /**< Display on, wait 100 ms */
+};
+
+/**
+ * @brief State of the non-blocking initialization.
+ */
+static const TFT_Config_t *TFT_InitDisplay = NULL;  /**< Display being initialized */
+static SPI_t TFT_InitSpiPeripheral;                 /**< SPI peripheral of that display */
+static u16 TFT_InitIndex = 0;                       /**< Next byte of TFT_InitSequence */
+static volatile u8 TFT_InitState = TFT_INIT_STATE_IDLE;
+static SWTMR_Timer_t TFT_InitTimer;                 /**< Timer that paces the initialization steps */
 
 /**<=============================================================================================================*/
 /*******************************************< Functions Implementation *******************************************/
@@ -48,25 +98,23 @@
 
 void TFT_Init(const TFT_Config_t *Copy_TftDisplay, SPI_t Copy_SpiPeripheral)
 {
+    /**< Save the display so the timer callback can continue the initialization */
+    TFT_InitDisplay = Copy_TftDisplay;
+    TFT_InitSpiPeripheral = Copy_SpiPeripheral;
+    TFT_InitIndex = 0;
+    TFT_InitState = TFT_INIT_STATE_RESET_LOW;
+
     /**< Set the Reset (RES) pin to high logic level to release reset signal */
     GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    MCAL_STK_SetDelay_ms(5);
-    
-    /**< Set the Reset (RST) pin to low logic level to assert reset signal */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_LOW);
-    
-    /**< Wait for a short delay */
-    MCAL_STK_SetDelay_ms(15);
-    
-    /**< Set the Reset (RES) pin to high logic level to release reset signal */
-    GPIO_SetPinValue(Copy_TftDisplay->TFT_RESPin.TFT_Port, Copy_TftDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
-    
-    /**< Wait for a specified delay before proceeding */
-    MCAL_STK_SetDelay_ms(15);
-    
-    TFT_InitController(Copy_TftDisplay, Copy_SpiPeripheral);
+
+    /**< The rest of the reset pulse and the controller configuration run from the timer */
+    SWTMR_Create(&TFT_InitTimer, TFT_InitStep, NULL);
+    SWTMR_StartOneShot(&TFT_InitTimer, SWTMR_MsToTicks(5));
+}
+
+u8 TFT_IsReady(void)
+{
+    return (TFT_InitState == TFT_INIT_STATE_READY) ? 1 : 0;
 }
 
 void TFT_ClearScreen(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
@@ -280,150 +328,58 @@ static void TFT_SetXYAddress(const TFT_Config_t *Copy_TftDisplay, const SPI_t Co
     TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, yLow);         /**< Send low byte of Y address */
 }
 
-static void TFT_InitController(const TFT_Config_t *Copy_TftDisplay, const SPI_t Copy_SpiPeripheral)
+static void TFT_InitStep(void *Copy_pvContext)
 {
-    /**<==============================================================================================================*/
-    /*******************************************< Configure ST7735S display *******************************************/ 
-    /**<==============================================================================================================*/
-    /**< Send command for software reset */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    MCAL_STK_SetDelay_ms(150);
-
-    /**< Send command to exit sleep mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x11);
-    MCAL_STK_SetDelay_ms(500);
-
-    /**< Send command to configure frame rate control - normal mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xB1);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-
-    /**< Send command to configure frame rate control - idle mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xB2);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-
-    /**< Send command to configure frame rate control - partial mode */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xB3);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-
-    /**< Send command to configure display inversion control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xB4);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x07);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC0);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0xA2);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x02);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x84);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC1);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0xC5);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC2);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x0A);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC3);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x8A);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2A);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC4);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x8A);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0xEE);
-
-    /**< Send command to configure power control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xC5);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x0E);
-
-    /**< Send command to disable display inversion */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x20);
-
-    /**< Send command to configure memory access control */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x36);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0xC0);
-
-    /**< Send command to set pixel format */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x3A);
-    #if (TFT_DISPLAY_COLORS == _3BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _16BIT_PER_PIXEL) || (TFT_DISPLAY_COLORS == _18BIT_PER_PIXEL)
-        TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, TFT_DISPLAY_COLORS);
-    #else
-        TFT_SendCommand(Copy_TftDisplay, 0x21);
-    #endif
-
-    /**< Set column address */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x2A);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x7F);
-
-    /**< Set row address */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x2B);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x7F);
-
-    /**< Configure magical unicorn dust settings - Part 1 */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xE0);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x02);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x1C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x07);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x12);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x37);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x32);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x29);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x29);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x25);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2B);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x39);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x01);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x03);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x10);
-
-    /**< Configure sparkles and rainbows settings - Part 1 */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0xE1);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x03);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x1D);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x07);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x06);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2E);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2C);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x29);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2D);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2E);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x2E);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x37);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x3F);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x00);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x02);
-    TFT_SendData(Copy_TftDisplay, Copy_SpiPeripheral, 0x10);
-
-    /**< Turn off inversion */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x13);
-    MCAL_STK_SetDelay_ms(10);
-
-    /**< Turn on display */
-    TFT_SendCommand(Copy_TftDisplay, Copy_SpiPeripheral, 0x29);
-    MCAL_STK_SetDelay_ms(100);
-    /**<=========================================================================================================================*/
-    /*******************************************< End of ST7735S display configuration *******************************************/
-    /**<=========================================================================================================================*/
+    u8 Local_Command;
+    u8 Local_ArgCount;
+    u8 Local_HasDelay;
+
+    (void)Copy_pvContext;
+
+    switch (TFT_InitState)
+    {
+    case TFT_INIT_STATE_RESET_LOW:
+        /**< Set the Reset (RST) pin to low logic level to assert reset signal */
+        GPIO_SetPinValue(TFT_InitDisplay->TFT_RESPin.TFT_Port, TFT_InitDisplay->TFT_RESPin.TFT_Pin, GPIO_LOW);
+        TFT_InitState = TFT_INIT_STATE_RESET_RELEASE;
+        SWTMR_StartOneShot(&TFT_InitTimer, SWTMR_MsToTicks(15));
+        break;
+
+    case TFT_INIT_STATE_RESET_RELEASE:
+        /**< Set the Reset (RES) pin to high logic level to release reset signal */
+        GPIO_SetPinValue(TFT_InitDisplay->TFT_RESPin.TFT_Port, TFT_InitDisplay->TFT_RESPin.TFT_Pin, GPIO_HIGH);
+        TFT_InitState = TFT_INIT_STATE_SEQUENCE;
+        SWTMR_StartOneShot(&TFT_InitTimer, SWTMR_MsToTicks(15));
+        break;
+
+    case TFT_INIT_STATE_SEQUENCE:
+        /**< Send commands until one of them needs a delay, then come back when it has elapsed */
+        while (TFT_InitIndex < sizeof(TFT_InitSequence))
+        {
+            Local_Command = TFT_InitSequence[TFT_InitIndex++];
+            Local_ArgCount = TFT_InitSequence[TFT_InitIndex++];
+            Local_HasDelay = Local_ArgCount & TFT_INIT_DELAY_FLAG;
+            Local_ArgCount &= ~TFT_INIT_DELAY_FLAG;
+
+            TFT_SendCommand(TFT_InitDisplay, TFT_InitSpiPeripheral, Local_Command);
+            while (Local_ArgCount--)
+            {
+                TFT_SendData(TFT_InitDisplay, TFT_InitSpiPeripheral, TFT_InitSequence[TFT_InitIndex++]);
+            }
+
+            if (Local_HasDelay)
+            {
+                SWTMR_StartOneShot(&TFT_InitTimer, SWTMR_MsToTicks(TFT_InitSequence[TFT_InitIndex++] * TFT_INIT_DELAY_UNIT_MS));
+                return;
+            }
+        }
+
+        TFT_InitState = TFT_INIT_STATE_READY;
+        break;
+
+    default:
+        break;
+    }
 }
 
 /**
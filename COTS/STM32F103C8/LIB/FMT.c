@@ -0,0 +1,377 @@
+/**
+  ******************************************************************************
+  * @file         FMT.c
+  * @company      DevLeague
+  * @date         19 Oct 2026
+  * @version      0.2
+  * @brief        Allocation-free number and string formatting.
+  *
+  * This file implements the conversions declared in FMT.h. Decimal digits come
+  * from a multiplication by the reciprocal of 10 (one UMULL on the Cortex-M3)
+  * rather than a division, and fixed-point fractions from shifts and masks.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 DevLeague.
+  * All rights reserved.
+  *
+  * This software is licensed under the terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "FMT.h"
+/*****************************< Private Section *****************************/
+/**< x / 10 for every 32-bit x: 0xCCCCCCCD / 2^35 is 1/10 rounded up with enough precision to be exact */
+#define FMT_DIV10(X)            ((u32)(((u64)(X) * 0xCCCCCCCDULL) >> 35))
+
+/**< Conversion flags */
+#define FMT_FLAG_LEFT           0x01    /**< '-': pad on the right */
+#define FMT_FLAG_ZERO           0x02    /**< '0': pad with zeros after the sign */
+
+/**< Q format of %q arguments, and its default and largest precision */
+#define FMT_Q_FRAC_BITS         16
+#define FMT_Q_DEFAULT_DECIMALS  3
+#define FMT_Q_MAX_DECIMALS      9
+
+/**< Widths and precisions saturate here: the output never holds more characters */
+#define FMT_FIELD_MAX           0xFFFFUL
+
+/**< Largest number of characters taken from a %s argument when no precision is given */
+#define FMT_NO_LIMIT            0xFFFFFFFFUL
+
+/**< Output buffer state while formatting */
+typedef struct {
+    char *pBuffer;
+    u16 Size;
+    u16 Length;
+} FMT_Output_t;
+
+static const char FMT_HexDigits[] = "0123456789ABCDEF";
+
+static void FMT_Put(FMT_Output_t *Copy_pOutput, char Copy_Char);
+static u32 FMT_ParseField(const char **Copy_ppFormat);
+static void FMT_PutField(FMT_Output_t *Copy_pOutput, const char *Copy_pText, u32 Copy_MaxLength, u32 Copy_Width, u8 Copy_Flags);
+/*****************************< Function Implementations *****************************/
+u8 FMT_U32ToDec(char *Copy_pBuffer, u32 Copy_Value)
+{
+    char Local_Digits[10];
+    u8 Local_Count = 0;
+    u8 Local_Index;
+    u32 Local_Quotient;
+
+    /**< Least significant digit first */
+    do
+    {
+        Local_Quotient = FMT_DIV10(Copy_Value);
+        Local_Digits[Local_Count++] = (char)('0' + (Copy_Value - (Local_Quotient * 10U)));
+        Copy_Value = Local_Quotient;
+    } while (Copy_Value != 0);
+
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        Copy_pBuffer[Local_Index] = Local_Digits[Local_Count - 1 - Local_Index];
+    }
+    Copy_pBuffer[Local_Count] = '\0';
+
+    return Local_Count;
+}
+
+u8 FMT_S32ToDec(char *Copy_pBuffer, s32 Copy_Value)
+{
+    if (Copy_Value < 0)
+    {
+        /**< Negate in unsigned arithmetic so INT32_MIN converts too */
+        Copy_pBuffer[0] = '-';
+        return (u8)(1 + FMT_U32ToDec(&Copy_pBuffer[1], 0U - (u32)Copy_Value));
+    }
+
+    return FMT_U32ToDec(Copy_pBuffer, (u32)Copy_Value);
+}
+
+u8 FMT_U32ToHex(char *Copy_pBuffer, u32 Copy_Value, u8 Copy_MinDigits)
+{
+    u8 Local_Count = 8;
+    u8 Local_Index;
+
+    if (Copy_MinDigits > 8)
+    {
+        Copy_MinDigits = 8;
+    }
+    else if (Copy_MinDigits == 0)
+    {
+        Copy_MinDigits = 1;
+    }
+
+    /**< Drop leading zero nibbles down to the minimum width */
+    while ((Local_Count > Copy_MinDigits) && (((Copy_Value >> ((Local_Count - 1) * 4)) & 0x0F) == 0))
+    {
+        Local_Count--;
+    }
+
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
+    {
+        Copy_pBuffer[Local_Index] = FMT_HexDigits[(Copy_Value >> ((Local_Count - 1 - Local_Index) * 4)) & 0x0F];
+    }
+    Copy_pBuffer[Local_Count] = '\0';
+
+    return Local_Count;
+}
+
+u8 FMT_FixedToDec(char *Copy_pBuffer, s32 Copy_Value, u8 Copy_FracBits, u8 Copy_Decimals)
+{
+    u32 Local_Magnitude = (u32)Copy_Value;
+    u32 Local_Mask;
+    u32 Local_Fraction;
+    u8 Local_Length = 0;
+
+    if (Copy_FracBits > FMT_FIXED_MAX_FRAC_BITS)
+    {
+        Copy_pBuffer[0] = '\0';
+        return 0;
+    }
+
+    if (Copy_Value < 0)
+    {
+        Copy_pBuffer[Local_Length++] = '-';
+        Local_Magnitude = 0U - (u32)Copy_Value;
+    }
+
+    Local_Mask = (1UL << Copy_FracBits) - 1UL;
+    Local_Length += FMT_U32ToDec(&Copy_pBuffer[Local_Length], Local_Magnitude >> Copy_FracBits);
+
+    if (Copy_Decimals != 0)
+    {
+        /**< Each decimal is the integer part of the fraction times 10; the fraction stays below 2^28, so x10 cannot overflow */
+        Copy_pBuffer[Local_Length++] = '.';
+        Local_Fraction = Local_Magnitude & Local_Mask;
+        while (Copy_Decimals != 0)
+        {
+            Local_Fraction *= 10U;
+            Copy_pBuffer[Local_Length++] = (char)('0' + (Local_Fraction >> Copy_FracBits));
+            Local_Fraction &= Local_Mask;
+            Copy_Decimals--;
+        }
+    }
+
+    Copy_pBuffer[Local_Length] = '\0';
+
+    return Local_Length;
+}
+
+u16 FMT_Format(char *Copy_pBuffer, u16 Copy_Size, const char *Copy_pFormat, ...)
+{
+    u16 Local_Length;
+    va_list Local_Args;
+
+    va_start(Local_Args, Copy_pFormat);
+    Local_Length = FMT_VFormat(Copy_pBuffer, Copy_Size, Copy_pFormat, Local_Args);
+    va_end(Local_Args);
+
+    return Local_Length;
+}
+
+u16 FMT_VFormat(char *Copy_pBuffer, u16 Copy_Size, const char *Copy_pFormat, va_list Copy_Args)
+{
+    FMT_Output_t Local_Output;
+    char Local_Text[FMT_DEC_BUFFER_SIZE + FMT_Q_MAX_DECIMALS + 1];
+    const char *Local_pText;
+    u8 Local_Flags;
+    u32 Local_Width;
+    u32 Local_Precision;
+    u8 Local_HasPrecision;
+    u32 Local_MaxLength;
+    u8 Local_Index;
+
+    if ((Copy_pBuffer == NULL) || (Copy_Size == 0) || (Copy_pFormat == NULL))
+    {
+        return 0;
+    }
+
+    Local_Output.pBuffer = Copy_pBuffer;
+    Local_Output.Size = Copy_Size;
+    Local_Output.Length = 0;
+
+    while (*Copy_pFormat != '\0')
+    {
+        if (*Copy_pFormat != '%')
+        {
+            FMT_Put(&Local_Output, *Copy_pFormat++);
+            continue;
+        }
+        Copy_pFormat++;
+
+        /**< Flags */
+        Local_Flags = 0;
+        while ((*Copy_pFormat == '-') || (*Copy_pFormat == '0'))
+        {
+            Local_Flags |= (*Copy_pFormat == '-') ? FMT_FLAG_LEFT : FMT_FLAG_ZERO;
+            Copy_pFormat++;
+        }
+
+        /**< Width */
+        Local_Width = FMT_ParseField(&Copy_pFormat);
+
+        /**< Precision */
+        Local_Precision = 0;
+        Local_HasPrecision = 0;
+        if (*Copy_pFormat == '.')
+        {
+            Local_HasPrecision = 1;
+            Copy_pFormat++;
+            Local_Precision = FMT_ParseField(&Copy_pFormat);
+        }
+
+        /**< int and long are the same size on this target */
+        while ((*Copy_pFormat == 'l') || (*Copy_pFormat == 'h'))
+        {
+            Copy_pFormat++;
+        }
+
+        Local_pText = Local_Text;
+        Local_MaxLength = FMT_NO_LIMIT;
+        switch (*Copy_pFormat)
+        {
+            case 'd':
+            case 'i':
+                FMT_S32ToDec(Local_Text, va_arg(Copy_Args, s32));
+                break;
+            case 'u':
+                FMT_U32ToDec(Local_Text, va_arg(Copy_Args, u32));
+                break;
+            case 'x':
+            case 'X':
+                FMT_U32ToHex(Local_Text, va_arg(Copy_Args, u32), 1);
+                if (*Copy_pFormat == 'x')
+                {
+                    for (Local_Index = 0; Local_Text[Local_Index] != '\0'; Local_Index++)
+                    {
+                        Local_Text[Local_Index] |= (Local_Text[Local_Index] > '9') ? 0x20 : 0x00;   /**< 'A'..'F' -> 'a'..'f' */
+                    }
+                }
+                break;
+            case 'q':
+                if (Local_HasPrecision == 0)
+                {
+                    Local_Precision = FMT_Q_DEFAULT_DECIMALS;
+                }
+                else if (Local_Precision > FMT_Q_MAX_DECIMALS)
+                {
+                    Local_Precision = FMT_Q_MAX_DECIMALS;
+                }
+                FMT_FixedToDec(Local_Text, va_arg(Copy_Args, s32), FMT_Q_FRAC_BITS, (u8)Local_Precision);
+                break;
+            case 'c':
+                Local_Text[0] = (char)va_arg(Copy_Args, int);
+                Local_Text[1] = '\0';
+                break;
+            case 's':
+                Local_pText = va_arg(Copy_Args, const char *);
+                if (Local_pText == NULL)
+                {
+                    Local_pText = "(null)";
+                }
+                if (Local_HasPrecision != 0)
+                {
+                    Local_MaxLength = Local_Precision;   /**< At most that many characters of the string */
+                }
+                break;
+            case '%':
+                Local_Text[0] = '%';
+                Local_Text[1] = '\0';
+                break;
+            default:
+                /**< Unknown conversion or end of string: stop formatting */
+                Local_Output.pBuffer[Local_Output.Length] = '\0';
+                return Local_Output.Length;
+        }
+        Copy_pFormat++;
+
+        FMT_PutField(&Local_Output, Local_pText, Local_MaxLength, Local_Width, Local_Flags);
+    }
+
+    Local_Output.pBuffer[Local_Output.Length] = '\0';
+
+    return Local_Output.Length;
+}
+/*****************************< Private Functions *****************************/
+static void FMT_Put(FMT_Output_t *Copy_pOutput, char Copy_Char)
+{
+    /**< Keep one byte for the terminator */
+    if ((u16)(Copy_pOutput->Length + 1U) < Copy_pOutput->Size)
+    {
+        Copy_pOutput->pBuffer[Copy_pOutput->Length++] = Copy_Char;
+    }
+}
+
+static u32 FMT_ParseField(const char **Copy_ppFormat)
+{
+    const char *Local_pFormat = *Copy_ppFormat;
+    u32 Local_Value = 0;
+
+    while ((*Local_pFormat >= '0') && (*Local_pFormat <= '9'))
+    {
+        Local_Value = (Local_Value * 10U) + (u32)(*Local_pFormat - '0');
+        if (Local_Value > FMT_FIELD_MAX)
+        {
+            Local_Value = FMT_FIELD_MAX;
+        }
+        Local_pFormat++;
+    }
+
+    *Copy_ppFormat = Local_pFormat;
+
+    return Local_Value;
+}
+
+static void FMT_PutField(FMT_Output_t *Copy_pOutput, const char *Copy_pText, u32 Copy_MaxLength, u32 Copy_Width, u8 Copy_Flags)
+{
+    u32 Local_Length = 0;
+    u32 Local_Index;
+    char Local_Pad = ' ';
+
+    while ((Copy_pText[Local_Length] != '\0') && (Local_Length < Copy_MaxLength))
+    {
+        Local_Length++;
+    }
+
+    /**< Zeros go between the sign and the digits; left-justified fields are always padded with spaces */
+    if (((Copy_Flags & FMT_FLAG_ZERO) != 0) && ((Copy_Flags & FMT_FLAG_LEFT) == 0))
+    {
+        Local_Pad = '0';
+        if (*Copy_pText == '-')
+        {
+            FMT_Put(Copy_pOutput, '-');
+            Copy_pText++;
+            Local_Length--;
+            if (Copy_Width != 0)
+            {
+                Copy_Width--;
+            }
+        }
+    }
+
+    if ((Copy_Flags & FMT_FLAG_LEFT) == 0)
+    {
+        while (Copy_Width > Local_Length)
+        {
+            FMT_Put(Copy_pOutput, Local_Pad);
+            Copy_Width--;
+        }
+    }
+
+    for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+    {
+        FMT_Put(Copy_pOutput, Copy_pText[Local_Index]);
+    }
+
+    while (Copy_Width > Local_Length)
+    {
+        FMT_Put(Copy_pOutput, ' ');
+        Copy_Width--;
+    }
+}
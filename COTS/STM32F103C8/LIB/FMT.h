@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file         FMT.h
+  * @company      DevLeague
+  * @date         19 Oct 2026
+  * @version      0.2
+  * @brief        Allocation-free number and string formatting.
+  *
+  * This file provides integer, hexadecimal and fixed-point conversions that
+  * avoid hardware division and floating point, and a small printf subset built
+  * on them for the LCD, TFT and UART drivers. Every function writes into a
+  * caller buffer and null-terminates it.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 DevLeague.
+  * All rights reserved.
+  *
+  * This software is licensed under the terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef FMT_H_
+#define FMT_H_
+
+/**< Variable argument lists for FMT_VFormat */
+#include <stdarg.h>
+
+/**< Buffer size that holds any 32-bit decimal number: sign, 10 digits and the terminator */
+#define FMT_DEC_BUFFER_SIZE     12
+
+/**< Buffer size that holds any 32-bit hexadecimal number: 8 digits and the terminator */
+#define FMT_HEX_BUFFER_SIZE     9
+
+/**< Largest number of fraction bits accepted by FMT_FixedToDec */
+#define FMT_FIXED_MAX_FRAC_BITS 28
+
+/**
+ * @brief Converts an unsigned integer to decimal.
+ *
+ * Digits are produced by multiplying with the reciprocal of 10, so no division instruction is used.
+ *
+ * @param[out] Copy_pBuffer Receives the digits; at least FMT_DEC_BUFFER_SIZE bytes.
+ * @param[in] Copy_Value The value.
+ * @return The number of characters written, excluding the terminator.
+ */
+u8 FMT_U32ToDec(char *Copy_pBuffer, u32 Copy_Value);
+
+/**
+ * @brief Converts a signed integer to decimal, with a leading '-' when negative.
+ *
+ * @param[out] Copy_pBuffer Receives the text; at least FMT_DEC_BUFFER_SIZE bytes.
+ * @param[in] Copy_Value The value.
+ * @return The number of characters written, excluding the terminator.
+ */
+u8 FMT_S32ToDec(char *Copy_pBuffer, s32 Copy_Value);
+
+/**
+ * @brief Converts an unsigned integer to upper-case hexadecimal.
+ *
+ * @param[out] Copy_pBuffer Receives the digits; at least FMT_HEX_BUFFER_SIZE bytes.
+ * @param[in] Copy_Value The value.
+ * @param[in] Copy_MinDigits Minimum number of digits, zero-padded (at most 8).
+ * @return The number of characters written, excluding the terminator.
+ */
+u8 FMT_U32ToHex(char *Copy_pBuffer, u32 Copy_Value, u8 Copy_MinDigits);
+
+/**
+ * @brief Converts a signed fixed-point (Q format) number to decimal.
+ *
+ * The value is Copy_Value / 2^Copy_FracBits, e.g. Q16.16 with Copy_FracBits = 16. The fraction is
+ * truncated to Copy_Decimals digits.
+ *
+ * @param[out] Copy_pBuffer Receives the text; at least FMT_DEC_BUFFER_SIZE + Copy_Decimals + 1 bytes.
+ * @param[in] Copy_Value The fixed-point value.
+ * @param[in] Copy_FracBits Number of fraction bits (0 to FMT_FIXED_MAX_FRAC_BITS).
+ * @param[in] Copy_Decimals Number of decimal places (0 for none, no decimal point).
+ * @return The number of characters written, excluding the terminator, or 0 if Copy_FracBits is out of range.
+ */
+u8 FMT_FixedToDec(char *Copy_pBuffer, s32 Copy_Value, u8 Copy_FracBits, u8 Copy_Decimals);
+
+/**
+ * @brief Formats a string into a buffer (printf subset).
+ *
+ * Supported conversions: %d %i %u %x %X %c %s %% and %q, a Q16.16 fixed-point argument (s32).
+ * Flags '-' (left-justify) and '0' (zero-pad), a field width and a precision are accepted:
+ * for %q the precision is the number of decimal places (default 3), for %s the largest number
+ * of characters taken from the string (all of it when none is given); 'l' length modifiers
+ * are accepted and ignored because int and long are both 32-bit. Output beyond the buffer is
+ * dropped.
+ *
+ * @param[out] Copy_pBuffer Receives the text, always null-terminated.
+ * @param[in] Copy_Size Size of the buffer in bytes (must not be 0).
+ * @param[in] Copy_pFormat The format string.
+ * @return The number of characters written, excluding the terminator.
+ */
+u16 FMT_Format(char *Copy_pBuffer, u16 Copy_Size, const char *Copy_pFormat, ...);
+
+/**
+ * @brief Formats a string into a buffer from a variable argument list.
+ *
+ * @see FMT_Format
+ *
+ * @param[out] Copy_pBuffer Receives the text, always null-terminated.
+ * @param[in] Copy_Size Size of the buffer in bytes (must not be 0).
+ * @param[in] Copy_pFormat The format string.
+ * @param[in] Copy_Args The arguments.
+ * @return The number of characters written, excluding the terminator.
+ */
+u16 FMT_VFormat(char *Copy_pBuffer, u16 Copy_Size, const char *Copy_pFormat, va_list Copy_Args);
+
+#endif /* FMT_H_ */
@@ -3,7 +3,7 @@
   * @file         STD_TYPES.h
   * @company      DevLeague
   * @date         26 August 2023
-  * @version      0.3
+  * @version      0.4
   * @brief        Standard type definitions for fixed-size data types.
   *
   * This file provides standard type definitions for unsigned and signed
@@ -59,5 +59,25 @@ typedef s8 INVALID_VALUE;
 #define E_NOT_OK        ((Std_ReturnType)0)       /**< Function execution failed */
 #define E_INVALID_PARAMETER  ((INVALID_VALUE)-1)  /**< Invalid parameter marker */
 
+/**
+ * @brief Place a function in SRAM.
+ *
+ * The function goes to the .ramfunc section, which the scatter file (LIB/STM32F103C8.sct) places
+ * in the RAM execution region, so the startup code copies it there with the initialised data.
+ * Code that runs while the flash is erased or programmed must not be fetched from the flash,
+ * otherwise the CPU stalls until the operation ends.
+ *
+ * With GNU ld, add the section to the .data output section:
+ * @code
+ *   .data : { _sdata = .; *(.data*) *(.ramfunc*) _edata = .; } > RAM AT > FLASH
+ * @endcode
+ *
+ * Calls between flash and SRAM are out of branch range; both linkers insert veneers.
+ * Define RAMFUNC as empty before this header to keep everything in flash.
+ */
+#ifndef RAMFUNC
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+#endif
+
 #endif /* STD_TYPES_H_ */
 
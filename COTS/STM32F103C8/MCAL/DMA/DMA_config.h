@@ -0,0 +1,12 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DMA_config.h               *****************/
+/****************************************************************/
+#ifndef DMA_CONFIG_H_
+#define DMA_CONFIG_H_
+
+/**< Channels are configured at runtime by the drivers that own them (see MCAL_DMA_ConfigureChannel) */
+
+#endif /**< DMA_CONFIG_H_ */
@@ -0,0 +1,133 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DMA_interface.h            *****************/
+/****************************************************************/
+#ifndef DMA_INTERFACE_H_
+#define DMA_INTERFACE_H_
+
+/**
+ * @defgroup DMA_Channels DMA1 Channels
+ * @brief Channel numbers of DMA1. The peripheral requests are fixed per channel, e.g. channel 6 is
+ *        I2C1_TX and channel 7 is I2C1_RX.
+ * @{
+ */
+#define DMA_CHANNEL1            0
+#define DMA_CHANNEL2            1
+#define DMA_CHANNEL3            2
+#define DMA_CHANNEL4            3
+#define DMA_CHANNEL5            4
+#define DMA_CHANNEL6            5
+#define DMA_CHANNEL7            6
+/** @} */
+
+/**
+ * @defgroup DMA_Direction DMA Transfer Direction
+ * @{
+ */
+#define DMA_DIR_PERIPH_TO_MEM   0   /**< Read from the peripheral register into memory */
+#define DMA_DIR_MEM_TO_PERIPH   1   /**< Write memory to the peripheral register */
+/** @} */
+
+/**
+ * @defgroup DMA_Size DMA Data Size
+ * @{
+ */
+#define DMA_SIZE_8BIT           0
+#define DMA_SIZE_16BIT          1
+#define DMA_SIZE_32BIT          2
+/** @} */
+
+/**
+ * @defgroup DMA_Priority DMA Channel Priority
+ * @{
+ */
+#define DMA_PRIORITY_LOW        0
+#define DMA_PRIORITY_MEDIUM     1
+#define DMA_PRIORITY_HIGH       2
+#define DMA_PRIORITY_VERY_HIGH  3
+/** @} */
+
+/**
+ * @defgroup DMA_Events DMA Callback Events
+ * @{
+ */
+#define DMA_EVENT_COMPLETE      0   /**< The last item was transferred */
+#define DMA_EVENT_HALF          1   /**< Half of the items were transferred */
+#define DMA_EVENT_ERROR         2   /**< Bus error; the channel has been disabled by hardware */
+/** @} */
+
+/**
+ * @brief Type Definition for the DMA channel callback.
+ *
+ * Called from the channel interrupt with one of the DMA callback events.
+ */
+typedef void (*DMA_CallbackFunc_t)(u8 Copy_Event);
+
+/**
+ * @brief Configuration of one DMA1 channel.
+ */
+typedef struct
+{
+    u8 Direction;           /**< DMA_DIR_PERIPH_TO_MEM or DMA_DIR_MEM_TO_PERIPH */
+    u8 PeripheralSize;      /**< Peripheral data size (DMA_SIZE_x) */
+    u8 MemorySize;          /**< Memory data size (DMA_SIZE_x) */
+    u8 Priority;            /**< DMA_PRIORITY_x */
+    u8 MemoryIncrement;     /**< 1 to advance the memory address after each item */
+    u8 Circular;            /**< 1 to reload the count and restart at the end */
+    u8 HalfTransferIrq;     /**< 1 to also report DMA_EVENT_HALF */
+} DMA_ChannelConfig_t;
+
+/**
+ * @brief Configure a DMA1 channel and install its callback.
+ *
+ * The channel is left disabled. The transfer complete and error interrupts are enabled when a
+ * callback is given; the channel's NVIC line (NVIC_DMA1_Channelx_IRQn) must be enabled separately.
+ *
+ * @param[in] Copy_Channel The channel (DMA_CHANNELx).
+ * @param[in] Copy_pConfig The channel configuration.
+ * @param[in] Copy_pfCallback The callback, or NULL to run without interrupts.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid channel or a NULL configuration.
+ *
+ * @note The driver manages the DMA1 clock (RCC_AHBENR_DMA1EN) itself: it runs while a channel is
+ *       configured or transferring, and is gated otherwise.
+ */
+Std_ReturnType MCAL_DMA_ConfigureChannel(u8 Copy_Channel, const DMA_ChannelConfig_t *Copy_pConfig, DMA_CallbackFunc_t Copy_pfCallback);
+
+/**
+ * @brief Program the addresses and count of a configured channel and enable it.
+ *
+ * @param[in] Copy_Channel The channel (DMA_CHANNELx).
+ * @param[in] Copy_PeripheralAddress Address of the peripheral data register.
+ * @param[in] Copy_pMemory The memory buffer.
+ * @param[in] Copy_Count Number of items to transfer (1..65535).
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid channel, a NULL buffer or a zero count.
+ *
+ * @note The DMA1 clock is held from here until the transfer completes or fails (reported by the
+ *       interrupts of a channel with a callback), or until MCAL_DMA_Stop. A circular channel, or
+ *       one without a callback, holds it until MCAL_DMA_Stop.
+ */
+Std_ReturnType MCAL_DMA_Start(u8 Copy_Channel, u32 Copy_PeripheralAddress, const volatile void *Copy_pMemory, u16 Copy_Count);
+
+/**
+ * @brief Disable a channel and clear its pending flags.
+ *
+ * @param[in] Copy_Channel The channel (DMA_CHANNELx).
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid channel.
+ */
+Std_ReturnType MCAL_DMA_Stop(u8 Copy_Channel);
+
+/**
+ * @brief Read the number of items a channel still has to transfer.
+ *
+ * @param[in] Copy_Channel The channel (DMA_CHANNELx).
+ *
+ * @return The remaining count, or 0 for an invalid channel.
+ */
+u16 MCAL_DMA_GetRemaining(u8 Copy_Channel);
+
+#endif /**< DMA_INTERFACE_H_ */
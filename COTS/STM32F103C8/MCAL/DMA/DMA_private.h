@@ -0,0 +1,69 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : DMA_private.h              *****************/
+/****************************************************************/
+#ifndef DMA_PRIVATE_H_
+#define DMA_PRIVATE_H_
+
+/*****************************< Register Definitions *****************************/
+#define DMA1_BASE_ADDRESS       0x40020000 /**< DMA1 Peripheral Base Address */
+
+/**
+ * @brief DMA channel register block.
+ */
+typedef struct
+{
+    volatile u32 CCR;       /**< Channel configuration register */
+    volatile u32 CNDTR;     /**< Channel number of data register */
+    volatile u32 CPAR;      /**< Channel peripheral address register */
+    volatile u32 CMAR;      /**< Channel memory address register */
+    volatile u32 RESERVED;
+} DMA_Channel_RegDef_t;
+
+/**
+ * @brief DMA register definition structure.
+ */
+typedef struct
+{
+    volatile u32 ISR;                       /**< Interrupt status register */
+    volatile u32 IFCR;                      /**< Interrupt flag clear register */
+    DMA_Channel_RegDef_t CHANNEL[7];        /**< Channels 1..7 */
+} DMA_RegDef_t;
+
+#define DMA1    ((DMA_RegDef_t *)DMA1_BASE_ADDRESS)
+
+/*****************************< The following are defines for the bit fields in the DMA registers. *****************************/
+/**< ISR/IFCR: four flags per channel, at bit 4 x channel */
+#define DMA_FLAG_GIF            0x1U    /**< Global interrupt */
+#define DMA_FLAG_TCIF           0x2U    /**< Transfer complete */
+#define DMA_FLAG_HTIF           0x4U    /**< Half transfer */
+#define DMA_FLAG_TEIF           0x8U    /**< Transfer error */
+#define DMA_FLAG_ALL            0xFU
+#define DMA_FLAGS_SHIFT(CH)     ((CH) * 4U)
+
+/**< CCR */
+#define DMA_CCR_EN              0x00000001U /**< Channel enable */
+#define DMA_CCR_TCIE            0x00000002U /**< Transfer complete interrupt enable */
+#define DMA_CCR_HTIE            0x00000004U /**< Half transfer interrupt enable */
+#define DMA_CCR_TEIE            0x00000008U /**< Transfer error interrupt enable */
+#define DMA_CCR_DIR             0x00000010U /**< Read from memory */
+#define DMA_CCR_CIRC            0x00000020U /**< Circular mode */
+#define DMA_CCR_PINC            0x00000040U /**< Peripheral increment mode */
+#define DMA_CCR_MINC            0x00000080U /**< Memory increment mode */
+#define DMA_CCR_PSIZE_POS       8           /**< Peripheral size */
+#define DMA_CCR_MSIZE_POS       10          /**< Memory size */
+#define DMA_CCR_PL_POS          12          /**< Channel priority level */
+
+#define DMA_CHANNEL_COUNT       7
+
+/*****************************< Private Functions *****************************/
+/**
+ * @brief Acknowledge the flags of a channel and call its callback.
+ *
+ * @param[in] Copy_Channel The channel whose interrupt fired.
+ */
+static void DMA_Dispatch(u8 Copy_Channel);
+
+#endif /**< DMA_PRIVATE_H_ */
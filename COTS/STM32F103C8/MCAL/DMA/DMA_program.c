@@ -0,0 +1,231 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DMA_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RCC_interface.h"
+#include "SCB_interface.h"
+#include "DMA_interface.h"
+#include "DMA_config.h"
+#include "DMA_private.h"
+/*****************************< Global Variable Section *****************************/
+static DMA_CallbackFunc_t DMA_Callback[DMA_CHANNEL_COUNT] = {NULL};
+static u8 DMA_ActiveChannels = 0;   /**< Bit i set while channel i holds the DMA1 clock */
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_DMA_ConfigureChannel(u8 Copy_Channel, const DMA_ChannelConfig_t *Copy_pConfig, DMA_CallbackFunc_t Copy_pfCallback)
+{
+    u32 Local_CCR;
+
+    if ((Copy_Channel >= DMA_CHANNEL_COUNT) || (Copy_pConfig == NULL))
+    {
+        return E_NOT_OK;
+    }
+
+    MCAL_RCC_AcquirePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+
+    /**< CCR may only be changed while the channel is disabled */
+    DMA1->CHANNEL[Copy_Channel].CCR = 0;
+    DMA1->IFCR = DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel);
+
+    Local_CCR = ((u32)(Copy_pConfig->PeripheralSize & 0x3U) << DMA_CCR_PSIZE_POS) |
+                ((u32)(Copy_pConfig->MemorySize & 0x3U) << DMA_CCR_MSIZE_POS) |
+                ((u32)(Copy_pConfig->Priority & 0x3U) << DMA_CCR_PL_POS);
+
+    if (Copy_pConfig->Direction == DMA_DIR_MEM_TO_PERIPH)
+    {
+        Local_CCR |= DMA_CCR_DIR;
+    }
+    if (Copy_pConfig->MemoryIncrement != 0)
+    {
+        Local_CCR |= DMA_CCR_MINC;
+    }
+    if (Copy_pConfig->Circular != 0)
+    {
+        Local_CCR |= DMA_CCR_CIRC;
+    }
+    if (Copy_pfCallback != NULL)
+    {
+        Local_CCR |= DMA_CCR_TCIE | DMA_CCR_TEIE;
+        if (Copy_pConfig->HalfTransferIrq != 0)
+        {
+            Local_CCR |= DMA_CCR_HTIE;
+        }
+    }
+
+    DMA_Callback[Copy_Channel] = Copy_pfCallback;
+    DMA1->CHANNEL[Copy_Channel].CCR = Local_CCR;
+
+    MCAL_RCC_ReleasePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_Start(u8 Copy_Channel, u32 Copy_PeripheralAddress, const volatile void *Copy_pMemory, u16 Copy_Count)
+{
+    DMA_Channel_RegDef_t *Local_pChannel;
+    u32 Local_PrimaskState;
+
+    if ((Copy_Channel >= DMA_CHANNEL_COUNT) || (Copy_pMemory == NULL) || (Copy_Count == 0))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_pChannel = &DMA1->CHANNEL[Copy_Channel];
+
+    /**< The DMA1 clock runs until the transfer ends (complete or error interrupt) or the channel is stopped */
+    Local_PrimaskState = SCB_EnterCriticalSection();
+    if (GET_BIT(DMA_ActiveChannels, Copy_Channel) == 0)
+    {
+        SET_BIT(DMA_ActiveChannels, Copy_Channel);
+        MCAL_RCC_AcquirePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+    }
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    /**< Addresses and count are latched at enable; they cannot be changed while the channel runs */
+    Local_pChannel->CCR &= ~DMA_CCR_EN;
+    DMA1->IFCR = DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel);
+    Local_pChannel->CPAR = Copy_PeripheralAddress;
+    Local_pChannel->CMAR = (u32)Copy_pMemory;
+    Local_pChannel->CNDTR = Copy_Count;
+    Local_pChannel->CCR |= DMA_CCR_EN;
+
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_Stop(u8 Copy_Channel)
+{
+    u32 Local_PrimaskState;
+
+    if (Copy_Channel >= DMA_CHANNEL_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    /**< A channel that already ended has given the clock back; its registers only need the clock here */
+    if (GET_BIT(DMA_ActiveChannels, Copy_Channel) == 0)
+    {
+        MCAL_RCC_AcquirePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+    }
+    CLR_BIT(DMA_ActiveChannels, Copy_Channel);
+
+    DMA1->CHANNEL[Copy_Channel].CCR &= ~DMA_CCR_EN;
+    DMA1->IFCR = DMA_FLAG_ALL << DMA_FLAGS_SHIFT(Copy_Channel);
+
+    MCAL_RCC_ReleasePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    return E_OK;
+}
+
+u16 MCAL_DMA_GetRemaining(u8 Copy_Channel)
+{
+    u16 Local_Remaining;
+
+    if (Copy_Channel >= DMA_CHANNEL_COUNT)
+    {
+        return 0;
+    }
+
+    MCAL_RCC_AcquirePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+    Local_Remaining = (u16)DMA1->CHANNEL[Copy_Channel].CNDTR;
+    MCAL_RCC_ReleasePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+
+    return Local_Remaining;
+}
+
+/** @addtogroup DMA_ISRs
+  * @brief DMA1 Channel[x] Interrupt Service Routine (ISR).
+  * @{
+  */
+
+void DMA1_Channel1_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL1);
+}
+
+void DMA1_Channel2_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL2);
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL3);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL4);
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL5);
+}
+
+void DMA1_Channel6_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL6);
+}
+
+void DMA1_Channel7_IRQHandler(void)
+{
+    DMA_Dispatch(DMA_CHANNEL7);
+}
+
+/**
+  * @} (End of DMA_ISRs)
+  */
+/*****************************< Private Functions *****************************/
+static void DMA_Dispatch(u8 Copy_Channel)
+{
+    u32 Local_Flags = (DMA1->ISR >> DMA_FLAGS_SHIFT(Copy_Channel)) & DMA_FLAG_ALL;
+    u8 Local_Ended = 0;
+
+    /**< IFCR is write-one-to-clear: acknowledge exactly what is handled */
+    DMA1->IFCR = Local_Flags << DMA_FLAGS_SHIFT(Copy_Channel);
+
+    /**< An error, or the completion of a normal (not circular) transfer, ends the transfer */
+    if ((Local_Flags & DMA_FLAG_TEIF) ||
+        ((Local_Flags & DMA_FLAG_TCIF) && ((DMA1->CHANNEL[Copy_Channel].CCR & DMA_CCR_CIRC) == 0)))
+    {
+        Local_Ended = GET_BIT(DMA_ActiveChannels, Copy_Channel);
+        CLR_BIT(DMA_ActiveChannels, Copy_Channel);
+    }
+
+    if (DMA_Callback[Copy_Channel] != NULL)
+    {
+        /**< An error disables the channel, so it is reported instead of completion */
+        if (Local_Flags & DMA_FLAG_TEIF)
+        {
+            DMA_Callback[Copy_Channel](DMA_EVENT_ERROR);
+        }
+        else
+        {
+            if (Local_Flags & DMA_FLAG_HTIF)
+            {
+                DMA_Callback[Copy_Channel](DMA_EVENT_HALF);
+            }
+            if (Local_Flags & DMA_FLAG_TCIF)
+            {
+                DMA_Callback[Copy_Channel](DMA_EVENT_COMPLETE);
+            }
+        }
+    }
+
+    /**< After the callback, so a callback that starts the next transfer keeps the clock running */
+    if (Local_Ended != 0)
+    {
+        MCAL_RCC_ReleasePeripheral(RCC_AHB, RCC_AHBENR_DMA1EN);
+    }
+}
+/*****************************< End of Function Implementations *****************************/
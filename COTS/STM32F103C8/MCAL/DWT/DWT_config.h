@@ -0,0 +1,12 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DWT_config.h               *****************/
+/****************************************************************/
+#ifndef DWT_CONFIG_H_
+#define DWT_CONFIG_H_
+
+/**< The core clock is taken from RCC (MCAL_RCC_GetHclk), nothing to configure here */
+
+#endif /**< DWT_CONFIG_H_ */
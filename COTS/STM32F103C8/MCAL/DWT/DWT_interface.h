@@ -0,0 +1,67 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DWT_interface.h            *****************/
+/****************************************************************/
+#ifndef DWT_INTERFACE_H_
+#define DWT_INTERFACE_H_
+
+/**
+ * @brief Enable the DWT cycle counter.
+ *
+ * This function enables the trace block (DEMCR.TRCENA), then clears and starts CYCCNT if it is
+ * not already running, so it is safe to call from every driver that needs timestamps.
+ * CYCCNT then counts core clock cycles and wraps every 2^32 cycles (about 59 s at 72 MHz).
+ *
+ * @return None
+ *
+ * @note Compute intervals as (End - Start) on u32 values; the subtraction stays correct across one wrap.
+ */
+void MCAL_DWT_Init(void);
+
+/**
+ * @brief Read the DWT cycle counter.
+ *
+ * @return The current CYCCNT value.
+ */
+u32 MCAL_DWT_GetCycles(void);
+
+/**
+ * @brief Busy-wait for a number of core clock cycles.
+ *
+ * Unlike the SysTick delays, this does not touch any timer configuration, so it can be used
+ * while the SysTick drives the software timers.
+ *
+ * @param[in] Copy_Cycles The number of cycles to wait.
+ *
+ * @return None
+ *
+ * @note MCAL_DWT_Init must have been called.
+ */
+void MCAL_DWT_DelayCycles(u32 Copy_Cycles);
+
+/**
+ * @brief Convert microseconds to core clock cycles at the current HCLK.
+ *
+ * Drivers compute their time-outs with this when they start waiting, so the time-outs stay right
+ * after a clock profile change.
+ *
+ * @param[in] Copy_Microseconds The number of microseconds.
+ *
+ * @return The number of cycles.
+ */
+u32 MCAL_DWT_UsToCycles(u32 Copy_Microseconds);
+
+/**
+ * @brief Busy-wait for a number of microseconds.
+ *
+ * @param[in] Copy_Microseconds The number of microseconds to wait.
+ *
+ * @return None
+ *
+ * @note The conversion uses the HCLK frequency reported by MCAL_RCC_GetHclk.
+ */
+void MCAL_DWT_DelayUs(u32 Copy_Microseconds);
+
+#endif /**< DWT_INTERFACE_H_ */
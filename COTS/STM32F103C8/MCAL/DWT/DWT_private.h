@@ -0,0 +1,25 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DWT_private.h              *****************/
+/****************************************************************/
+#ifndef DWT_PRIVATE_H_
+#define DWT_PRIVATE_H_
+
+/*****************************< Register Definitions *****************************/
+#define DWT_BASE_ADDRESS        0xE0001000U
+
+#define DWT_CTRL                (*((volatile u32 *)(DWT_BASE_ADDRESS + 0x00))) /**< DWT Control Register */
+#define DWT_CYCCNT              (*((volatile u32 *)(DWT_BASE_ADDRESS + 0x04))) /**< DWT Cycle Count Register */
+
+#define DWT_DEMCR               (*((volatile u32 *)0xE000EDFCU))               /**< Debug Exception and Monitor Control Register */
+
+/*****************************< The following are defines for the bit fields in the DWT registers. *****************************/
+#define DWT_CTRL_CYCCNTENA      0x00000001U     /**< Bit 0 : Cycle counter enable */
+#define DWT_DEMCR_TRCENA        0x01000000U     /**< Bit 24: Trace (DWT/ITM) enable */
+
+/**< Core clock cycles per microsecond */
+#define DWT_CYCLES_PER_US       (MCAL_RCC_GetHclk() / 1000000UL)
+
+#endif /**< DWT_PRIVATE_H_ */
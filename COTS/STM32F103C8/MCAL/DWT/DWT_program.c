@@ -0,0 +1,54 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : DWT_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RCC_interface.h"
+#include "DWT_interface.h"
+#include "DWT_config.h"
+#include "DWT_private.h"
+/*****************************< Function Implementations *****************************/
+void MCAL_DWT_Init(void)
+{
+    /**< The DWT is only clocked while the trace block is enabled */
+    DWT_DEMCR |= DWT_DEMCR_TRCENA;
+
+    /**< Leave a running counter alone so several drivers can call this without disturbing each other */
+    if ((DWT_CTRL & DWT_CTRL_CYCCNTENA) == 0)
+    {
+        DWT_CYCCNT = 0;
+        DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+    }
+}
+
+RAMFUNC u32 MCAL_DWT_GetCycles(void)
+{
+    return DWT_CYCCNT;
+}
+
+void MCAL_DWT_DelayCycles(u32 Copy_Cycles)
+{
+    u32 Local_Start = DWT_CYCCNT;
+
+    /**< Unsigned subtraction keeps the comparison valid across a counter wrap */
+    while ((DWT_CYCCNT - Local_Start) < Copy_Cycles)
+    {
+    }
+}
+
+u32 MCAL_DWT_UsToCycles(u32 Copy_Microseconds)
+{
+    return Copy_Microseconds * DWT_CYCLES_PER_US;
+}
+
+void MCAL_DWT_DelayUs(u32 Copy_Microseconds)
+{
+    MCAL_DWT_DelayCycles(MCAL_DWT_UsToCycles(Copy_Microseconds));
+}
+/*****************************< End of Function Implementations *****************************/
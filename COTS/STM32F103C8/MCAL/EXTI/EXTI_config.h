@@ -7,6 +7,18 @@
 #ifndef EXTI_CONFIG_H_
 #define EXTI_CONFIG_H_
 
+/**
+ * @brief Number of EXTI lines that can be in capture mode at the same time.
+ */
+#define EXTI_CAPTURE_CHANNELS       2
+
+/**
+ * @brief Number of events buffered per capture line.
+ *
+ * Must be a power of two. Size it for the edges that arrive between two reads.
+ */
+#define EXTI_CAPTURE_FIFO_SIZE      32
+
 /**
  * @brief EXTI Configuration Array
  *
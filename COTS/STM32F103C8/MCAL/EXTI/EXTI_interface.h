@@ -66,6 +66,18 @@ typedef void (*EXTI_CallbackFunc_t)(void);
 #define EXTI_LINE15 15  /**< EXTI line number for GPIO pin 15. */
 /** @} */
 
+/**
+ * @brief Edge Capture Event
+ *
+ * One entry of a capture FIFO. Edge holds EXTI_RISING_EDGE or EXTI_FALLING_EDGE.
+ */
+typedef struct
+{
+    u32 Timestamp;  /**< DWT cycle counter value taken on entry to the EXTI interrupt */
+    u8 Line;        /**< EXTI line of the edge */
+    u8 Edge;        /**< EXTI_RISING_EDGE or EXTI_FALLING_EDGE */
+} EXTI_CaptureEvent_t;
+
 /** @} */  // EXTI_Configurations
 
 /**
@@ -139,6 +151,20 @@ Std_ReturnType MCAL_EXTI_EnableLine(u8 Copy_Line);
  */
 Std_ReturnType MCAL_EXTI_DisableLine(u8 Copy_Line);
 
+/**
+ * @brief Clear the pending flag of an external interrupt line.
+ *
+ * The pending flag latches edges even while the line is disabled, so a driver that masks a
+ * line for a while clears it before enabling the line again to avoid a stale interrupt.
+ *
+ * @param[in] Copy_Line The external interrupt line to clear.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Pending flag cleared.
+ *   - E_NOT_OK : An error occurred (invalid interrupt line).
+ */
+Std_ReturnType MCAL_EXTI_ClearPending(u8 Copy_Line);
+
 /**
  * @brief Set the trigger mode for an external interrupt line.
  *
@@ -180,6 +206,57 @@ Std_ReturnType MCAL_EXTI_SetTrigger(u8 Copy_Line, u8 Copy_Mode);
   */
 Std_ReturnType MCAL_EXTI_SetCallback(u8 Copy_Line , EXTI_CallbackFunc_t CallbackFunc);
 
+/**
+ * @brief Put an EXTI line in capture mode.
+ *
+ * In capture mode the interrupt handler does not call the line's callback. It stamps each edge
+ * with the DWT cycle counter and pushes it into a FIFO owned by the line. The task context then
+ * drains the FIFO in batches with MCAL_EXTI_ReadCaptureEvents. The FIFO is lock-free: the
+ * handler only writes its head and the reader only writes its tail.
+ *
+ * @param[in] Copy_Line     The EXTI line (0 to 15). Its trigger and GPIO mapping are set as usual.
+ * @param[in] Copy_GPIO_Port The GPIO port of the line (GPIO_PORTA .. GPIO_PORTC). The pin level is
+ *                          sampled to tell the edge apart when the line triggers on both edges.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : The line is in capture mode with an empty FIFO.
+ *   - E_NOT_OK : Invalid line or port, or all EXTI_CAPTURE_CHANNELS FIFOs are in use.
+ *
+ * @note This function enables the DWT cycle counter if it is not already running.
+ */
+Std_ReturnType MCAL_EXTI_EnableCapture(u8 Copy_Line, u8 Copy_GPIO_Port);
+
+/**
+ * @brief Leave capture mode and release the line's FIFO.
+ *
+ * @param[in] Copy_Line The EXTI line (0 to 15).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : The line is back in callback mode.
+ *   - E_NOT_OK : Invalid line or the line is not in capture mode.
+ */
+Std_ReturnType MCAL_EXTI_DisableCapture(u8 Copy_Line);
+
+/**
+ * @brief Drain captured edges of a line.
+ *
+ * @param[in]  Copy_Line      The EXTI line (0 to 15).
+ * @param[out] Copy_pEvents   Buffer receiving the events, oldest first.
+ * @param[in]  Copy_MaxEvents Capacity of Copy_pEvents.
+ *
+ * @return The number of events copied (0 when the FIFO is empty or the parameters are invalid).
+ */
+u16 MCAL_EXTI_ReadCaptureEvents(u8 Copy_Line, EXTI_CaptureEvent_t *Copy_pEvents, u16 Copy_MaxEvents);
+
+/**
+ * @brief Get the number of edges dropped because the line's FIFO was full.
+ *
+ * @param[in] Copy_Line The EXTI line (0 to 15).
+ *
+ * @return The number of dropped edges since MCAL_EXTI_EnableCapture (0 for a line not in capture mode).
+ */
+u32 MCAL_EXTI_GetCaptureOverruns(u8 Copy_Line);
+
 /** @} */ // End of EXTI_Control
 
 
@@ -27,6 +27,13 @@ typedef struct
 /**< Total number of EXTI lines available */
 #define EXTI_LINES_COUNT        16
 
+/**< Lines sharing the EXTI9_5 and EXTI15_10 interrupt vectors */
+#define EXTI_LINES_9_5_MASK     0x000003E0U
+#define EXTI_LINES_15_10_MASK   0x0000FC00U
+
+/**< No line assigned to a capture FIFO */
+#define EXTI_CAPTURE_NO_LINE    0xFF
+
 /**< EXTI line enabled */
 #define EXTI_LINE_ENABLED       1
 
@@ -57,4 +64,44 @@ typedef struct
 /**< EXTI line configuration settings */
 extern EXTI_Configuration_t EXTI_Configurations[EXTI_LINES_COUNT];
 
+/**< Control block of one capture FIFO; the events live in EXTI_CaptureEvents */
+typedef struct
+{
+    volatile u16 Head;      /**< Free-running write index, written by the interrupt handler only */
+    volatile u16 Tail;      /**< Free-running read index, written by the reader only */
+    volatile u32 Overruns;  /**< Edges dropped because the FIFO was full */
+    u8 Line;                /**< Owning line, or EXTI_CAPTURE_NO_LINE */
+    u8 Port;                /**< GPIO port of the line */
+} EXTI_CaptureFifo_t;
+
+/**< Compiler barrier: keeps FIFO payload accesses on the right side of the index update */
+#define EXTI_COMPILER_BARRIER()     __asm volatile ("" : : : "memory")
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Dispatch the pending lines of an EXTI vector.
+ *
+ * Reads PR once, acknowledges all pending and enabled lines of the group with a single write,
+ * then walks the set bits with CLZ. Capture lines get an event; the others run their callback.
+ *
+ * @param[in] Copy_GroupMask The lines served by the vector (one line bit, EXTI_LINES_9_5_MASK or EXTI_LINES_15_10_MASK).
+ */
+static void EXTI_DispatchPending(u32 Copy_GroupMask);
+
+/**
+ * @brief Push one edge into the FIFO of a capture line.
+ *
+ * @param[in] Copy_Line The EXTI line in capture mode.
+ * @param[in] Copy_Timestamp The cycle count taken on entry to the interrupt.
+ */
+static void EXTI_CaptureEdge(u8 Copy_Line, u32 Copy_Timestamp);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
 #endif /**< EXTI_PRIVATE_H_ */
@@ -13,15 +13,38 @@
 #include "GPIO_interface.h"
 /**< AFIO */
 #include "AFIO_interface.h"
+/**< SCB */
+#include "SCB_interface.h"
+/**< DWT */
+#include "DWT_interface.h"
 /**< EXTI */
 #include "EXTI_interface.h"
 #include "EXTI_private.h"
 #include "EXTI_config.h"
 /*****************************< Global Variable Section *****************************/
 static EXTI_CallbackFunc_t EXTI_Callback[16] = {NULL};
+
+#if (EXTI_CAPTURE_FIFO_SIZE & (EXTI_CAPTURE_FIFO_SIZE - 1)) != 0
+#error "EXTI_CAPTURE_FIFO_SIZE must be a power of two."
+#endif
+
+/**< Lines in capture mode (bit n = line n) */
+static volatile u32 EXTI_CaptureMask = 0;
+
+/**< Capture FIFO index of each line, valid while its EXTI_CaptureMask bit is set */
+static u8 EXTI_CaptureSlot[16];
+
+/**< Capture FIFOs */
+static EXTI_CaptureFifo_t EXTI_CaptureFifos[EXTI_CAPTURE_CHANNELS];
+static EXTI_CaptureEvent_t EXTI_CaptureEvents[EXTI_CAPTURE_CHANNELS][EXTI_CAPTURE_FIFO_SIZE];
 /*****************************< Function Implementations *****************************/
 void MCAL_EXTI_vInit(void)
 {
+    for (u8 Slot = 0; Slot < EXTI_CAPTURE_CHANNELS; Slot++)
+    {
+        EXTI_CaptureFifos[Slot].Line = EXTI_CAPTURE_NO_LINE;
+    }
+
     for (u8 Line = 0; Line < EXTI_LINES_COUNT; Line++)
     {
         if (EXTI_Configurations[Line].LineEnabled == EXTI_LINE_ENABLED)
@@ -142,6 +165,20 @@ Std_ReturnType MCAL_EXTI_DisableLine(u8 Copy_Line)
     return Local_FunctionStatus;
 }
 
+Std_ReturnType MCAL_EXTI_ClearPending(u8 Copy_Line)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if(Copy_Line < EXTI_LINES_COUNT)
+    {
+        /**< PR is write-one-to-clear: writing the line's bit alone leaves the other lines untouched */
+        EXTI->PR = (1UL << Copy_Line);
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
 Std_ReturnType MCAL_EXTI_SetTrigger(u8 Copy_Line, u8 Copy_Mode)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
@@ -185,8 +222,8 @@ Std_ReturnType MCAL_EXTI_SetCallback(u8 Copy_Line , EXTI_CallbackFunc_t Callback
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
-    /**< Check if the provided callback function is NULL */ 
-    if (NULL == CallbackFunc)
+    /**< Check if the provided callback function is NULL or the line is out of range */ 
+    if ((NULL == CallbackFunc) || (Copy_Line >= EXTI_LINES_COUNT))
     {
         /**< Return E_NOT_OK to indicate an invalid input */ 
         return Local_FunctionStatus;
@@ -201,144 +238,255 @@ Std_ReturnType MCAL_EXTI_SetCallback(u8 Copy_Line , EXTI_CallbackFunc_t Callback
     return Local_FunctionStatus;
 }
 
-/** @addtogroup EXTI_ISRs
-  * @brief EXTI Line[x] Interrupt Service Routine (ISR).
-  * @details This functions are called when an interrupt event occurs on EXTI Line[x].
-  *          You can customize this function to handle the specific interrupt event.
-  * @{
-  */
-
-void EXTI0_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_EnableCapture(u8 Copy_Line, u8 Copy_GPIO_Port)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    EXTI_CaptureFifo_t *Local_pFifo = NULL;
+    u32 Local_PrimaskState;
+    u8 Local_Slot;
+
+    if ((Copy_Line < EXTI_LINES_COUNT) && (Copy_GPIO_Port <= GPIO_PORTC))
     {
-        EXTI_Callback[EXTI_LINE0]();
+        MCAL_DWT_Init();
+
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        /**< Reuse the line's FIFO, or take a free one */
+        for (Local_Slot = 0; Local_Slot < EXTI_CAPTURE_CHANNELS; Local_Slot++)
+        {
+            if (EXTI_CaptureFifos[Local_Slot].Line == Copy_Line)
+            {
+                Local_pFifo = &EXTI_CaptureFifos[Local_Slot];
+                break;
+            }
+            if ((Local_pFifo == NULL) && (EXTI_CaptureFifos[Local_Slot].Line == EXTI_CAPTURE_NO_LINE))
+            {
+                Local_pFifo = &EXTI_CaptureFifos[Local_Slot];
+            }
+        }
+
+        if (Local_pFifo != NULL)
+        {
+            Local_pFifo->Head = 0;
+            Local_pFifo->Tail = 0;
+            Local_pFifo->Overruns = 0;
+            Local_pFifo->Line = Copy_Line;
+            Local_pFifo->Port = Copy_GPIO_Port;
+
+            EXTI_CaptureSlot[Copy_Line] = (u8)(Local_pFifo - EXTI_CaptureFifos);
+            EXTI_CaptureMask |= (1UL << Copy_Line);
+
+            Local_FunctionStatus = E_OK;
+        }
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
     }
+
+    return Local_FunctionStatus;
 }
 
-void EXTI1_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_DisableCapture(u8 Copy_Line)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if (Copy_Line < EXTI_LINES_COUNT)
     {
-        EXTI_Callback[EXTI_LINE1]();
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        if ((EXTI_CaptureMask & (1UL << Copy_Line)) != 0)
+        {
+            EXTI_CaptureMask &= ~(1UL << Copy_Line);
+            EXTI_CaptureFifos[EXTI_CaptureSlot[Copy_Line]].Line = EXTI_CAPTURE_NO_LINE;
+
+            Local_FunctionStatus = E_OK;
+        }
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
     }
+
+    return Local_FunctionStatus;
 }
 
-void EXTI2_IRQHandler(void)
+u16 MCAL_EXTI_ReadCaptureEvents(u8 Copy_Line, EXTI_CaptureEvent_t *Copy_pEvents, u16 Copy_MaxEvents)
 {
-    if (EXTI_Callback != NULL)
+    EXTI_CaptureFifo_t *Local_pFifo;
+    EXTI_CaptureEvent_t *Local_pEvents;
+    u16 Local_Tail;
+    u16 Local_Count;
+    u16 Local_Index;
+
+    if ((Copy_Line >= EXTI_LINES_COUNT) || (Copy_pEvents == NULL) || ((EXTI_CaptureMask & (1UL << Copy_Line)) == 0))
     {
-        EXTI_Callback[EXTI_LINE2]();
+        return 0;
     }
-}
 
-void EXTI3_IRQHandler(void)
-{
-    if (EXTI_Callback != NULL)
+    Local_pFifo = &EXTI_CaptureFifos[EXTI_CaptureSlot[Copy_Line]];
+    Local_pEvents = EXTI_CaptureEvents[EXTI_CaptureSlot[Copy_Line]];
+
+    /**< Snapshot the head once; events pushed meanwhile are left for the next read */
+    Local_Tail = Local_pFifo->Tail;
+    Local_Count = (u16)(Local_pFifo->Head - Local_Tail);
+    if (Local_Count > Copy_MaxEvents)
     {
-        EXTI_Callback[EXTI_LINE3]();
+        Local_Count = Copy_MaxEvents;
     }
-}
+    EXTI_COMPILER_BARRIER();
 
-void EXTI4_IRQHandler(void)
-{
-    if (EXTI_Callback != NULL)
+    for (Local_Index = 0; Local_Index < Local_Count; Local_Index++)
     {
-        EXTI_Callback[EXTI_LINE4]();
+        Copy_pEvents[Local_Index] = Local_pEvents[(u16)(Local_Tail + Local_Index) & (EXTI_CAPTURE_FIFO_SIZE - 1U)];
     }
+
+    /**< Release the slots only after they are copied */
+    EXTI_COMPILER_BARRIER();
+    Local_pFifo->Tail = (u16)(Local_Tail + Local_Count);
+
+    return Local_Count;
 }
 
-void EXTI5_IRQHandler(void)
+u32 MCAL_EXTI_GetCaptureOverruns(u8 Copy_Line)
 {
-    if (EXTI_Callback != NULL)
+    u32 Local_Overruns = 0;
+
+    if ((Copy_Line < EXTI_LINES_COUNT) && ((EXTI_CaptureMask & (1UL << Copy_Line)) != 0))
     {
-        EXTI_Callback[EXTI_LINE5]();
+        Local_Overruns = EXTI_CaptureFifos[EXTI_CaptureSlot[Copy_Line]].Overruns;
     }
+
+    return Local_Overruns;
 }
 
-void EXTI6_IRQHandler(void)
+/** @addtogroup EXTI_ISRs
+  * @brief EXTI Line[x] Interrupt Service Routine (ISR).
+  * @details This functions are called when an interrupt event occurs on EXTI Line[x].
+  *          You can customize this function to handle the specific interrupt event.
+  *          The handlers, the dispatch and the edge capture run from SRAM (RAMFUNC), so edges
+  *          are still timestamped while the flash is erased or programmed; callbacks of lines
+  *          that are not captured wait for the flash unless they are RAMFUNC too.
+  * @{
+  */
+
+RAMFUNC void EXTI0_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE6]();
-    }
+    EXTI_DispatchPending(1UL << EXTI_LINE0);
 }
 
-void EXTI7_IRQHandler(void)
+RAMFUNC void EXTI1_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE7]();
-    }
+    EXTI_DispatchPending(1UL << EXTI_LINE1);
 }
 
-void EXTI8_IRQHandler(void)
+RAMFUNC void EXTI2_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE8]();
-    }
+    EXTI_DispatchPending(1UL << EXTI_LINE2);
 }
 
-void EXTI9_IRQHandler(void)
+RAMFUNC void EXTI3_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE9]();
-    }
+    EXTI_DispatchPending(1UL << EXTI_LINE3);
 }
 
-void EXTI10_IRQHandler(void)
+RAMFUNC void EXTI4_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE10]();
-    }
+    EXTI_DispatchPending(1UL << EXTI_LINE4);
 }
 
-void EXTI11_IRQHandler(void)
+RAMFUNC void EXTI9_5_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE11]();
-    }
+    EXTI_DispatchPending(EXTI_LINES_9_5_MASK);
 }
 
-void EXTI12_IRQHandler(void)
+RAMFUNC void EXTI15_10_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE12]();
-    }
+    EXTI_DispatchPending(EXTI_LINES_15_10_MASK);
 }
 
-void EXTI13_IRQHandler(void)
+/**
+  * @} (End of EXTI_ISRs)
+  */
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+RAMFUNC static void EXTI_DispatchPending(u32 Copy_GroupMask)
 {
-    if (EXTI_Callback != NULL)
+    u32 Local_Timestamp = 0;
+    u32 Local_Pending;
+    u32 Local_LeadingZeros;
+    u8 Local_Line;
+
+    /**< Stamp first, so the timestamp is as close to the edge as possible */
+    if ((EXTI_CaptureMask & Copy_GroupMask) != 0)
     {
-        EXTI_Callback[EXTI_LINE13]();
+        Local_Timestamp = MCAL_DWT_GetCycles();
     }
-}
 
-void EXTI14_IRQHandler(void)
-{
-    if (EXTI_Callback != NULL)
+    Local_Pending = EXTI->PR & EXTI->IMR & Copy_GroupMask;
+
+    /**< PR is write-one-to-clear: acknowledge the whole batch with a single write */
+    EXTI->PR = Local_Pending;
+
+    while (Local_Pending != 0)
     {
-        EXTI_Callback[EXTI_LINE14]();
+        /**< Highest pending line first: Line = 31 - CLZ(Pending) */
+        __asm ("clz %0, %1" : "=r" (Local_LeadingZeros) : "r" (Local_Pending));
+        Local_Line = (u8)(31U - Local_LeadingZeros);
+        Local_Pending &= ~(1UL << Local_Line);
+
+        if ((EXTI_CaptureMask & (1UL << Local_Line)) != 0)
+        {
+            EXTI_CaptureEdge(Local_Line, Local_Timestamp);
+        }
+        else if (EXTI_Callback[Local_Line] != NULL)
+        {
+            EXTI_Callback[Local_Line]();
+        }
     }
 }
 
-void EXTI15_IRQHandler(void)
+RAMFUNC static void EXTI_CaptureEdge(u8 Copy_Line, u32 Copy_Timestamp)
 {
-    if (EXTI_Callback != NULL)
+    EXTI_CaptureFifo_t *Local_pFifo = &EXTI_CaptureFifos[EXTI_CaptureSlot[Copy_Line]];
+    EXTI_CaptureEvent_t *Local_pEvent;
+    u16 Local_Head = Local_pFifo->Head;
+    u8 Local_PinValue = GPIO_LOW;
+
+    if ((u16)(Local_Head - Local_pFifo->Tail) >= EXTI_CAPTURE_FIFO_SIZE)
+    {
+        Local_pFifo->Overruns++;
+        return;
+    }
+
+    Local_pEvent = &EXTI_CaptureEvents[EXTI_CaptureSlot[Copy_Line]][Local_Head & (EXTI_CAPTURE_FIFO_SIZE - 1U)];
+    Local_pEvent->Timestamp = Copy_Timestamp;
+    Local_pEvent->Line = Copy_Line;
+
+    /**< A single-edge trigger tells the edge; with both edges the pin level after the edge does */
+    if (GET_BIT(EXTI->FTSR, Copy_Line) == 0)
+    {
+        Local_pEvent->Edge = EXTI_RISING_EDGE;
+    }
+    else if (GET_BIT(EXTI->RTSR, Copy_Line) == 0)
+    {
+        Local_pEvent->Edge = EXTI_FALLING_EDGE;
+    }
+    else
     {
-        EXTI_Callback[EXTI_LINE15]();
+        MCAL_GPIO_GetPinValue(Local_pFifo->Port, Copy_Line, &Local_PinValue);
+        Local_pEvent->Edge = (Local_PinValue == GPIO_HIGH) ? EXTI_RISING_EDGE : EXTI_FALLING_EDGE;
     }
+
+    /**< Publish the event only after it is written */
+    EXTI_COMPILER_BARRIER();
+    Local_pFifo->Head = (u16)(Local_Head + 1U);
 }
 
 /**
-  * @} (End of EXTI_ISRs)
-  */
+ * @} (End of PrivateFunctions)
+ */
 
 /*****************************< End of Function Implementations *****************************/
 
@@ -7,5 +7,28 @@
 #ifndef FPEC_CONFIG_
 #define FPEC_CONFIG_
 
+/**
+ * @brief Flash page size in bytes: 1024 on low- and medium-density parts (STM32F103C8),
+ *        2048 on high-density parts.
+ */
+#define FPEC_PAGE_SIZE          1024UL
+
+/**
+ * @brief Flash size in bytes.
+ */
+#define FPEC_FLASH_SIZE         (64UL * 1024UL)
+
+/**
+ * @brief First page of the application area erased by FPEC_EraseAppArea (the pages below hold
+ *        the bootloader).
+ */
+#define FPEC_APP_FIRST_PAGE     4
+
+/**
+ * @brief Page following the application area: FPEC_EraseAppArea erases the pages from
+ *        FPEC_APP_FIRST_PAGE up to, but not including, this one. The pages from here to the end
+ *        of flash are kept, for data that must survive an update (the KVS store by default).
+ */
+#define FPEC_APP_END_PAGE       ((FPEC_FLASH_SIZE / FPEC_PAGE_SIZE) - 2)
 
 #endif /**< FPEC_CONFIG_ */
\ No newline at end of file
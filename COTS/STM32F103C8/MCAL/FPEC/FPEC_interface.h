@@ -7,11 +7,28 @@
 #ifndef FPEC_INTERFACE_
 #define FPEC_INTERFACE_
 
+/**
+ * @name FPEC Status
+ * @{
+ */
+#define FPEC_STATUS_OK                  0   /**< Done and verified */
+#define FPEC_STATUS_PROGRAM_ERROR       1   /**< PGERR: the target half-word was not erased */
+#define FPEC_STATUS_WRITE_PROTECTED     2   /**< WRPRTERR: the page is write protected */
+#define FPEC_STATUS_VERIFY_ERROR        3   /**< The readback differs from the data */
+#define FPEC_STATUS_INVALID_ADDRESS     4   /**< Outside the flash, misaligned, or NULL data */
+/** @} */
+
+/**
+ * @brief Flash main memory start; page n starts at FPEC_FLASH_BASE + n * FPEC_PAGE_SIZE.
+ */
+#define FPEC_FLASH_BASE                 0x08000000UL
+
 /**
  * @brief Erase the application area in the Flash memory.
  *
- * This function erases the application area in the Flash memory.
- * It iterates over the pages from 4 to 63 and erases each page using FPEC_FlashPageErase().
+ * This function erases the application area in the Flash memory, from page FPEC_APP_FIRST_PAGE
+ * up to page FPEC_APP_END_PAGE (excluded), using FPEC_ErasePage(). The pages after the
+ * application area are left untouched.
  *
  * @note This function assumes that FPEC_FlashPageErase() is defined elsewhere.
  *
@@ -48,4 +65,59 @@ void FPEC_FlashPageErase(u8 PageNumber);
  */
 void FPEC_FlashWrite(u32 Address, u16* Data, u8 Length);
 
+/**
+ * @brief Erase one flash page and check that it reads back blank.
+ *
+ * The function runs from SRAM (RAMFUNC), so the CPU keeps running during the erase (about 20 ms)
+ * instead of stalling on the first flash fetch. Interrupts keep being serviced as long as the
+ * vector table (SCB_RelocateVectorTable) and the handlers are in SRAM too: see EXTI capture and
+ * the SysTick tick. A handler fetched from the flash waits for the end of the erase.
+ *
+ * @param[in] Copy_PageAddress Any address inside the page.
+ *
+ * @return One of the FPEC status values; FPEC_GetErrorAddress gives the failing address.
+ */
+u8 FPEC_ErasePage(u32 Copy_PageAddress);
+
+/**
+ * @brief Program a contiguous run of half-words and verify it.
+ *
+ * PG is set once for the whole run instead of around every half-word, and only BSY is polled
+ * between writes. Half-words that already hold the requested value (including 0xFFFF over an
+ * erased cell) are skipped, so re-flashing an image that is mostly unchanged, or one padded with
+ * 0xFF, costs little. Every programmed half-word is read back. A half-word that is neither erased
+ * nor already correct fails before it is written, since the FPEC would refuse it with PGERR
+ * (0x0000 is the exception: it can be written over any value).
+ *
+ * Runs from SRAM like FPEC_ErasePage, with the same conditions for interrupts.
+ *
+ * @param[in] Copy_Address Flash address, half-word aligned.
+ * @param[in] Copy_pData The half-words.
+ * @param[in] Copy_Count Number of half-words.
+ *
+ * @return One of the FPEC status values; the run stops at the first failure, whose address is
+ *         returned by FPEC_GetErrorAddress.
+ */
+u8 FPEC_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_pData, u32 Copy_Count);
+
+/**
+ * @brief Program a contiguous run of words and verify it.
+ *
+ * Each word is programmed as two half-words (low half first), as FPEC_ProgramHalfWords does.
+ *
+ * @param[in] Copy_Address Flash address, word aligned.
+ * @param[in] Copy_pData The words.
+ * @param[in] Copy_Count Number of words.
+ *
+ * @return One of the FPEC status values.
+ */
+u8 FPEC_ProgramWords(u32 Copy_Address, const u32 *Copy_pData, u32 Copy_Count);
+
+/**
+ * @brief Get the address at which the last erase or program operation failed.
+ *
+ * @return The flash address of the failing half-word.
+ */
+u32 FPEC_GetErrorAddress(void);
+
 #endif /**< FPEC_INTERFACE_ */
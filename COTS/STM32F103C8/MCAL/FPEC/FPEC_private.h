@@ -53,5 +53,44 @@ typedef struct {
 
 #define FPEC ((FPEC_t*)0x40022000) /**< Pointer to the FPEC register base address */
 
+/**< Number of pages */
+#define FPEC_PAGE_COUNT         (FPEC_FLASH_SIZE / FPEC_PAGE_SIZE)
+
+#if (FPEC_APP_END_PAGE <= FPEC_APP_FIRST_PAGE) || (FPEC_APP_END_PAGE > FPEC_PAGE_COUNT)
+#error "FPEC_APP_END_PAGE must lie after FPEC_APP_FIRST_PAGE and within the flash"
+#endif
+
+/**< Unlock sequence written to KEYR */
+#define FPEC_KEY1               0x45670123UL
+#define FPEC_KEY2               0xCDEF89ABUL
+
+/**< SR bits */
+#define FPEC_SR_BSY             0x00000001UL /**< Busy */
+#define FPEC_SR_PGERR           0x00000004UL /**< Programming error: the half-word was not erased */
+#define FPEC_SR_WRPRTERR        0x00000010UL /**< Write protection error */
+#define FPEC_SR_EOP             0x00000020UL /**< End of operation */
+#define FPEC_SR_ERRORS          (FPEC_SR_PGERR | FPEC_SR_WRPRTERR)
+
+/**< CR bits */
+#define FPEC_CR_PG              0x00000001UL /**< Programming */
+#define FPEC_CR_PER             0x00000002UL /**< Page erase */
+#define FPEC_CR_STRT            0x00000040UL /**< Start */
+#define FPEC_CR_LOCK            0x00000080UL /**< Lock */
+
+/**< Erased half-word value */
+#define FPEC_ERASED_HALF_WORD   0xFFFFU
+
+/**
+ * @brief Wait for the end of the current operation, then unlock the FPEC if it is locked and
+ *        clear the status flags left by earlier operations.
+ */
+static void FPEC_Unlock(void);
+
+/**
+ * @brief Wait for the end of the current operation and translate the SR error flags.
+ *
+ * @return FPEC_STATUS_OK, FPEC_STATUS_PROGRAM_ERROR or FPEC_STATUS_WRITE_PROTECTED.
+ */
+static u8 FPEC_WaitOperation(void);
 
 #endif /**< FPEC_PRIVATE_ */
@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 10 Feb 2024                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.3                        *****************/
 /******* File Name : FPEC_program.h             *****************/
 /****************************************************************/
 
@@ -10,72 +10,165 @@
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
 #include "FPEC_interface.h"
-#include "FPEC_private.h"
 #include "FPEC_config.h"
+#include "FPEC_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Address of the first failing half-word, for FPEC_GetErrorAddress */
+static u32 FPEC_ErrorAddress = 0;
 /*****************************< Function Implementations *****************************/
 void FPEC_EraseAppArea(void) {
 	u8 i;
 	
-	for (i = 4; i < 64; i++) {
+	for (i = FPEC_APP_FIRST_PAGE; i < FPEC_APP_END_PAGE; i++) {
 		FPEC_FlashPageErase(i);
 	}
 }
 
 void FPEC_FlashPageErase(u8 PageNumber) {
-	/**< Wait Busy Flag */
-	while (GET_BIT(FPEC->SR, 0) == 1);
+	FPEC_ErasePage(FPEC_FLASH_BASE + ((u32)PageNumber * FPEC_PAGE_SIZE));
+}
 
-	/**< Check if FPEC is locked or not */
-	if ( GET_BIT(FPEC->CR, 7) == 1 ) {
-		FPEC -> KEYR = 0x45670123;
-		FPEC -> KEYR = 0xCDEF89AB;
+void FPEC_FlashWrite(u32 Address, u16 *Data, u8 Length) {
+	FPEC_ProgramHalfWords(Address, Data, Length);
+}
+
+/**< The routines that run while the flash is busy execute from SRAM (RAMFUNC) */
+RAMFUNC u8 FPEC_ErasePage(u32 Copy_PageAddress) {
+	u32 Local_Address;
+	u8 Local_Status;
+
+	if ((Copy_PageAddress < FPEC_FLASH_BASE) || (Copy_PageAddress >= (FPEC_FLASH_BASE + FPEC_FLASH_SIZE))) {
+		FPEC_ErrorAddress = Copy_PageAddress;
+		return FPEC_STATUS_INVALID_ADDRESS;
 	}
-	
+
+	/**< Any address inside the page selects it; start from the page boundary for the blank check */
+	Copy_PageAddress &= ~(FPEC_PAGE_SIZE - 1UL);
+
+	FPEC_Unlock();
+
 	/**< Page Erase Operation */
-	SET_BIT(FPEC->CR,1);
+	FPEC->CR |= FPEC_CR_PER;
+	FPEC->AR = Copy_PageAddress;
+	FPEC->CR |= FPEC_CR_STRT;
 
-	/**< Write Page address */
-	FPEC->AR = ((u32)(PageNumber * 1024) + 0x08000000);
+	Local_Status = FPEC_WaitOperation();
 
-	/**< Start operation */
-	SET_BIT(FPEC->CR,6);
+	FPEC->CR &= ~FPEC_CR_PER;
+	FPEC->CR |= FPEC_CR_LOCK;
 
-	/**< Wait Busy Flag */
-	while (GET_BIT(FPEC->SR, 0) == 1);
+	if (Local_Status != FPEC_STATUS_OK) {
+		FPEC_ErrorAddress = Copy_PageAddress;
+		return Local_Status;
+	}
 
-	/**< EOP */
-	SET_BIT(FPEC->SR, 5);
-	CLR_BIT(FPEC->CR, 1);
+	/**< Blank check, one word at a time */
+	for (Local_Address = Copy_PageAddress; Local_Address < (Copy_PageAddress + FPEC_PAGE_SIZE); Local_Address += 4) {
+		if (*((volatile u32 *)Local_Address) != 0xFFFFFFFFUL) {
+			FPEC_ErrorAddress = Local_Address;
+			return FPEC_STATUS_VERIFY_ERROR;
+		}
+	}
+
+	return FPEC_STATUS_OK;
 }
 
-void FPEC_FlashWrite(u32 Address, u16 *Data, u8 Length) {
-	u8 i;
-	volatile u16 Temp;
+RAMFUNC u8 FPEC_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_pData, u32 Copy_Count) {
+	volatile u16 *Local_pFlash = (volatile u16 *)Copy_Address;
+	u8 Local_Status = FPEC_STATUS_OK;
+	u16 Local_Current;
+	u32 i;
+
+	/**< The start is checked first, so the space left up to the end of flash cannot wrap */
+	if ((Copy_pData == NULL) || ((Copy_Address & 1UL) != 0) || (Copy_Address < FPEC_FLASH_BASE) ||
+	    (Copy_Address >= (FPEC_FLASH_BASE + FPEC_FLASH_SIZE)) ||
+	    (Copy_Count > ((FPEC_FLASH_BASE + FPEC_FLASH_SIZE - Copy_Address) / 2UL))) {
+		FPEC_ErrorAddress = Copy_Address;
+		return FPEC_STATUS_INVALID_ADDRESS;
+	}
+
+	FPEC_Unlock();
+
+	/**< PG stays set for the whole run; each half-word write starts one programming operation */
+	FPEC->CR |= FPEC_CR_PG;
+
+	for (i = 0; i < Copy_Count; i++) {
+		Local_Current = Local_pFlash[i];
 
-	while (GET_BIT(FPEC->SR, 0) == 1);
+		/**< Already holds the value (0xFFFF data over an erased cell included): nothing to program */
+		if (Local_Current == Copy_pData[i]) {
+			continue;
+		}
+
+		/**< Only an erased half-word can take a new value (or any half-word a 0x0000) */
+		if ((Local_Current != FPEC_ERASED_HALF_WORD) && (Copy_pData[i] != 0x0000U)) {
+			Local_Status = FPEC_STATUS_PROGRAM_ERROR;
+		} else {
+			Local_pFlash[i] = Copy_pData[i];
+			Local_Status = FPEC_WaitOperation();
+
+			/**< Verify on write */
+			if ((Local_Status == FPEC_STATUS_OK) && (Local_pFlash[i] != Copy_pData[i])) {
+				Local_Status = FPEC_STATUS_VERIFY_ERROR;
+			}
+		}
+
+		if (Local_Status != FPEC_STATUS_OK) {
+			FPEC_ErrorAddress = (u32)&Local_pFlash[i];
+			break;
+		}
+	}
+
+	FPEC->CR &= ~FPEC_CR_PG;
+	FPEC->CR |= FPEC_CR_LOCK;
+
+	return Local_Status;
+}
+
+u8 FPEC_ProgramWords(u32 Copy_Address, const u32 *Copy_pData, u32 Copy_Count) {
+	/**< Copy_Count * 2 must not wrap into a short, in-range half-word count */
+	if (((Copy_Address & 3UL) != 0) || (Copy_Count > (FPEC_FLASH_SIZE / 4UL))) {
+		FPEC_ErrorAddress = Copy_Address;
+		return FPEC_STATUS_INVALID_ADDRESS;
+	}
+
+	/**< Little-endian: the words are already laid out as low half-word, high half-word */
+	return FPEC_ProgramHalfWords(Copy_Address, (const u16 *)Copy_pData, Copy_Count * 2UL);
+}
+
+u32 FPEC_GetErrorAddress(void) {
+	return FPEC_ErrorAddress;
+}
+/*****************************< Private Functions *****************************/
+RAMFUNC static void FPEC_Unlock(void) {
+	/**< Wait Busy Flag */
+	while (FPEC->SR & FPEC_SR_BSY);
 
 	/**< Check if FPEC is locked or not */
-	if ( /**< FPEC_CR->BitAccess.LOCK == 1 */ GET_BIT(FPEC->CR, 7) == 1 ) {
-		FPEC -> KEYR = 0x45670123;
-		FPEC -> KEYR = 0xCDEF89AB;
+	if (FPEC->CR & FPEC_CR_LOCK) {
+		FPEC->KEYR = FPEC_KEY1;
+		FPEC->KEYR = FPEC_KEY2;
 	}
-	
-	
-	for (i = 0; i < Length; i++) {
-		/**< Write Flash Programming */
-		SET_BIT(FPEC->CR, 0);
 
-		/**< Half word operation */
-		Temp = Data[i];
-		(*((volatile u16*)Address)) = Data[i];
-		Address += 2 ;
+	/**< SR flags are cleared by writing 1 */
+	FPEC->SR = FPEC_SR_EOP | FPEC_SR_ERRORS;
+}
 
-		/**< Wait Busy Flag */
-		while (GET_BIT(FPEC->SR, 0) == 1);
-	
-		/**< EOP */
-		SET_BIT(FPEC->SR, 5);
-		CLR_BIT(FPEC->CR, 0);
+RAMFUNC static u8 FPEC_WaitOperation(void) {
+	u32 Local_Status;
+
+	/**< Wait Busy Flag */
+	while (FPEC->SR & FPEC_SR_BSY);
+
+	Local_Status = FPEC->SR;
+	FPEC->SR = FPEC_SR_EOP | FPEC_SR_ERRORS;
+
+	if (Local_Status & FPEC_SR_WRPRTERR) {
+		return FPEC_STATUS_WRITE_PROTECTED;
+	}
+	if (Local_Status & FPEC_SR_PGERR) {
+		return FPEC_STATUS_PROGRAM_ERROR;
 	}
 
+	return FPEC_STATUS_OK;
 }
@@ -133,6 +133,17 @@ Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinV
  */
 Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_PinReturnValue);
 
+/**
+ * @brief Gets the values of all pins of a GPIO port.
+ *
+ * This function reads the input data register of the port once, so all 16 pins are sampled at the same instant.
+ *
+ * @param[in] Copy_PortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param[out] Copy_PortReturnValue Pointer to the variable where the pin levels will be stored (bit n = pin n).
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
+ */
+Std_ReturnType MCAL_GPIO_GetPortValue(u8 Copy_PortId, u16 *Copy_PortReturnValue);
+
 /**
  * @brief Toggles the value of a GPIO pin.
  *
@@ -146,6 +157,21 @@ Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_Pin
  */
 Std_ReturnType MCAL_GPIO_TogglePin(u8 Copy_PortId, u8 Copy_PinId);
 
+/**
+ * @brief Sets several pins of a GPIO port in one write.
+ *
+ * This function writes the pins selected by Copy_Mask to the matching bits of Copy_Value with a
+ * single BSRR write, so all of them change at the same instant and the other pins of the port are
+ * not touched (no read-modify-write, safe against interrupts using the same port).
+ *
+ * @param[in] Copy_PortId The ID of the GPIO port (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param[in] Copy_Mask   The pins to write (bit n = pin n).
+ * @param[in] Copy_Value  The new levels of the selected pins (bit n = level of pin n).
+ *
+ * @return Std_ReturnType Returns E_OK if the operation was successful, or E_NOT_OK if an error occurred.
+ */
+Std_ReturnType MCAL_GPIO_SetPortMaskedValue(u8 Copy_PortId, u16 Copy_Mask, u16 Copy_Value);
+
 /** @} */ // End of GPIO_Functions group
 
 
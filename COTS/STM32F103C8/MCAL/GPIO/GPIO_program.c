@@ -155,7 +155,7 @@ Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinV
     return Local_FunctionStatus;
 }
 
-Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_PinReturnValue)
+RAMFUNC Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_PinReturnValue)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
@@ -194,6 +194,36 @@ Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_Pin
     return Local_FunctionStatus;
 }
 
+Std_ReturnType MCAL_GPIO_GetPortValue(u8 Copy_PortId, u16 *Copy_PortReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if(Copy_PortReturnValue != NULL)
+    {
+        switch (Copy_PortId)
+        {
+            case GPIO_PORTA:
+                *Copy_PortReturnValue = (u16)GPIOA_IDR;
+                Local_FunctionStatus = E_OK;
+                break;
+            case GPIO_PORTB:
+                *Copy_PortReturnValue = (u16)GPIOB_IDR;
+                Local_FunctionStatus = E_OK;
+                break;
+            case GPIO_PORTC:
+                *Copy_PortReturnValue = (u16)GPIOC_IDR;
+                Local_FunctionStatus = E_OK;
+                break;
+
+            default:
+                Local_FunctionStatus = E_NOT_OK;
+                break;
+        }
+    }
+
+    return Local_FunctionStatus;
+}
+
 Std_ReturnType MCAL_GPIO_TogglePin(u8 Copy_PortId, u8 Copy_PinId) 
 {
     u8 Local_PinValue;
@@ -216,6 +246,33 @@ Std_ReturnType MCAL_GPIO_TogglePin(u8 Copy_PortId, u8 Copy_PinId)
         return MCAL_GPIO_SetPinValue(Copy_PortId, Copy_PinId, GPIO_HIGH);
     }
 }
+
+Std_ReturnType MCAL_GPIO_SetPortMaskedValue(u8 Copy_PortId, u16 Copy_Mask, u16 Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+
+    /**< Upper half resets the selected pins that go low, lower half sets the ones that go high */
+    u32 Local_SetReset = ((u32)(Copy_Mask & (u16)~Copy_Value) << 16) | (u32)(Copy_Mask & Copy_Value);
+
+    switch (Copy_PortId)
+    {
+        case GPIO_PORTA:
+            GPIOA_BSR = Local_SetReset;
+            break;
+        case GPIO_PORTB:
+            GPIOB_BSR = Local_SetReset;
+            break;
+        case GPIO_PORTC:
+            GPIOC_BSR = Local_SetReset;
+            break;
+
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+    }
+
+    return Local_FunctionStatus;
+}
 /*****************************< End of Function Implementations *****************************/
 
 
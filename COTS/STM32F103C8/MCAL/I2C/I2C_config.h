@@ -1,6 +1,39 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 10 Dec 2023                *****************/
-/******* Version   : 0.1                        *****************/
-/******* File Name : I2C_config.c               *****************/
-/****************************************************************/
\ No newline at end of file
+/******* Version   : 0.3                        *****************/
+/******* File Name : I2C_config.h               *****************/
+/****************************************************************/
+#ifndef I2C_CONFIG_H_
+#define I2C_CONFIG_H_
+
+/**
+ * @brief Margin a transaction gets beyond its own bus time before it is aborted, in microseconds.
+ *
+ * The deadline of each transaction is the time its bytes take at I2C_Config_t.ClockSpeed (nine
+ * SCL periods per byte, address bytes included) plus this margin, which covers clock stretching
+ * and interrupt latency. Measured with the DWT cycle counter by I2C_ProcessTimeouts and by the
+ * blocking wrappers.
+ */
+#define I2C_TIMEOUT_US          10000UL
+
+/**
+ * @name Bus recovery pins (I2C1 without remap)
+ * @{
+ */
+#define I2C_SCL_PORT            GPIO_PORTB
+#define I2C_SCL_PIN             GPIO_PIN6
+#define I2C_SDA_PORT            GPIO_PORTB
+#define I2C_SDA_PIN             GPIO_PIN7
+/** @} */
+
+/**
+ * @brief Shortest transfer moved by DMA instead of byte interrupts; 0 disables DMA.
+ *
+ * Writes of at least this many bytes use DMA1 channel 6 (I2C1_TX) and reads use channel 7
+ * (I2C1_RX), so the whole data phase costs one interrupt. Single-byte reads always use the
+ * interrupt sequence, since DMA reception needs at least two bytes.
+ */
+#define I2C_DMA_MIN_LENGTH      4
+
+#endif /* I2C_CONFIG_H_ */
@@ -1,15 +1,21 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 10 Dec 2023                *****************/
-/******* Version   : 0.1                        *****************/
-/******* File Name : I2C_interface.c            *****************/
+/******* Version   : 0.4                        *****************/
+/******* File Name : I2C_interface.h            *****************/
 /****************************************************************/
 #ifndef I2C_INTERFACE_H_
 #define I2C_INTERFACE_H_
 
+/**
+ * @defgroup I2C_Configurations I2C Configurations
+ * @brief Configuration types of the I2C1 master driver.
+ * @{
+ */
+
 typedef enum {
-    I2C_SPEED_STANDARD,
-    I2C_SPEED_FAST
+    I2C_SPEED_STANDARD,     /**< Standard mode, up to 100 kHz */
+    I2C_SPEED_FAST          /**< Fast mode, up to 400 kHz */
 } I2C_Speed_t;
 
 typedef enum {
@@ -19,26 +25,214 @@ typedef enum {
 } I2C_Mode_t;
 
 typedef enum {
-    I2C_DutyCycle_2,
-    I2C_DutyCycle_16_9
+    I2C_DutyCycle_2,        /**< Fast mode Tlow/Thigh = 2 */
+    I2C_DutyCycle_16_9      /**< Fast mode Tlow/Thigh = 16/9 */
 } I2C_DutyCycle_t;
 
 typedef struct {
-    u32 ClockSpeed;
-    I2C_Speed_t SpeedMode;
-    I2C_Mode_t Mode;
-    I2C_DutyCycle_t DutyCycle;
-    u8 OwnAddress1;
-    u8 Ack;
-    u8 AcknowledgedAddress;
+    u32 ClockSpeed;                 /**< SCL frequency in Hz */
+    I2C_Speed_t SpeedMode;          /**< Standard or fast mode */
+    I2C_Mode_t Mode;                /**< I2C or SMBus */
+    I2C_DutyCycle_t DutyCycle;      /**< Fast mode duty cycle */
+    u8 OwnAddress1;                 /**< 7-bit own address (used when addressed as a slave) */
+    u8 Ack;                         /**< ENABLE to acknowledge when addressed as a slave */
+    u8 AcknowledgedAddress;         /**< Reserved: only 7-bit addressing is supported */
 } I2C_Config_t;
 
+/**
+ * @name I2C Transaction Status
+ * @{
+ */
+#define I2C_STATUS_DONE         0   /**< Completed: every byte was acknowledged */
+#define I2C_STATUS_PENDING      1   /**< Queued or in progress */
+#define I2C_STATUS_NACK         2   /**< The slave did not acknowledge its address or a written byte */
+#define I2C_STATUS_ARB_LOST     3   /**< Another master won arbitration */
+#define I2C_STATUS_BUS_ERROR    4   /**< Misplaced start/stop or overrun */
+#define I2C_STATUS_TIMEOUT      5   /**< No completion within the transaction deadline; the bus was recovered */
+/** @} */
+
+/**
+ * @brief Type Definition for the transaction completion callback.
+ *
+ * Called from the I2C interrupt (or from I2C_ProcessTimeouts on a timeout) once the transaction
+ * has ended, with its final status. The callback may submit new transactions.
+ */
+typedef void (*I2C_CallbackFunc_t)(u8 Copy_Status, void *Copy_pvContext);
+
+/**
+ * @brief One master transaction: an optional write followed by an optional read.
+ *
+ * When both lengths are non-zero the read follows the write after a repeated start, without
+ * releasing the bus (the usual register read of a sensor). The structure is owned by the caller
+ * and must stay valid, together with the data buffers, until Status leaves I2C_STATUS_PENDING.
+ */
+typedef struct I2C_Transaction {
+    u8 Address;                         /**< 7-bit slave address */
+    const u8 *pWriteData;               /**< Bytes to write, or NULL */
+    u16 WriteLength;                    /**< Number of bytes to write */
+    u8 *pReadData;                      /**< Buffer for the bytes read, or NULL */
+    u16 ReadLength;                     /**< Number of bytes to read */
+    I2C_CallbackFunc_t pfCallback;      /**< Completion callback, or NULL */
+    void *pvContext;                    /**< Passed to the callback */
+    volatile u8 Status;                 /**< One of the I2C transaction status values */
+    struct I2C_Transaction *pNext;      /**< Queue link, managed by the driver */
+} I2C_Transaction_t;
+
+/**
+ * @name I2C Slave Register Access
+ * @{
+ */
+#define I2C_SLAVE_ACCESS_READ       0x01    /**< The master may read the registers */
+#define I2C_SLAVE_ACCESS_WRITE      0x02    /**< The master may write the registers */
+#define I2C_SLAVE_ACCESS_READ_WRITE (I2C_SLAVE_ACCESS_READ | I2C_SLAVE_ACCESS_WRITE)
+/** @} */
+
+/**
+ * @brief A run of consecutive slave registers backed by application memory.
+ *
+ * The master reads and writes pData in place, from the interrupt; there is no copy in the driver.
+ */
+typedef struct {
+    u8 FirstRegister;       /**< Number of the first register */
+    u8 Count;               /**< Number of registers */
+    u8 Access;              /**< I2C_SLAVE_ACCESS_x */
+    u8 *pData;              /**< Backing memory of Count bytes */
+} I2C_SlaveRegion_t;
+
+/**
+ * @brief Type Definition for the slave write callback.
+ *
+ * Called from the I2C interrupt at the stop (or repeated start) that ends a master write, with the
+ * first register written and the number of bytes received.
+ */
+typedef void (*I2C_SlaveWriteCallback_t)(u8 Copy_FirstRegister, u8 Copy_Count);
+
+/**
+ * @brief Register map exposed in slave mode.
+ */
+typedef struct {
+    const I2C_SlaveRegion_t *pRegions;          /**< Regions, not overlapping */
+    u8 RegionCount;                             /**< Number of regions */
+    I2C_SlaveWriteCallback_t pfWriteCallback;   /**< Called after a write, or NULL */
+} I2C_SlaveMap_t;
+
+/** @} */  // I2C_Configurations
+
+/**
+ * @defgroup I2C_Control I2C Master Functions
+ * @brief Interrupt-driven I2C1 master with a transaction queue.
+ * @{
+ */
 
+/**
+ * @brief Initialize I2C1 as an interrupt-driven master.
+ *
+ * Programs the bus timing from the APB1 clock (MCAL_RCC_GetPclk1), the own address and acknowledge, and enables the
+ * event and error interrupts. The configuration is kept so the peripheral can be re-initialized
+ * after a bus recovery.
+ *
+ * @param[in] I2CConfig Pointer to the configuration (copied).
+ *
+ * @note The GPIOB and AFIO clocks must be enabled first, SCL/SDA (PB6/PB7) set to alternate
+ *       function open-drain, and NVIC_I2C1_EV_IRQn / NVIC_I2C1_ER_IRQn enabled in the NVIC.
+ *       With I2C_DMA_MIN_LENGTH != 0, NVIC_DMA1_Channel6_IRQn / NVIC_DMA1_Channel7_IRQn are
+ *       needed as well.
+ * @note The driver manages the I2C1 clock itself: it runs while transactions are queued or the
+ *       slave is started, and is gated otherwise.
+ *
+ * @return E_OK if I2C1 was configured, E_NOT_OK for a NULL pointer or an unreachable clock speed.
+ */
 Std_ReturnType I2C_Init(I2C_Config_t *I2CConfig);
-Std_ReturnType I2C_StartCondition(void);
-Std_ReturnType I2C_StopCondition(void);
+
+/**
+ * @brief Queue a transaction.
+ *
+ * The transaction starts at once if the bus is idle, otherwise after the ones queued before it.
+ * The function never waits: completion is reported through Status and the callback.
+ *
+ * @param[in,out] Copy_pTransaction The transaction; Status is set to I2C_STATUS_PENDING.
+ *
+ * @return E_OK if queued, E_NOT_OK for a NULL pointer, a missing buffer or a transaction already pending.
+ */
+Std_ReturnType I2C_Submit(I2C_Transaction_t *Copy_pTransaction);
+
+/**
+ * @brief Check whether a transaction is in progress or queued.
+ *
+ * @return 1 while the driver has work, 0 when idle.
+ */
+u8 I2C_IsBusy(void);
+
+/**
+ * @brief Abort the running transaction if it has exceeded its deadline.
+ *
+ * The deadline is the bus time of the transaction's bytes at the configured SCL rate plus
+ * I2C_TIMEOUT_US, so long transfers are not cut short.
+ *
+ * A timed-out transaction ends with I2C_STATUS_TIMEOUT, the bus is recovered (SCL clocked until
+ * the slave releases SDA, then a stop) and I2C1 is re-initialized before the next transaction
+ * starts. Call this periodically, e.g. from a software timer every few milliseconds.
+ */
+void I2C_ProcessTimeouts(void);
+
+/**
+ * @brief Answer as a slave at I2C_Config_t.OwnAddress1 with a register map.
+ *
+ * The master writes the register number first; following bytes are written from that register
+ * on, and a read (after a stop or a repeated start) returns registers from the pointer on. The
+ * pointer increments after every byte and wraps at 255. Unmapped and write-only registers read as
+ * 0xFF; writes to unmapped and read-only registers are dropped. The slave works alongside the
+ * queued master transactions.
+ *
+ * @param[in] Copy_pMap The map; it and its regions must stay valid until I2C_SlaveStop.
+ *
+ * @return E_OK, or E_NOT_OK for a NULL map or a NULL region table.
+ */
+Std_ReturnType I2C_SlaveStart(const I2C_SlaveMap_t *Copy_pMap);
+
+/**
+ * @brief Stop answering as a slave (the own address is no longer acknowledged).
+ */
+void I2C_SlaveStop(void);
+
+/**
+ * @brief Write bytes to a slave and wait for the end of the transfer.
+ *
+ * Convenience wrapper around I2C_Submit. The CPU waits on the transaction status, not on the
+ * I2C flags, and the wait is bounded by the transaction deadline (see I2C_ProcessTimeouts).
+ *
+ * @param[in] address The 7-bit slave address.
+ * @param[in] data The bytes to write.
+ * @param[in] dataSize The number of bytes.
+ *
+ * @return E_OK if every byte was acknowledged, E_NOT_OK otherwise.
+ */
 Std_ReturnType I2C_SendData(u8 address, u8* data, u8 dataSize);
+
+/**
+ * @brief Read bytes from a slave and wait for the end of the transfer.
+ *
+ * @param[in] address The 7-bit slave address.
+ * @param[out] data Buffer for the bytes read.
+ * @param[in] dataSize The number of bytes.
+ *
+ * @return E_OK if the bytes were read, E_NOT_OK otherwise.
+ */
 Std_ReturnType I2C_ReceiveData(u8 address, u8* data, u8 dataSize);
 
-#endif /* I2C_INTERFACE_H_ */
+/**
+ * @brief Write bytes then read bytes with a repeated start, and wait for the end of the transfer.
+ *
+ * @param[in] address The 7-bit slave address.
+ * @param[in] writeData The bytes to write (typically a register address).
+ * @param[in] writeSize The number of bytes to write.
+ * @param[out] readData Buffer for the bytes read.
+ * @param[in] readSize The number of bytes to read.
+ *
+ * @return E_OK if the transfer completed, E_NOT_OK otherwise.
+ */
+Std_ReturnType I2C_WriteRead(u8 address, const u8* writeData, u8 writeSize, u8* readData, u8 readSize);
 
+/** @} */  // I2C_Control
+
+#endif /* I2C_INTERFACE_H_ */
@@ -1,8 +1,8 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 10 Dec 2023                *****************/
-/******* Version   : 0.1                        *****************/
-/******* File Name : I2C_private.c              *****************/
+/******* Version   : 0.3                        *****************/
+/******* File Name : I2C_private.h              *****************/
 /****************************************************************/
 #ifndef I2C_PRIVATE_H_
 #define I2C_PRIVATE_H_
@@ -36,29 +36,35 @@ typedef struct {
  * @brief I2C control register 1 (I2C_CR1) bit definitions.
  */
 #define I2C_CR1_PE          0x00000001 /**< Peripheral enable */
-#define I2C_CR1_SMBUS       0x00040000 /**< SMBus mode */
-#define I2C_CR1_SMBTYPE     0x00080000 /**< SMBus type */
-#define I2C_CR1_ENARP       0x00100000 /**< ARP enable */
-#define I2C_CR1_ENPEC       0x00200000 /**< PEC enable */
-#define I2C_CR1_ENGC        0x00400000 /**< General call enable */
-#define I2C_CR1_NOSTRETCH   0x00800000 /**< Clock stretching disable (Slave mode) */
-#define I2C_CR1_START       0x01000000 /**< Start generation */
-#define I2C_CR1_STOP        0x02000000 /**< Stop generation */
-#define I2C_CR1_ACK         0x04000000 /**< Acknowledge enable */
-#define I2C_CR1_POS         0x08000000 /**< Acknowledge/PEC Position (for data reception) */
-#define I2C_CR1_PEC         0x10000000 /**< Packet error checking */
-#define I2C_CR1_ALERT       0x20000000 /**< SMBus alert */
-#define I2C_CR1_SWRST       0x80000000 /**< Software reset */
+#define I2C_CR1_SMBUS       0x00000002 /**< SMBus mode */
+#define I2C_CR1_SMBTYPE     0x00000008 /**< SMBus type */
+#define I2C_CR1_ENARP       0x00000010 /**< ARP enable */
+#define I2C_CR1_ENPEC       0x00000020 /**< PEC enable */
+#define I2C_CR1_ENGC        0x00000040 /**< General call enable */
+#define I2C_CR1_NOSTRETCH   0x00000080 /**< Clock stretching disable (Slave mode) */
+#define I2C_CR1_START       0x00000100 /**< Start generation */
+#define I2C_CR1_STOP        0x00000200 /**< Stop generation */
+#define I2C_CR1_ACK         0x00000400 /**< Acknowledge enable */
+#define I2C_CR1_POS         0x00000800 /**< Acknowledge/PEC Position (for data reception) */
+#define I2C_CR1_PEC         0x00001000 /**< Packet error checking */
+#define I2C_CR1_ALERT       0x00002000 /**< SMBus alert */
+#define I2C_CR1_SWRST       0x00008000 /**< Software reset */
 
 /**
  * @brief I2C control register 2 (I2C_CR2) bit definitions.
  */
 #define I2C_CR2_FREQ        0x0000003F /**< Peripheral clock frequency */
-#define I2C_CR2_ITERREN     0x00000400 /**< Error interrupt enable */
+#define I2C_CR2_ITERREN     0x00000100 /**< Error interrupt enable */
 #define I2C_CR2_ITEVTEN     0x00000200 /**< Event interrupt enable */
-#define I2C_CR2_ITBUFEN     0x00000100 /**< Buffer interrupt enable */
-#define I2C_CR2_DMAEN       0x00000080 /**< DMA requests enable */
-#define I2C_CR2_LAST        0x00000020 /**< DMA last transfer */
+#define I2C_CR2_ITBUFEN     0x00000400 /**< Buffer interrupt enable */
+#define I2C_CR2_DMAEN       0x00000800 /**< DMA requests enable */
+#define I2C_CR2_LAST        0x00001000 /**< DMA last transfer */
+
+/**
+ * @brief I2C own address register 1 (I2C_OAR1) bit definitions.
+ */
+#define I2C_OAR1_ADD_SHIFT  1          /**< 7-bit address position */
+#define I2C_OAR1_BIT14      0x00004000 /**< Must be kept at 1 by software */
 
 /**
  * @brief I2C status register 1 (I2C_SR1) bit definitions.
@@ -78,6 +84,24 @@ typedef struct {
 #define I2C_SR1_TIMEOUT     0x00004000 /**< Timeout or Tlow detection flag */
 #define I2C_SR1_SMBALERT    0x00008000 /**< SMBus alert */
 
+/**< Error flags; they are cleared by writing 0, writing 1 leaves them unchanged */
+#define I2C_SR1_ERRORS      (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR | \
+                             I2C_SR1_PECERR | I2C_SR1_TIMEOUT | I2C_SR1_SMBALERT)
+
+/**
+ * @brief I2C status register 2 (I2C_SR2) bit definitions.
+ */
+#define I2C_SR2_MSL         0x00000001 /**< Master/slave */
+#define I2C_SR2_BUSY        0x00000002 /**< Bus busy */
+#define I2C_SR2_TRA         0x00000004 /**< Transmitter/receiver */
+
+/**
+ * @brief I2C clock control register (I2C_CCR) bit definitions.
+ */
+#define I2C_CCR_CCR         0x00000FFF /**< Clock control value */
+#define I2C_CCR_DUTY        0x00004000 /**< Fast mode duty cycle 16/9 */
+#define I2C_CCR_FS          0x00008000 /**< Fast mode */
+
 /**
  * @brief I2C event macros.
  */
@@ -104,12 +128,158 @@ typedef struct {
 #define ENABLE   1 /**< Enable control macro */
 #define DISABLE  0 /**< Enable control macro */
 
+/*****************************< Transfer state *****************************/
+/**< Phase of the running transaction */
+#define I2C_PHASE_IDLE      0   /**< No transaction on the bus */
+#define I2C_PHASE_WRITE     1   /**< Address and data sent in transmitter mode */
+#define I2C_PHASE_READ      2   /**< Address sent in receiver mode, data being read */
+#define I2C_PHASE_RESTART   3   /**< Repeated start requested after the write phase; only SB is handled */
+
+/**< Timeout and bus recovery timing */
+#define I2C_BYTE_BITS           9   /**< SCL periods per byte: eight data bits and the acknowledge */
+#define I2C_FRAME_BYTES         2   /**< Address bytes of a write and a repeated-start read, counted as data */
+#define I2C_TIMEOUT_MAX_US      50000000UL /**< Deadline cap, below the 59 s wrap of the cycle counter at 72 MHz */
+#define I2C_RECOVERY_CLOCKS     9   /**< SCL pulses that release any slave stuck mid-byte */
+#define I2C_RECOVERY_HALF_US    5   /**< Half SCL period while recovering (100 kHz) */
+#define I2C_STOP_WAIT_US        1000UL /**< Bound on the wait for a stop condition: a byte and the stop down to 10 kHz */
+#define I2C_STOP_WAIT_CYCLES    MCAL_DWT_UsToCycles(I2C_STOP_WAIT_US)
+
+/**< DMA request channels of I2C1 */
+#define I2C_DMA_TX_CHANNEL      DMA_CHANNEL6
+#define I2C_DMA_RX_CHANNEL      DMA_CHANNEL7
+
+/**< A data phase goes through DMA when it is long enough; reception needs at least two bytes for LAST */
+#define I2C_USE_DMA(LENGTH)     ((I2C_DMA_MIN_LENGTH != 0) && ((LENGTH) >= I2C_DMA_MIN_LENGTH) && ((LENGTH) >= 2))
+
+/**< Slave transfer states */
+#define I2C_SLAVE_IDLE              0   /**< Not addressed */
+#define I2C_SLAVE_RECEIVE_POINTER   1   /**< Addressed for write, waiting for the register number */
+#define I2C_SLAVE_RECEIVE_DATA      2   /**< Writing registers from the pointer */
+#define I2C_SLAVE_TRANSMIT          3   /**< Reading registers from the pointer */
+
+#define I2C_SLAVE_FILL_BYTE         0xFF /**< Read from unmapped or write-only registers */
 
 /* Private functions */
 static void I2C_ClearADDRFlag(I2C_RegDef_t *pI2Cx);
 static void I2C_EnableAck(I2C_RegDef_t *pI2Cx);
 static void I2C_DisableAck(I2C_RegDef_t *pI2Cx);
-static void I2C_MasterHandleTXEInterrupt(I2C_RegDef_t *pI2Cx, uint8_t *pData);
+static void I2C_MasterHandleTXEInterrupt(I2C_RegDef_t *pI2Cx, const uint8_t *pData);
 static void I2C_MasterHandleRXNEInterrupt(I2C_RegDef_t *pI2Cx, uint8_t *pData);
 
+/**
+ * @brief Program CR2, CCR, TRISE and OAR1 from I2C_SavedConfig and enable the peripheral.
+ *
+ * @return E_OK, or E_NOT_OK when the clock speed cannot be reached from the current PCLK1
+ *         (at least 2 MHz for standard mode and 4 MHz for fast mode).
+ */
+static Std_ReturnType I2C_Configure(void);
+
+/**
+ * @brief RCC clock change notifier: let the queued transactions finish, then reprogram the bus
+ *        timing from the new PCLK1.
+ */
+static void I2C_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
+/**
+ * @brief Start the transaction at the head of the queue with a start condition.
+ */
+static void I2C_StartHead(void);
+
+/**
+ * @brief Wait, at most I2C_STOP_WAIT_US, until a requested stop condition has been generated.
+ */
+static void I2C_WaitStop(void);
+
+/**
+ * @brief End the running transaction, report it and start the next one.
+ *
+ * @param[in] Copy_Status The final status.
+ */
+static void I2C_Finish(u8 Copy_Status);
+
+/**
+ * @brief Handle an event while the interface is master (EV5 to EV8_2 and the read phase).
+ *
+ * @param[in] Copy_SR1 The SR1 value read at the start of the interrupt.
+ */
+static void I2C_HandleMasterEvent(u32 Copy_SR1);
+
+/**
+ * @brief Handle an event while the interface is slave (EV1 to EV4).
+ *
+ * @param[in] Copy_SR1 The SR1 value read at the start of the interrupt.
+ */
+static void I2C_HandleSlaveEvent(u32 Copy_SR1);
+
+/**
+ * @brief Read one register of the slave map.
+ *
+ * @return The register value, or I2C_SLAVE_FILL_BYTE when it is not readable.
+ */
+static u8 I2C_SlaveReadRegister(u8 Copy_Register);
+
+/**
+ * @brief Write one register of the slave map; ignored when it is not writable.
+ */
+static void I2C_SlaveWriteRegister(u8 Copy_Register, u8 Copy_Value);
+
+/**
+ * @brief Find the region holding a register if it allows the given access.
+ *
+ * @return The region, or NULL.
+ */
+static const I2C_SlaveRegion_t *I2C_SlaveFindRegion(u8 Copy_Register, u8 Copy_Access);
+
+/**
+ * @brief Report the registers written by the current slave write, if any, to the write callback.
+ */
+static void I2C_SlaveEndWrite(void);
+
+/**
+ * @brief Handle the events of the read phase (EV7, EV7_1 and the BTF steps for the last bytes).
+ *
+ * @param[in] Copy_SR1 The SR1 value read at the start of the interrupt.
+ */
+static void I2C_HandleReadEvent(u32 Copy_SR1);
+
+/**
+ * @brief Free a bus held by a slave and reset the peripheral.
+ *
+ * Clocks SCL as a GPIO until SDA is released, generates a stop condition, then resets and
+ * re-initializes I2C1.
+ */
+static void I2C_RecoverBus(void);
+
+/**
+ * @brief Hand the data phase of the running transaction to DMA at EV6.
+ *
+ * Starts the channel, sets DMAEN (and LAST for a read, so the last byte is NACKed by hardware)
+ * and masks the event interrupt until the DMA completes; then clears ADDR.
+ */
+static void I2C_StartDma(void);
+
+/**
+ * @brief DMA1 channel 6 callback: the last byte to write has been loaded into DR.
+ *
+ * @param[in] Copy_Event One of the DMA callback events.
+ */
+static void I2C_DmaTxCallback(u8 Copy_Event);
+
+/**
+ * @brief DMA1 channel 7 callback: every byte has been read.
+ *
+ * @param[in] Copy_Event One of the DMA callback events.
+ */
+static void I2C_DmaRxCallback(u8 Copy_Event);
+
+/**
+ * @brief Submit a transaction built on the stack and wait for it to end.
+ *
+ * Used by the blocking wrappers; the wait is bounded by I2C_ProcessTimeouts.
+ *
+ * @return E_OK if the transaction ended with I2C_STATUS_DONE, E_NOT_OK otherwise.
+ */
+static Std_ReturnType I2C_Transfer(u8 Copy_Address, const u8 *Copy_pWriteData, u16 Copy_WriteLength,
+                                   u8 *Copy_pReadData, u16 Copy_ReadLength);
+
 #endif /* I2C_PRIVATE_H_ */
@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 10 Dec 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.4                        *****************/
 /******* File Name : I2C_program.c              *****************/
 /****************************************************************/
 
@@ -9,86 +9,397 @@
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
+#include "RCC_interface.h"
+#include "GPIO_interface.h"
+#include "DMA_interface.h"
+#include "SCB_interface.h"
+#include "DWT_interface.h"
 #include "I2C_interface.h"
-#include "I2C_private.h"
 #include "I2C_config.h"
+#include "I2C_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Configuration kept for re-initialization after a bus recovery */
+static I2C_Config_t I2C_SavedConfig;
+
+/**< Transaction queue: the head is the running transaction */
+static I2C_Transaction_t *volatile I2C_pQueueHead = NULL;
+static I2C_Transaction_t *I2C_pQueueTail = NULL;
+
+/**< Progress of the running transaction */
+static volatile u8 I2C_Phase = I2C_PHASE_IDLE;
+static u16 I2C_Index = 0;
+static u32 I2C_StartCycles = 0;
+static u32 I2C_DeadlineCycles = 0;      /**< Time allowed to the running transaction, set by I2C_StartHead */
+static volatile u8 I2C_DmaActive = 0;    /**< 1 while a DMA channel moves the data phase */
+static volatile u8 I2C_MasterActive = 0; /**< 1 from the start condition (SB) to the end of the transaction */
+
+/**< Slave register map and transfer progress */
+static const I2C_SlaveMap_t *volatile I2C_pSlaveMap = NULL;
+static u8 I2C_SlaveState = I2C_SLAVE_IDLE;
+static u8 I2C_SlavePointer = 0;         /**< Auto-incremented register pointer, kept across transfers */
+static u8 I2C_SlaveWriteFirst = 0;      /**< First register of the current write */
+static u8 I2C_SlaveWriteCount = 0;      /**< Registers written so far in the current write */
 /*****************************< Public function definitions *****************************/
 Std_ReturnType I2C_Init(I2C_Config_t *I2CConfig) {
-    // Configure I2C peripheral based on I2CConfig settings
-    // Configure clock speed, mode, duty cycle, own address, etc.
-    // Configure CR2 register for clock speed
-    // Configure CCR register for other settings
-    
-    // Return success or failure based on initialization
-    return E_OK;
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (I2CConfig != NULL) {
+        /**< Transaction timeouts and bus recovery are timed with the cycle counter */
+        MCAL_DWT_Init();
+
+        I2C_SavedConfig = *I2CConfig;
+
+        /**< The configuration is kept by I2C1 while its clock is gated between transactions */
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+        Local_FunctionStatus = I2C_Configure();
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+
+        /**< Follow the clock profile changes */
+        MCAL_RCC_RegisterClockNotifier(I2C_ClockNotifier);
+
+        if ((Local_FunctionStatus == E_OK) && (I2C_DMA_MIN_LENGTH != 0)) {
+            DMA_ChannelConfig_t Local_DmaConfig = {0};
+
+            Local_DmaConfig.PeripheralSize = DMA_SIZE_8BIT;
+            Local_DmaConfig.MemorySize = DMA_SIZE_8BIT;
+            Local_DmaConfig.Priority = DMA_PRIORITY_HIGH;
+            Local_DmaConfig.MemoryIncrement = 1;
+
+            Local_DmaConfig.Direction = DMA_DIR_MEM_TO_PERIPH;
+            MCAL_DMA_ConfigureChannel(I2C_DMA_TX_CHANNEL, &Local_DmaConfig, I2C_DmaTxCallback);
+            Local_DmaConfig.Direction = DMA_DIR_PERIPH_TO_MEM;
+            MCAL_DMA_ConfigureChannel(I2C_DMA_RX_CHANNEL, &Local_DmaConfig, I2C_DmaRxCallback);
+        }
+    }
+
+    return Local_FunctionStatus;
 }
 
-Std_ReturnType I2C_StartCondition(void) {
-    // Generate the Start condition by setting the START bit in CR1 register
-    I2C1->CR1 |= I2C_CR1_START;
-    
-    // Wait until the Start condition is generated (polling)
-    while (!(I2C1->SR1 & I2C_SR1_SB));
-    
+Std_ReturnType I2C_Submit(I2C_Transaction_t *Copy_pTransaction) {
+    u32 Local_PrimaskState;
+
+    if ((Copy_pTransaction == NULL) || (Copy_pTransaction->Status == I2C_STATUS_PENDING) ||
+        ((Copy_pTransaction->WriteLength != 0) && (Copy_pTransaction->pWriteData == NULL)) ||
+        ((Copy_pTransaction->ReadLength != 0) && (Copy_pTransaction->pReadData == NULL))) {
+        return E_NOT_OK;
+    }
+
+    Copy_pTransaction->Status = I2C_STATUS_PENDING;
+    Copy_pTransaction->pNext = NULL;
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if (I2C_pQueueHead == NULL) {
+        /**< Bus idle: clock I2C1 until the queue drains, and start right away */
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+        I2C_pQueueHead = Copy_pTransaction;
+        I2C_pQueueTail = Copy_pTransaction;
+        I2C_StartHead();
+    } else {
+        I2C_pQueueTail->pNext = Copy_pTransaction;
+        I2C_pQueueTail = Copy_pTransaction;
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
     return E_OK;
 }
 
-Std_ReturnType I2C_StopCondition(void) {
-    // Generate the Stop condition by setting the STOP bit in CR1 register
-    I2C1->CR1 |= I2C_CR1_STOP;
-    
-    // Wait until the Stop condition is generated (polling)
-    while (!(I2C1->SR1 & I2C_SR1_STOPF));
-    
+u8 I2C_IsBusy(void) {
+    return (I2C_pQueueHead != NULL) ? 1 : 0;
+}
+
+void I2C_ProcessTimeouts(void) {
+    u32 Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if ((I2C_pQueueHead != NULL) && ((MCAL_DWT_GetCycles() - I2C_StartCycles) >= I2C_DeadlineCycles)) {
+        /**< A slave holding SDA or SCL, or a missed event: free the bus before the next transaction */
+        I2C_RecoverBus();
+        I2C_Finish(I2C_STATUS_TIMEOUT);
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+}
+
+Std_ReturnType I2C_SlaveStart(const I2C_SlaveMap_t *Copy_pMap) {
+    u32 Local_PrimaskState;
+
+    if ((Copy_pMap == NULL) || ((Copy_pMap->RegionCount != 0) && (Copy_pMap->pRegions == NULL))) {
+        return E_NOT_OK;
+    }
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    /**< The own address can only be recognised while I2C1 is clocked */
+    if (I2C_pSlaveMap == NULL) {
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+    }
+
+    I2C_pSlaveMap = Copy_pMap;
+    I2C_SlaveState = I2C_SLAVE_IDLE;
+    I2C_SlavePointer = 0;
+
+    /**< The own address is only acknowledged with ACK set; a master transaction restores it when it ends */
+    I2C_SavedConfig.Ack = ENABLE;
+    if (I2C_Phase == I2C_PHASE_IDLE) {
+        I2C_EnableAck(I2C1);
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
     return E_OK;
 }
 
+void I2C_SlaveStop(void) {
+    u32 Local_PrimaskState = SCB_EnterCriticalSection();
+
+    I2C_SavedConfig.Ack = DISABLE;
+    if (I2C_Phase == I2C_PHASE_IDLE) {
+        I2C_DisableAck(I2C1);
+    }
+
+    if (I2C_pSlaveMap != NULL) {
+        I2C_pSlaveMap = NULL;
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+}
+
 Std_ReturnType I2C_SendData(u8 address, u8* data, u8 dataSize) {
-    // Transmit data over I2C
-    
-    // Set the address in the data register
-    I2C1->DR = address;
-    
-    // Implement sending data bytes by writing to the data register and handling transfer
-    
-    // Wait until data transmission is complete (polling TXE and BTF flags)
-    while (dataSize > 0) {
-        // Write data to DR register
-        I2C1->DR = *data;
-        
-        // Wait for data transmission to complete
-        while (!(I2C1->SR1 & I2C_SR1_TXE) && !(I2C1->SR1 & I2C_SR1_BTF));
-        
-        dataSize--;
-        data++;
-    }
-    
-    return E_OK;
+    return I2C_Transfer(address, data, dataSize, NULL, 0);
 }
 
 Std_ReturnType I2C_ReceiveData(u8 address, u8* data, u8 dataSize) {
-    // Receive data over I2C
-    
-    // Set the address in the data register
-    I2C1->DR = address;
-    
-    // Implement receiving data bytes by reading from the data register and handling transfer
-    
-    // Wait until data reception is complete (polling RXNE flag)
-    while (dataSize > 0) {
-        // Wait for data reception to complete
-        while (!(I2C1->SR1 & I2C_SR1_RXNE));
-        
-        // Read data from DR register
-        *data = I2C1->DR;
-        
-        dataSize--;
-        data++;
-    }
-    
-    return E_OK;
+    return I2C_Transfer(address, NULL, 0, data, dataSize);
+}
+
+Std_ReturnType I2C_WriteRead(u8 address, const u8* writeData, u8 writeSize, u8* readData, u8 readSize) {
+    return I2C_Transfer(address, writeData, writeSize, readData, readSize);
+}
+/*****************************< Interrupt handlers *****************************/
+void I2C1_EV_IRQHandler(void) {
+    u32 Local_SR1 = I2C1->SR1;
+
+    /**< The interface is master from SB until the transaction ends; any other event is a slave event */
+    if ((I2C_Phase != I2C_PHASE_IDLE) && (I2C_MasterActive || (Local_SR1 & I2C_SR1_SB))) {
+        I2C_HandleMasterEvent(Local_SR1);
+    } else {
+        I2C_HandleSlaveEvent(Local_SR1);
+    }
+}
+
+void I2C1_ER_IRQHandler(void) {
+    u32 Local_SR1 = I2C1->SR1;
+    u8 Local_Status;
+
+    /**< Clear the error flags that were seen; the other bits ignore the write */
+    I2C1->SR1 = ~(Local_SR1 & I2C_SR1_ERRORS);
+
+    if (I2C_MasterActive == 0) {
+        /**< AF ends every slave read (the master NACKs its last byte); anything else drops the slave transfer */
+        if ((Local_SR1 & I2C_SR1_AF) == 0) {
+            I2C_SlaveEndWrite();
+        }
+        I2C_SlaveState = I2C_SLAVE_IDLE;
+        I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+        return;
+    }
+
+    if (Local_SR1 & I2C_SR1_AF) {
+        /**< Address or data NACK: release the bus */
+        I2C1->CR1 |= I2C_CR1_STOP;
+        Local_Status = I2C_STATUS_NACK;
+    } else if (Local_SR1 & I2C_SR1_ARLO) {
+        /**< The interface has already dropped to slave mode and released the bus */
+        Local_Status = I2C_STATUS_ARB_LOST;
+    } else {
+        /**< Bus error or overrun: the bus state is unknown */
+        I2C_RecoverBus();
+        Local_Status = I2C_STATUS_BUS_ERROR;
+    }
+
+    I2C_Finish(Local_Status);
 }
 /*****************************< Private function definitions *****************************/
+static void I2C_HandleMasterEvent(u32 Copy_SR1) {
+    I2C_Transaction_t *Local_pTransaction = I2C_pQueueHead;
+
+    if (Copy_SR1 & I2C_SR1_SB) {
+        /**< EV5: reading SR1 then writing DR with the address clears SB */
+        I2C_MasterActive = 1;
+        if (I2C_Phase == I2C_PHASE_RESTART) {
+            I2C_Phase = I2C_PHASE_READ;
+        }
+        I2C1->DR = ((u32)Local_pTransaction->Address << 1) |
+                   ((I2C_Phase == I2C_PHASE_READ) ? I2C_Direction_Receiver : I2C_Direction_Transmitter);
+        return;
+    }
+
+    if (I2C_Phase == I2C_PHASE_RESTART) {
+        /**< BTF of the last written byte stays set until the repeated start is on the bus: ignore it */
+        return;
+    }
+
+    if (Copy_SR1 & I2C_SR1_ADDR) {
+        /**< EV6: the acknowledge setup for the last bytes must be in place before ADDR is cleared */
+        if (I2C_USE_DMA((I2C_Phase == I2C_PHASE_WRITE) ? Local_pTransaction->WriteLength : Local_pTransaction->ReadLength)) {
+            I2C_StartDma();
+        } else if (I2C_Phase == I2C_PHASE_WRITE) {
+            I2C_ClearADDRFlag(I2C1);
+            if (Local_pTransaction->WriteLength == 0) {
+                /**< Address-only probe */
+                I2C1->CR1 |= I2C_CR1_STOP;
+                I2C_Finish(I2C_STATUS_DONE);
+            } else {
+                I2C1->CR2 |= I2C_CR2_ITBUFEN;
+            }
+        } else if (Local_pTransaction->ReadLength == 1) {
+            /**< EV6_3: NACK the only byte and request the stop before it arrives */
+            I2C_DisableAck(I2C1);
+            I2C_ClearADDRFlag(I2C1);
+            I2C1->CR1 |= I2C_CR1_STOP;
+            I2C1->CR2 |= I2C_CR2_ITBUFEN;
+        } else if (Local_pTransaction->ReadLength == 2) {
+            /**< POS: the NACK applies to the second byte; both are read at BTF */
+            I2C_DisableAck(I2C1);
+            I2C1->CR1 |= I2C_CR1_POS;
+            I2C_ClearADDRFlag(I2C1);
+            I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+        } else {
+            I2C_EnableAck(I2C1);
+            I2C_ClearADDRFlag(I2C1);
+            if (Local_pTransaction->ReadLength > 3) {
+                I2C1->CR2 |= I2C_CR2_ITBUFEN;
+            } else {
+                I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+            }
+        }
+        return;
+    }
+
+    if (I2C_Phase == I2C_PHASE_WRITE) {
+        if ((Copy_SR1 & I2C_SR1_TXE) && (I2C_Index < Local_pTransaction->WriteLength)) {
+            /**< EV8: feed the next byte */
+            I2C_MasterHandleTXEInterrupt(I2C1, &Local_pTransaction->pWriteData[I2C_Index]);
+            I2C_Index++;
+            if (I2C_Index == Local_pTransaction->WriteLength) {
+                /**< Last byte loaded: wait for BTF instead of further TXE events */
+                I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+            }
+        } else if (Copy_SR1 & I2C_SR1_BTF) {
+            /**< EV8_2: the last byte has been acknowledged */
+            if (Local_pTransaction->ReadLength != 0) {
+                /**< Repeated start: keep the bus and turn around into the read phase once SB is seen */
+                I2C_Phase = I2C_PHASE_RESTART;
+                I2C_Index = 0;
+                I2C1->CR1 |= I2C_CR1_START;
+            } else {
+                I2C1->CR1 |= I2C_CR1_STOP;
+                I2C_Finish(I2C_STATUS_DONE);
+            }
+        }
+        return;
+    }
+
+    I2C_HandleReadEvent(Copy_SR1);
+}
+
+static void I2C_HandleSlaveEvent(u32 Copy_SR1) {
+    u8 Local_Byte;
+
+    if (Copy_SR1 & I2C_SR1_ADDR) {
+        /**< A repeated start ends the previous write without a stop */
+        I2C_SlaveEndWrite();
+
+        /**< Reading SR2 after SR1 clears ADDR */
+        if (I2C1->SR2 & I2C_SR2_TRA) {
+            /**< Slave transmitter: one byte at a time on BTF, so no byte is preloaded past the master's NACK */
+            I2C_SlaveState = I2C_SLAVE_TRANSMIT;
+            I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+            I2C1->DR = I2C_SlaveReadRegister(I2C_SlavePointer++);
+        } else {
+            /**< Slave receiver: the first byte sets the register pointer */
+            I2C_SlaveState = I2C_SLAVE_RECEIVE_POINTER;
+            I2C1->CR2 |= I2C_CR2_ITBUFEN;
+        }
+        return;
+    }
+
+    if (Copy_SR1 & I2C_SR1_RXNE) {
+        Local_Byte = (u8)I2C1->DR;
+        if (I2C_SlaveState == I2C_SLAVE_RECEIVE_POINTER) {
+            I2C_SlavePointer = Local_Byte;
+            I2C_SlaveWriteFirst = Local_Byte;
+            I2C_SlaveWriteCount = 0;
+            I2C_SlaveState = I2C_SLAVE_RECEIVE_DATA;
+        } else if (I2C_SlaveState == I2C_SLAVE_RECEIVE_DATA) {
+            I2C_SlaveWriteRegister(I2C_SlavePointer++, Local_Byte);
+            I2C_SlaveWriteCount++;
+        }
+    } else if ((I2C_SlaveState == I2C_SLAVE_TRANSMIT) && ((Copy_SR1 & (I2C_SR1_TXE | I2C_SR1_BTF)) == (I2C_SR1_TXE | I2C_SR1_BTF))) {
+        /**< The previous byte was acknowledged: the master wants the next register */
+        I2C1->DR = I2C_SlaveReadRegister(I2C_SlavePointer++);
+    }
+
+    if (Copy_SR1 & I2C_SR1_STOPF) {
+        /**< STOPF is cleared by reading SR1 then writing CR1 */
+        I2C1->CR1 |= 0;
+        I2C_SlaveEndWrite();
+        I2C_SlaveState = I2C_SLAVE_IDLE;
+    }
+
+    if (I2C_SlaveState == I2C_SLAVE_IDLE) {
+        /**< Nothing to feed: keep TXE/RXNE from re-entering */
+        I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+    }
+}
+
+static u8 I2C_SlaveReadRegister(u8 Copy_Register) {
+    const I2C_SlaveRegion_t *Local_pRegion = I2C_SlaveFindRegion(Copy_Register, I2C_SLAVE_ACCESS_READ);
+
+    return (Local_pRegion != NULL) ? Local_pRegion->pData[Copy_Register - Local_pRegion->FirstRegister] : I2C_SLAVE_FILL_BYTE;
+}
+
+static void I2C_SlaveWriteRegister(u8 Copy_Register, u8 Copy_Value) {
+    const I2C_SlaveRegion_t *Local_pRegion = I2C_SlaveFindRegion(Copy_Register, I2C_SLAVE_ACCESS_WRITE);
+
+    /**< Writes to read-only or unmapped registers are acknowledged and dropped */
+    if (Local_pRegion != NULL) {
+        Local_pRegion->pData[Copy_Register - Local_pRegion->FirstRegister] = Copy_Value;
+    }
+}
+
+static const I2C_SlaveRegion_t *I2C_SlaveFindRegion(u8 Copy_Register, u8 Copy_Access) {
+    const I2C_SlaveMap_t *Local_pMap = I2C_pSlaveMap;
+    const I2C_SlaveRegion_t *Local_pRegion;
+    u8 Local_Index;
+
+    if (Local_pMap == NULL) {
+        return NULL;
+    }
+
+    for (Local_Index = 0; Local_Index < Local_pMap->RegionCount; Local_Index++) {
+        Local_pRegion = &Local_pMap->pRegions[Local_Index];
+        if ((Copy_Register >= Local_pRegion->FirstRegister) &&
+            ((u8)(Copy_Register - Local_pRegion->FirstRegister) < Local_pRegion->Count)) {
+            return ((Local_pRegion->Access & Copy_Access) != 0) ? Local_pRegion : NULL;
+        }
+    }
+
+    return NULL;
+}
+
+static void I2C_SlaveEndWrite(void) {
+    const I2C_SlaveMap_t *Local_pMap = I2C_pSlaveMap;
+
+    if ((I2C_SlaveState == I2C_SLAVE_RECEIVE_DATA) && (I2C_SlaveWriteCount != 0) &&
+        (Local_pMap != NULL) && (Local_pMap->pfWriteCallback != NULL)) {
+        Local_pMap->pfWriteCallback(I2C_SlaveWriteFirst, I2C_SlaveWriteCount);
+    }
+    I2C_SlaveWriteCount = 0;
+}
+
 static void I2C_ClearADDRFlag(I2C_RegDef_t *pI2Cx) {
     // Clear ADDR flag by reading SR1 and SR2 registers
     volatile uint32_t dummyRead;
@@ -107,7 +418,7 @@ static void I2C_DisableAck(I2C_RegDef_t *pI2Cx) {
     pI2Cx->CR1 &= ~I2C_CR1_ACK;
 }
 
-static void I2C_MasterHandleTXEInterrupt(I2C_RegDef_t *pI2Cx, uint8_t *pData) {
+static void I2C_MasterHandleTXEInterrupt(I2C_RegDef_t *pI2Cx, const uint8_t *pData) {
     // Handle TXE interrupt (transmit buffer empty)
     // Write data to DR register for transmission
     pI2Cx->DR = *pData;
@@ -117,4 +428,307 @@ static void I2C_MasterHandleRXNEInterrupt(I2C_RegDef_t *pI2Cx, uint8_t *pData) {
     // Handle RXNE interrupt (receive buffer not empty)
     // Read data from DR register
     *pData = pI2Cx->DR;
-}
\ No newline at end of file
+}
+
+static Std_ReturnType I2C_Configure(void) {
+    const I2C_Config_t *Local_pConfig = &I2C_SavedConfig;
+    u32 Local_PClk1 = MCAL_RCC_GetPclk1();
+    u32 Local_FreqMHz = Local_PClk1 / 1000000UL;
+    u32 Local_CCR;
+    u32 Local_TRISE;
+
+    if ((Local_pConfig->ClockSpeed == 0) || (Local_FreqMHz < 2) || (Local_FreqMHz > 36)) {
+        return E_NOT_OK;
+    }
+
+    if (Local_pConfig->SpeedMode == I2C_SPEED_STANDARD) {
+        if (Local_pConfig->ClockSpeed > 100000UL) {
+            return E_NOT_OK;
+        }
+        /**< Thigh = Tlow = CCR x Tpclk1, at least 4; 1000 ns maximum rise time */
+        Local_CCR = Local_PClk1 / (2UL * Local_pConfig->ClockSpeed);
+        if (Local_CCR < 4) {
+            Local_CCR = 4;
+        }
+        Local_TRISE = Local_FreqMHz + 1UL;
+    } else {
+        if ((Local_pConfig->ClockSpeed > 400000UL) || (Local_FreqMHz < 4)) {
+            return E_NOT_OK;
+        }
+        /**< Tlow/Thigh = 2 (3 x CCR per period) or 16/9 (25 x CCR per period); 300 ns maximum rise time */
+        if (Local_pConfig->DutyCycle == I2C_DutyCycle_2) {
+            Local_CCR = Local_PClk1 / (3UL * Local_pConfig->ClockSpeed);
+        } else {
+            Local_CCR = Local_PClk1 / (25UL * Local_pConfig->ClockSpeed);
+        }
+        if (Local_CCR == 0) {
+            Local_CCR = 1;
+        }
+        Local_TRISE = ((Local_FreqMHz * 300UL) / 1000UL) + 1UL;
+    }
+
+    if (Local_CCR > I2C_CCR_CCR) {
+        return E_NOT_OK;
+    }
+
+    if (Local_pConfig->SpeedMode == I2C_SPEED_FAST) {
+        Local_CCR |= I2C_CCR_FS | ((Local_pConfig->DutyCycle == I2C_DutyCycle_16_9) ? I2C_CCR_DUTY : 0);
+    }
+
+    /**< CCR and TRISE may only be written while the peripheral is disabled */
+    I2C1->CR1 = 0;
+    I2C1->CR2 = Local_FreqMHz | I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+    I2C1->CCR = Local_CCR;
+    I2C1->TRISE = Local_TRISE;
+    I2C1->OAR1 = I2C_OAR1_BIT14 | ((u32)Local_pConfig->OwnAddress1 << I2C_OAR1_ADD_SHIFT);
+
+    if (Local_pConfig->Mode == I2C_Mode_SMBusDevice) {
+        I2C1->CR1 = I2C_CR1_SMBUS;
+    } else if (Local_pConfig->Mode == I2C_Mode_SMBusHost) {
+        I2C1->CR1 = I2C_CR1_SMBUS | I2C_CR1_SMBTYPE;
+    }
+    I2C1->CR1 |= I2C_CR1_PE;
+
+    /**< ACK is held cleared while PE = 0, so it is set after enabling */
+    if (Local_pConfig->Ack == ENABLE) {
+        I2C_EnableAck(I2C1);
+    }
+
+    return E_OK;
+}
+
+static void I2C_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew) {
+    (void)Copy_pPrevious;
+    (void)Copy_pNew;
+
+    if (Copy_Event == RCC_CLOCK_PRE_CHANGE) {
+        /**< A transaction clocked across the change would see SCL stretch or shrink mid-byte */
+        while (I2C_IsBusy()) {
+            I2C_ProcessTimeouts();
+        }
+    } else if (I2C_SavedConfig.ClockSpeed != 0) {
+        /**< I2C_Configure reads the new PCLK1 */
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+        I2C_Configure();
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+    }
+}
+
+static void I2C_StartHead(void) {
+    I2C_Transaction_t *Local_pTransaction = I2C_pQueueHead;
+    u32 Local_BitUs;
+    u32 Local_DeadlineUs;
+
+    /**< The stop of the previous transaction must have reached the bus before the next start */
+    I2C_WaitStop();
+
+    I2C_Phase = ((Local_pTransaction->WriteLength != 0) || (Local_pTransaction->ReadLength == 0)) ? I2C_PHASE_WRITE : I2C_PHASE_READ;
+    I2C_Index = 0;
+
+    /**< Bus time of every byte at the configured SCL rate, rounded up per bit, plus the fixed margin */
+    Local_BitUs = (I2C_SavedConfig.ClockSpeed != 0) ? ((1000000UL + I2C_SavedConfig.ClockSpeed - 1UL) / I2C_SavedConfig.ClockSpeed) : 10UL;
+    Local_DeadlineUs = ((u32)Local_pTransaction->WriteLength + Local_pTransaction->ReadLength + I2C_FRAME_BYTES) * I2C_BYTE_BITS * Local_BitUs;
+    Local_DeadlineUs = (Local_DeadlineUs < (I2C_TIMEOUT_MAX_US - I2C_TIMEOUT_US)) ? (Local_DeadlineUs + I2C_TIMEOUT_US) : I2C_TIMEOUT_MAX_US;
+    I2C_DeadlineCycles = MCAL_DWT_UsToCycles(Local_DeadlineUs);
+    I2C_StartCycles = MCAL_DWT_GetCycles();
+
+    I2C1->CR1 &= ~I2C_CR1_POS;
+    I2C1->CR1 |= I2C_CR1_START;
+}
+
+static void I2C_WaitStop(void) {
+    u32 Local_StartCycles = MCAL_DWT_GetCycles();
+    u32 Local_WaitCycles = I2C_STOP_WAIT_CYCLES;
+
+    /**< Bounded in time, not in iterations, so the bound holds at any core clock */
+    while ((I2C1->CR1 & I2C_CR1_STOP) && ((MCAL_DWT_GetCycles() - Local_StartCycles) < Local_WaitCycles));
+}
+
+static void I2C_Finish(u8 Copy_Status) {
+    I2C_Transaction_t *Local_pTransaction = I2C_pQueueHead;
+
+    if (I2C_DmaActive) {
+        /**< Aborted during a DMA data phase */
+        MCAL_DMA_Stop(I2C_DMA_TX_CHANNEL);
+        MCAL_DMA_Stop(I2C_DMA_RX_CHANNEL);
+        I2C_DmaActive = 0;
+    }
+
+    I2C1->CR2 = (I2C1->CR2 & ~(I2C_CR2_ITBUFEN | I2C_CR2_DMAEN | I2C_CR2_LAST)) | I2C_CR2_ITEVTEN;
+    I2C1->CR1 &= ~I2C_CR1_POS;
+    I2C_Phase = I2C_PHASE_IDLE;
+    I2C_MasterActive = 0;
+
+    /**< Restore the acknowledge setting used when addressed as a slave */
+    if (I2C_SavedConfig.Ack == ENABLE) {
+        I2C_EnableAck(I2C1);
+    } else {
+        I2C_DisableAck(I2C1);
+    }
+
+    I2C_pQueueHead = Local_pTransaction->pNext;
+    if (I2C_pQueueHead == NULL) {
+        I2C_pQueueTail = NULL;
+
+        /**< The stop condition is generated by I2C1, so its clock may only be gated once it is on the bus */
+        I2C_WaitStop();
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, RCC_APB1ENR_I2C1EN);
+    } else {
+        /**< Start the next one first, so a callback that submits simply queues behind it */
+        I2C_StartHead();
+    }
+
+    Local_pTransaction->Status = Copy_Status;
+    if (Local_pTransaction->pfCallback != NULL) {
+        Local_pTransaction->pfCallback(Copy_Status, Local_pTransaction->pvContext);
+    }
+}
+
+static void I2C_HandleReadEvent(u32 Copy_SR1) {
+    I2C_Transaction_t *Local_pTransaction = I2C_pQueueHead;
+    u16 Local_Remaining = Local_pTransaction->ReadLength - I2C_Index;
+
+    if (Local_Remaining > 3) {
+        /**< EV7: one byte per RXNE until three are left */
+        if (Copy_SR1 & I2C_SR1_RXNE) {
+            I2C_MasterHandleRXNEInterrupt(I2C1, &Local_pTransaction->pReadData[I2C_Index++]);
+            if (Local_Remaining == 4) {
+                I2C1->CR2 &= ~I2C_CR2_ITBUFEN;
+            }
+        }
+    } else if (Local_Remaining == 3) {
+        /**< BTF with byte N-2 in DR and N-1 in the shift register: NACK the last byte, then read N-2 */
+        if (Copy_SR1 & I2C_SR1_BTF) {
+            I2C_DisableAck(I2C1);
+            I2C_MasterHandleRXNEInterrupt(I2C1, &Local_pTransaction->pReadData[I2C_Index++]);
+        }
+    } else if (Local_Remaining == 2) {
+        /**< BTF with the last two bytes in DR and the shift register: stop, then read both */
+        if (Copy_SR1 & I2C_SR1_BTF) {
+            I2C1->CR1 |= I2C_CR1_STOP;
+            I2C_MasterHandleRXNEInterrupt(I2C1, &Local_pTransaction->pReadData[I2C_Index++]);
+            I2C_MasterHandleRXNEInterrupt(I2C1, &Local_pTransaction->pReadData[I2C_Index++]);
+            I2C_Finish(I2C_STATUS_DONE);
+        }
+    } else if (Copy_SR1 & I2C_SR1_RXNE) {
+        /**< Single-byte read: the stop was requested at EV6_3 */
+        I2C_MasterHandleRXNEInterrupt(I2C1, &Local_pTransaction->pReadData[I2C_Index++]);
+        I2C_Finish(I2C_STATUS_DONE);
+    }
+}
+
+static void I2C_RecoverBus(void) {
+    u8 Local_Sda = GPIO_LOW;
+    u8 Local_Clock;
+
+    /**< Disable the peripheral and drive the pins as open-drain outputs, released high */
+    I2C1->CR1 = 0;
+    MCAL_GPIO_SetPinValue(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_HIGH);
+    MCAL_GPIO_SetPinValue(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_HIGH);
+    MCAL_GPIO_SetPinMode(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_OUTPUT_OPEN_DRAIN_2MHZ);
+    MCAL_GPIO_SetPinMode(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_OUTPUT_OPEN_DRAIN_2MHZ);
+
+    /**< Clock out the byte a slave may be stuck in until it releases SDA */
+    for (Local_Clock = 0; Local_Clock < I2C_RECOVERY_CLOCKS; Local_Clock++) {
+        MCAL_GPIO_GetPinValue(I2C_SDA_PORT, I2C_SDA_PIN, &Local_Sda);
+        if (Local_Sda == GPIO_HIGH) {
+            break;
+        }
+        MCAL_GPIO_SetPinValue(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_LOW);
+        MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+        MCAL_GPIO_SetPinValue(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_HIGH);
+        MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+    }
+
+    /**< Stop condition: SDA rises while SCL is high */
+    MCAL_GPIO_SetPinValue(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_LOW);
+    MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+    MCAL_GPIO_SetPinValue(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_LOW);
+    MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+    MCAL_GPIO_SetPinValue(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_HIGH);
+    MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+    MCAL_GPIO_SetPinValue(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_HIGH);
+    MCAL_DWT_DelayUs(I2C_RECOVERY_HALF_US);
+
+    /**< Hand the pins back and reset the peripheral, which also clears a stuck BUSY flag */
+    MCAL_GPIO_SetPinMode(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_OUTPUT_AF_OPEN_DRAIN_2MHZ);
+    MCAL_GPIO_SetPinMode(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_OUTPUT_AF_OPEN_DRAIN_2MHZ);
+    I2C1->CR1 = I2C_CR1_SWRST;
+    I2C1->CR1 = 0;
+    I2C_Configure();
+}
+
+static void I2C_StartDma(void) {
+    I2C_Transaction_t *Local_pTransaction = I2C_pQueueHead;
+
+    I2C_DmaActive = 1;
+
+    if (I2C_Phase == I2C_PHASE_WRITE) {
+        MCAL_DMA_Start(I2C_DMA_TX_CHANNEL, (u32)&I2C1->DR, Local_pTransaction->pWriteData, Local_pTransaction->WriteLength);
+        I2C1->CR2 = (I2C1->CR2 & ~(I2C_CR2_ITBUFEN | I2C_CR2_ITEVTEN)) | I2C_CR2_DMAEN;
+    } else {
+        /**< ACK every byte but the last; LAST makes the interface NACK the byte after DMA EOT-1 */
+        I2C_EnableAck(I2C1);
+        MCAL_DMA_Start(I2C_DMA_RX_CHANNEL, (u32)&I2C1->DR, Local_pTransaction->pReadData, Local_pTransaction->ReadLength);
+        I2C1->CR2 = (I2C1->CR2 & ~(I2C_CR2_ITBUFEN | I2C_CR2_ITEVTEN)) | I2C_CR2_DMAEN | I2C_CR2_LAST;
+    }
+
+    /**< DMAEN must be set before ADDR is cleared, or the first request is missed */
+    I2C_ClearADDRFlag(I2C1);
+}
+
+static void I2C_DmaTxCallback(u8 Copy_Event) {
+    if ((I2C_DmaActive == 0) || (I2C_Phase != I2C_PHASE_WRITE)) {
+        return;
+    }
+
+    if (Copy_Event == DMA_EVENT_COMPLETE) {
+        /**< The last byte is in DR: let BTF (EV8_2) decide between a repeated start and a stop */
+        I2C_DmaActive = 0;
+        I2C_Index = I2C_pQueueHead->WriteLength;
+        I2C1->CR2 = (I2C1->CR2 & ~I2C_CR2_DMAEN) | I2C_CR2_ITEVTEN;
+    } else if (Copy_Event == DMA_EVENT_ERROR) {
+        I2C_RecoverBus();
+        I2C_Finish(I2C_STATUS_BUS_ERROR);
+    }
+}
+
+static void I2C_DmaRxCallback(u8 Copy_Event) {
+    if ((I2C_DmaActive == 0) || (I2C_Phase != I2C_PHASE_READ)) {
+        return;
+    }
+
+    if (Copy_Event == DMA_EVENT_COMPLETE) {
+        /**< Every byte is in memory and the last one was NACKed: only the stop is left */
+        I2C1->CR1 |= I2C_CR1_STOP;
+        I2C_DmaActive = 0;
+        I2C_Index = I2C_pQueueHead->ReadLength;
+        I2C_Finish(I2C_STATUS_DONE);
+    } else if (Copy_Event == DMA_EVENT_ERROR) {
+        I2C_RecoverBus();
+        I2C_Finish(I2C_STATUS_BUS_ERROR);
+    }
+}
+
+static Std_ReturnType I2C_Transfer(u8 Copy_Address, const u8 *Copy_pWriteData, u16 Copy_WriteLength,
+                                   u8 *Copy_pReadData, u16 Copy_ReadLength) {
+    I2C_Transaction_t Local_Transaction = {0};
+
+    Local_Transaction.Address = Copy_Address;
+    Local_Transaction.pWriteData = Copy_pWriteData;
+    Local_Transaction.WriteLength = Copy_WriteLength;
+    Local_Transaction.pReadData = Copy_pReadData;
+    Local_Transaction.ReadLength = Copy_ReadLength;
+    Local_Transaction.Status = I2C_STATUS_DONE;
+
+    if (I2C_Submit(&Local_Transaction) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    /**< Wait on the transaction, not on SR1; the timeout check bounds the wait */
+    while (Local_Transaction.Status == I2C_STATUS_PENDING) {
+        I2C_ProcessTimeouts();
+    }
+
+    return (Local_Transaction.Status == I2C_STATUS_DONE) ? E_OK : E_NOT_OK;
+}
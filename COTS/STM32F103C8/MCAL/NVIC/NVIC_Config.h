@@ -70,6 +70,27 @@
  */
 #define PRIORITY_GROUPING   NVIC_4GROUP_4SUB
 
+/**
+ * @brief Interrupt Configuration Table (applied by MCAL_NVIC_vInit)
+ *
+ * Every interrupt used by the application is listed here once, so all priorities can be
+ * audited in one place. Each row is:
+ *
+ *     ENTRY(ARG, IRQn, GroupPriority, SubPriority, Enabled)
+ *
+ * - IRQn:          One of the NVIC_xxx_IRQn numbers.
+ * - GroupPriority: 0 to NVIC_MAX_GROUP_PRIORITY for the selected PRIORITY_GROUPING (NONE with NVIC_0GROUP_16SUB).
+ * - SubPriority:   0 to NVIC_MAX_SUB_PRIORITY for the selected PRIORITY_GROUPING (NONE with NVIC_16GROUP_0SUB).
+ * - Enabled:       NVIC_IRQ_ENABLED or NVIC_IRQ_DISABLED.
+ *
+ * ENTRY and ARG are supplied by the driver; keep them as written. An out-of-range value or an
+ * interrupt listed twice stops the build.
+ */
+#define NVIC_IRQ_TABLE(ENTRY, ARG)                                      \
+    ENTRY(ARG, NVIC_EXTI0_IRQn,     1, 0, NVIC_IRQ_DISABLED)            \
+    ENTRY(ARG, NVIC_TIM2_IRQn,      2, 0, NVIC_IRQ_DISABLED)            \
+    ENTRY(ARG, NVIC_USART1_IRQn,    3, 0, NVIC_IRQ_DISABLED)
+
 /**
  * @} User_Configuration
  */
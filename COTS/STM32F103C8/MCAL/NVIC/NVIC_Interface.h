@@ -138,6 +138,15 @@ typedef u8 IRQn_Type;
 /**
  * @} (end of NVIC_Interrupts NVIC Interrupt Numbers)
  */
+
+/**
+ * @name NVIC Configuration Table Enable Options
+ * @brief Values of the "Enabled" column of NVIC_IRQ_TABLE in NVIC_config.h.
+ * @{
+ */
+#define NVIC_IRQ_DISABLED           0   /**< Only the priority is configured by MCAL_NVIC_vInit */
+#define NVIC_IRQ_ENABLED            1   /**< MCAL_NVIC_vInit configures the priority and enables the interrupt */
+/** @} */
          
 /**
  * @defgroup NVIC_Control NVIC Control Functions
@@ -145,6 +154,20 @@ typedef u8 IRQn_Type;
  * @{
  */
 
+/**
+ * @brief Apply the interrupt configuration table in one pass.
+ *
+ * This function sets the priority grouping, writes the priorities of every interrupt listed in
+ * NVIC_IRQ_TABLE (NVIC_config.h) and enables the ones marked NVIC_IRQ_ENABLED. The table is
+ * checked at compile time against NUMBER_OF_INTERRUPTS and PRIORITY_GROUPING, and the register
+ * images are computed by the compiler, so at run time only one read-modify-write per touched
+ * IPR word and one write per ISER word are performed.
+ *
+ * @note Call this once at startup, after the peripheral drivers are initialized and before
+ *       global interrupts are enabled.
+ */
+void MCAL_NVIC_vInit(void);
+
 /**
  * @brief Enable a specific interrupt in the NVIC.
  *
@@ -232,8 +255,8 @@ Std_ReturnType MCAL_NVIC_xSetPriority(IRQn_Type Copy_IRQn, u8 Copy_Priority);
  * This function sets the priority of the specified interrupt in the NVIC.
  *
  * @param[in] Copy_IRQn         The interrupt number (IRQn_Type) to set the priority for.
- * @param[in] Copy_GroupPriority The group priority level (0 to 7, with 0 being the highest).
- * @param[in] Copy_SubPriority  The sub-priority level within the group (0 to 1, 2, or 3, depending on the chosen PRIORITY_GROUPING).
+ * @param[in] Copy_GroupPriority The group priority level (0 to NVIC_MAX_GROUP_PRIORITY, with 0 being the highest).
+ * @param[in] Copy_SubPriority  The sub-priority level within the group (0 to NVIC_MAX_SUB_PRIORITY).
  *
  * @return Std_ReturnType
  *   - E_OK     : Priority set successfully.
@@ -248,8 +271,11 @@ Std_ReturnType MCAL_NVIC_xSetPriority(IRQn_Type Copy_IRQn, u8 Copy_Priority);
  *   - Copy_GroupPriority should be in the range [0, 15] for NVIC_16GROUP_0SUB and NONE for NVIC_0GROUP_16SUB.
  *
  * @note When using other PRIORITY_GROUPING options (NVIC_8GROUP_2SUB, NVIC_4GROUP_4SUB, or NVIC_2GROUP_8SUB):
- *   - Copy_SubPriority can be in the range [0, 3].
- *   - Copy_GroupPriority can be in the range [0, 7].
+ *   - Copy_GroupPriority can be in the range [0, 7], [0, 3] or [0, 1].
+ *   - Copy_SubPriority can be in the range [0, 1], [0, 3] or [0, 7].
+ *
+ * @note The encoding is derived from PRIORITY_GROUPING at compile time; prefer NVIC_IRQ_TABLE
+ *       and MCAL_NVIC_vInit for priorities that are fixed at build time.
  *
  * @see NVIC_config.h for details on PRIORITY_GROUPING.
  */
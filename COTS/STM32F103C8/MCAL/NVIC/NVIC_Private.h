@@ -7,7 +7,6 @@
 #ifndef NVIC_PRIVATE_H_
 #define NVIC_PRIVATE_H_
 
-
 /**
  * @defgroup NVIC_Registers NVIC Registers
  * @brief NVIC (Nested Vectored Interrupt Controller) Registers.
@@ -75,9 +74,89 @@
 #define NVIC_0GROUP_16SUB   0x05FA0700U /**< No Grouping, 16 Sub-priority Levels */
 /** @} */
 
-
 /**
  * @} (end of group NVIC_Registers)
  */
 
+/**
+ * @defgroup NVIC_Priority_Encoding NVIC Priority Encoding
+ * @brief Compile-time encoding of group/sub priorities for the selected PRIORITY_GROUPING.
+ * @{
+ */
+#if (PRIORITY_GROUPING != NVIC_16GROUP_0SUB) && (PRIORITY_GROUPING != NVIC_8GROUP_2SUB) && \
+    (PRIORITY_GROUPING != NVIC_4GROUP_4SUB) && (PRIORITY_GROUPING != NVIC_2GROUP_8SUB) && \
+    (PRIORITY_GROUPING != NVIC_0GROUP_16SUB)
+#error "Invalid PRIORITY_GROUPING value. Please choose from NVIC_16GROUP_0SUB, NVIC_8GROUP_2SUB, NVIC_4GROUP_4SUB, NVIC_2GROUP_8SUB, or NVIC_0GROUP_16SUB."
+#endif
+
+#if NUMBER_OF_INTERRUPTS > 96
+#error "NUMBER_OF_INTERRUPTS exceeds the three ISER registers handled by this driver."
+#endif
+
+#define NVIC_PRIORITY_BITS          4U  /**< Priority bits implemented by the STM32F103 (upper nibble of each IPR byte) */
+#define NVIC_SUB_PRIORITY_BITS      ((((PRIORITY_GROUPING) >> 8) & 0x7U) - 3U)  /**< PRIGROUP 3..7 gives 0..4 sub-priority bits */
+#define NVIC_GROUP_PRIORITY_BITS    (NVIC_PRIORITY_BITS - NVIC_SUB_PRIORITY_BITS)
+
+#define NVIC_MAX_GROUP_PRIORITY     ((1U << NVIC_GROUP_PRIORITY_BITS) - 1U)
+#define NVIC_MAX_SUB_PRIORITY       ((1U << NVIC_SUB_PRIORITY_BITS) - 1U)
+
+/**< Check one priority field; NONE is accepted only for a field that has no bits */
+#define NVIC_IS_VALID_FIELD(VALUE, MAX) \
+    ((((VALUE) >= 0) && ((VALUE) <= (s32)(MAX))) || (((VALUE) == NONE) && ((MAX) == 0U)))
+
+/**< IPR byte for a group/sub priority pair (NONE masks to 0) */
+#define NVIC_ENCODE_PRIORITY(GROUP, SUB) \
+    ((u8)((((((u32)(GROUP) & NVIC_MAX_GROUP_PRIORITY) << NVIC_SUB_PRIORITY_BITS) | ((u32)(SUB) & NVIC_MAX_SUB_PRIORITY)) \
+           << (8U - NVIC_PRIORITY_BITS))))
+/** @} */
+
+/**
+ * @defgroup NVIC_Table_Images NVIC Configuration Table Register Images
+ * @brief Register images built by the compiler from NVIC_IRQ_TABLE.
+ * @{
+ */
+#define NVIC_IPR_WORDS              ((NUMBER_OF_INTERRUPTS + 3) / 4)
+#define NVIC_ISER_WORDS             3
+
+/**< Compile-time validation of the values of one table row (a negative array size stops the build) */
+#define NVIC_CHECK_ENTRY(ARG, IRQN, GROUP, SUB, ENABLED)                                    \
+    typedef char NVIC_CheckEntry_##IRQN[(((IRQN) < NUMBER_OF_INTERRUPTS) &&                 \
+                                        NVIC_IS_VALID_FIELD(GROUP, NVIC_MAX_GROUP_PRIORITY) && \
+                                        NVIC_IS_VALID_FIELD(SUB, NVIC_MAX_SUB_PRIORITY) &&   \
+                                        (((ENABLED) == NVIC_IRQ_ENABLED) || ((ENABLED) == NVIC_IRQ_DISABLED))) ? 1 : -1];
+
+/**< Contribution of one table row to IPR word W (value and byte mask) and to ISER word W */
+#define NVIC_IPR_VALUE_ENTRY(W, IRQN, GROUP, SUB, ENABLED) \
+    | ((((IRQN) >> 2) == (W)) ? ((u32)NVIC_ENCODE_PRIORITY(GROUP, SUB) << (((IRQN) & 3U) * 8U)) : 0U)
+#define NVIC_IPR_MASK_ENTRY(W, IRQN, GROUP, SUB, ENABLED) \
+    | ((((IRQN) >> 2) == (W)) ? (0xFFUL << (((IRQN) & 3U) * 8U)) : 0U)
+#define NVIC_ISER_ENTRY(W, IRQN, GROUP, SUB, ENABLED) \
+    | (((((IRQN) >> 5) == (W)) && ((ENABLED) == NVIC_IRQ_ENABLED)) ? (1UL << ((IRQN) & 31U)) : 0U)
+
+#define NVIC_IPR_VALUE(W)   (0U NVIC_IRQ_TABLE(NVIC_IPR_VALUE_ENTRY, W))
+#define NVIC_IPR_MASK(W)    (0U NVIC_IRQ_TABLE(NVIC_IPR_MASK_ENTRY, W))
+#define NVIC_ISER_VALUE(W)  (0U NVIC_IRQ_TABLE(NVIC_ISER_ENTRY, W))
+
+NVIC_IRQ_TABLE(NVIC_CHECK_ENTRY, 0)
+
+/**< Rows in the table, and the interrupts they name in word W (one bit per interrupt, as in ISER) */
+#define NVIC_ROW_ENTRY(ARG, IRQN, GROUP, SUB, ENABLED)  + 1U
+#define NVIC_BIT_ENTRY(W, IRQN, GROUP, SUB, ENABLED) \
+    | ((((IRQN) >> 5) == (W)) ? (1UL << ((IRQN) & 31U)) : 0U)
+
+#define NVIC_ROW_COUNT      (0U NVIC_IRQ_TABLE(NVIC_ROW_ENTRY, 0))
+#define NVIC_IRQ_BITS(W)    (0UL NVIC_IRQ_TABLE(NVIC_BIT_ENTRY, W))
+
+/**< Set bits of a 32-bit constant */
+#define NVIC_BIT_COUNT2(X)  ((X) - (((X) >> 1) & 0x55555555UL))
+#define NVIC_BIT_COUNT4(X)  ((NVIC_BIT_COUNT2(X) & 0x33333333UL) + ((NVIC_BIT_COUNT2(X) >> 2) & 0x33333333UL))
+#define NVIC_BIT_COUNT(X)   (((((NVIC_BIT_COUNT4(X) + (NVIC_BIT_COUNT4(X) >> 4)) & 0x0F0F0F0FUL) * 0x01010101UL) >> 24) & 0xFFUL)
+
+/**< An interrupt listed twice sets one bit for two rows, which stops the build */
+typedef char NVIC_CheckNoDuplicateEntry[(NVIC_ROW_COUNT == (NVIC_BIT_COUNT(NVIC_IRQ_BITS(0)) +
+                                                            NVIC_BIT_COUNT(NVIC_IRQ_BITS(1)) +
+                                                            NVIC_BIT_COUNT(NVIC_IRQ_BITS(2)))) ? 1 : -1];
+
+/** @} */
+
 #endif /**< NVIC_PRIVATE_H_ */
\ No newline at end of file
@@ -11,11 +11,66 @@
 /*****************************< MCAL *****************************/
 /**< NVIC */
 #include "NVIC_interface.h"
-#include "NVIC_private.h"
 #include "NVIC_config.h"
+#include "NVIC_private.h"
 /**< SCB */
 #include "SCB_interface.h"
+/*****************************< Global Variable Section *****************************/
+/**< IPR images for up to 96 interrupts; only the first NVIC_IPR_WORDS are applied */
+static const u32 NVIC_IPRValues[24] = {
+    NVIC_IPR_VALUE(0),  NVIC_IPR_VALUE(1),  NVIC_IPR_VALUE(2),  NVIC_IPR_VALUE(3),
+    NVIC_IPR_VALUE(4),  NVIC_IPR_VALUE(5),  NVIC_IPR_VALUE(6),  NVIC_IPR_VALUE(7),
+    NVIC_IPR_VALUE(8),  NVIC_IPR_VALUE(9),  NVIC_IPR_VALUE(10), NVIC_IPR_VALUE(11),
+    NVIC_IPR_VALUE(12), NVIC_IPR_VALUE(13), NVIC_IPR_VALUE(14), NVIC_IPR_VALUE(15),
+    NVIC_IPR_VALUE(16), NVIC_IPR_VALUE(17), NVIC_IPR_VALUE(18), NVIC_IPR_VALUE(19),
+    NVIC_IPR_VALUE(20), NVIC_IPR_VALUE(21), NVIC_IPR_VALUE(22), NVIC_IPR_VALUE(23)
+};
+
+static const u32 NVIC_IPRMasks[24] = {
+    NVIC_IPR_MASK(0),  NVIC_IPR_MASK(1),  NVIC_IPR_MASK(2),  NVIC_IPR_MASK(3),
+    NVIC_IPR_MASK(4),  NVIC_IPR_MASK(5),  NVIC_IPR_MASK(6),  NVIC_IPR_MASK(7),
+    NVIC_IPR_MASK(8),  NVIC_IPR_MASK(9),  NVIC_IPR_MASK(10), NVIC_IPR_MASK(11),
+    NVIC_IPR_MASK(12), NVIC_IPR_MASK(13), NVIC_IPR_MASK(14), NVIC_IPR_MASK(15),
+    NVIC_IPR_MASK(16), NVIC_IPR_MASK(17), NVIC_IPR_MASK(18), NVIC_IPR_MASK(19),
+    NVIC_IPR_MASK(20), NVIC_IPR_MASK(21), NVIC_IPR_MASK(22), NVIC_IPR_MASK(23)
+};
+
+static const u32 NVIC_ISERValues[NVIC_ISER_WORDS] = {
+    NVIC_ISER_VALUE(0), NVIC_ISER_VALUE(1), NVIC_ISER_VALUE(2)
+};
 /*****************************< Function Implementations *****************************/
+void MCAL_NVIC_vInit(void)
+{
+    u8 Local_Word;
+
+    /**< Configure the priority grouping the table was encoded for */
+    SCB_SetPriorityGrouping(PRIORITY_GROUPING);
+
+    /**< One read-modify-write per IPR word that holds at least one configured interrupt */
+    for (Local_Word = 0; Local_Word < NVIC_IPR_WORDS; Local_Word++)
+    {
+        if (NVIC_IPRMasks[Local_Word] != 0)
+        {
+            NVIC_IPR_BASE_ADDRESS[Local_Word] = (NVIC_IPR_BASE_ADDRESS[Local_Word] & ~NVIC_IPRMasks[Local_Word]) |
+                                                NVIC_IPRValues[Local_Word];
+        }
+    }
+
+    /**< ISER is write-one-to-set, so each word is enabled with a single write */
+    if (NVIC_ISERValues[0] != 0)
+    {
+        NVIC_ISER0 = NVIC_ISERValues[0];
+    }
+    if (NVIC_ISERValues[1] != 0)
+    {
+        NVIC_ISER1 = NVIC_ISERValues[1];
+    }
+    if (NVIC_ISERValues[2] != 0)
+    {
+        NVIC_ISER2 = NVIC_ISERValues[2];
+    }
+}
+
 Std_ReturnType MCAL_NVIC_EnableIRQ(IRQn_Type Copy_IRQn)
 {
    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
@@ -209,61 +264,28 @@ Std_ReturnType MCAL_NVIC_xSetPriority(IRQn_Type Copy_IRQn, u8 Copy_Priority)
 Std_ReturnType MCAL_NVIC_vSetPriority(IRQn_Type Copy_IRQn, u8 Copy_GroupPriority, u8 Copy_SubPriority)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
-    u8 NVIC_MAX_Group_Priority;
-    u8 NVIC_MAX_Sub_Priority;
-
-    #if (PRIORITY_GROUPING == NVIC_16GROUP_0SUB)
-        NVIC_MAX_Group_Priority = 15;
-        NVIC_MAX_Sub_Priority = NONE;
-    #elif (PRIORITY_GROUPING == NVIC_8GROUP_2SUB)
-        NVIC_MAX_Group_Priority = 7;
-        NVIC_MAX_Sub_Priority = 1;
-    #elif (PRIORITY_GROUPING == NVIC_4GROUP_4SUB)
-        NVIC_MAX_Group_Priority = 3;
-        NVIC_MAX_Sub_Priority = 3;
-    #elif (PRIORITY_GROUPING == NVIC_2GROUP_8SUB)
-        NVIC_MAX_Group_Priority = 1;
-        NVIC_MAX_Sub_Priority = 7;
-    #elif (PRIORITY_GROUPING == NVIC_0GROUP_16SUB)
-        NVIC_MAX_Group_Priority = NONE;
-        NVIC_MAX_Sub_Priority = 15;
-    #else
-        #error "Invalid PRIORITY_GROUPING value. Please choose from _16GROUP_SUB0, _8GROUP_SUB2, _4GROUP_SUB4, _2GROUP_SUB8, or _0GROUP_SUB16."
-    #endif
-
-    if (Copy_GroupPriority > NVIC_MAX_Group_Priority || Copy_SubPriority > NVIC_MAX_Sub_Priority)
+
+    /**< NONE is only meaningful for a field that has no bits in the selected grouping */
+    if ((NVIC_MAX_GROUP_PRIORITY == 0) && (Copy_GroupPriority == (u8)NONE))
     {
-        /**< Invalid priority value */
-        return Local_FunctionStatus;
+        Copy_GroupPriority = 0;
     }
-
-    if (Copy_IRQn > NUMBER_OF_INTERRUPTS)
+    if ((NVIC_MAX_SUB_PRIORITY == 0) && (Copy_SubPriority == (u8)NONE))
     {
-        /**< Check if IRQn is within valid range */
-        return Local_FunctionStatus;
+        Copy_SubPriority = 0;
     }
 
-    /**< Configure the priority grouping for the Nested Vectored Interrupt Controller (NVIC) */
-    SCB_SetPriorityGrouping(PRIORITY_GROUPING);
+    if ((Copy_IRQn < NUMBER_OF_INTERRUPTS) &&
+        (Copy_GroupPriority <= NVIC_MAX_GROUP_PRIORITY) && (Copy_SubPriority <= NVIC_MAX_SUB_PRIORITY))
+    {
+        /**< Configure the priority grouping for the Nested Vectored Interrupt Controller (NVIC) */
+        SCB_SetPriorityGrouping(PRIORITY_GROUPING);
 
-    /**< Calculate the Priority value will be added to the IPRx */
-    u8 Local_Priority = (Copy_SubPriority | (Copy_GroupPriority << (PRIORITY_GROUPING - NVIC_16GROUP_0SUB) / 0x100));
+        /**< The IPR registers are byte-accessible: write this interrupt's byte only */
+        ((volatile u8 *)NVIC_IPR_BASE_ADDRESS)[Copy_IRQn] = NVIC_ENCODE_PRIORITY(Copy_GroupPriority, Copy_SubPriority);
 
-    /**< Calculate the register index (IPRx) and bit position within the register */
-    u32 RegisterIndex = Copy_IRQn / 4;     /**< Divide by 4 to get the register index */
-    u32 BitPosition = (Copy_IRQn % 4) * 8; /**< Multiply by 8 to get the bit position */ 
-   
-    /**< Read the current value of the IPR register */ 
-    u32 RegValue = NVIC_IPR_BASE_ADDRESS[RegisterIndex];
-   
-    /**< Clear the bits that control the priority for the given interrupt */ 
-    RegValue &= ~(0xFF << BitPosition);
-
-    /**< Set the priority in the appropriate IPRx register */ 
-    RegValue |= (Local_Priority << BitPosition);
-    
-    /**< Write the modified value back to the IPR register */ 
-    NVIC_IPR_BASE_ADDRESS[RegisterIndex] = (RegValue << 4);
+        Local_FunctionStatus = E_OK;
+    }
 
     return Local_FunctionStatus;
 }
@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 26 Aug 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.2                        *****************/
 /******* File Name : RCC_config.h               *****************/
 /****************************************************************/
 #ifndef RCC_CONFIG_H_
@@ -13,6 +13,13 @@
  * @{
  */
 
+/**
+ * @brief Frequency of the external crystal or clock in Hz (8 MHz on the Blue Pill).
+ *
+ * The clock profiles derive their PLL multiplier from it: 72 MHz must be a multiple of it.
+ */
+#define RCC_HSE_FREQUENCY     8000000UL
+
 /**
  * @brief Select the system clock source.
  * @note Choose one of the available options:
@@ -33,24 +40,42 @@
 
 
 /**
- * @brief Configure the clock type for RCC_SYSCLK when using RCC_HSE.
+ * @brief Configure the clock type of the HSE, whenever it runs (HSE or PLL from the HSE).
  * @note Choose one of the available options:
  *       RCC_RC_CLK_       - RC oscillator will be the source of the clock system.
  *       RCC_CRYSTAL_CLK_  - Crystal oscillator will be the source of the clock system.
  */
-#if RCC_SYSCLK == RCC_HSE
-
 #define RCC_CLK_BYPASS        RCC_CRYSTAL_CLK_
-                                
-#endif /**< RCC_SYSCLK */
 
-#if RCC_SYSCLK == RCC_PLL
+/**
+ * @brief PLL input, when RCC_SYSCLK is RCC_PLL.
+ * @note Choose one of the available options:
+ *       RCC_PLL_SRC_HSI_DIV_2 - HSI / 2 (4 MHz).
+ *       RCC_PLL_SRC_HSE       - HSE.
+ *       RCC_PLL_SRC_HSE_DIV_2 - HSE / 2.
+ */
+#define RCC_PLL_SOURCE        RCC_PLL_SRC_HSE
 
+/**
+ * @brief PLL multiplier, 2 to 16. The PLL output must not exceed 72 MHz.
+ */
+#define RCC_PLL_MUL           9
 
-#endif /**< RCC_SYSCLK */
+/**
+ * @brief Bus prescalers.
+ * @note HCLK = SYSCLK / RCC_AHB_PRESCALER (RCC_AHB_DIV_1, 2, 4, 8, 16, 64, 128, 256 or 512).
+ *       PCLK1 = HCLK / RCC_APB1_PRESCALER and PCLK2 = HCLK / RCC_APB2_PRESCALER
+ *       (RCC_APB_DIV_1, 2, 4, 8 or 16). PCLK1 must not exceed 36 MHz.
+ */
+#define RCC_AHB_PRESCALER     RCC_AHB_DIV_1
+#define RCC_APB1_PRESCALER    RCC_APB_DIV_1
+#define RCC_APB2_PRESCALER    RCC_APB_DIV_1
 
 /** @} */ // end of RCC_System_Clock_Config
 
+/**
+ * @brief Number of drivers that can register for clock change notifications.
+ */
+#define RCC_MAX_CLOCK_NOTIFIERS     4
 
-                                
-#endif /**< RCC_CONFIG_H_ */
\ No newline at end of file
+#endif /**< RCC_CONFIG_H_ */
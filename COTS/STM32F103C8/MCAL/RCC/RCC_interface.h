@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 26 Aug 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.4                        *****************/
 /******* File Name : RCC_interface.h            *****************/
 /****************************************************************/
 #ifndef RCC_INTERFACE_H_
@@ -110,6 +110,49 @@
 
 /** @} */  /* End of RCC_Peripheral_Macros group */
 
+/**
+ * @defgroup RCC_Clock_Profiles Clock Profiles
+ * @brief Performance profiles for MCAL_RCC_SetProfile.
+ * @{
+ */
+
+#define RCC_PROFILE_72MHZ       0 /**< PLL from the HSE: SYSCLK = HCLK = PCLK2 = 72 MHz, PCLK1 = 36 MHz, 2 wait states. */
+#define RCC_PROFILE_36MHZ       1 /**< PLL from HSE / 2: every clock at 36 MHz, 1 wait state. */
+#define RCC_PROFILE_8MHZ        2 /**< PLL off, the HSE (or the HSI when the HSE is not 8 MHz): every clock at 8 MHz, no wait state. */
+
+/** @} */
+
+/**
+ * @defgroup RCC_Clock_Events Clock Change Events
+ * @{
+ */
+
+#define RCC_CLOCK_PRE_CHANGE    0 /**< The clocks are about to change: finish or hold the current transfer. */
+#define RCC_CLOCK_POST_CHANGE   1 /**< The clocks changed: recompute the dividers. */
+
+/** @} */
+
+/**
+ * @brief Clock frequencies in Hz.
+ */
+typedef struct
+{
+    u32 SysClk;     /**< System clock. */
+    u32 HClk;       /**< AHB clock: core, SysTick, DMA. */
+    u32 PClk1;      /**< APB1 clock: USART2/3, SPI2, I2C, TIM2..4. */
+    u32 PClk2;      /**< APB2 clock: USART1, SPI1, GPIO, ADC. */
+} RCC_Clocks_t;
+
+/**
+ * @brief Clock change notification.
+ *
+ * Called twice per change, in the context of the caller of MCAL_RCC_SetProfile: with
+ * RCC_CLOCK_PRE_CHANGE while the old clocks still run, then with RCC_CLOCK_POST_CHANGE once the
+ * new ones do. Both calls receive the previous and the new frequencies; after a failed change the
+ * new frequencies are the ones actually running.
+ */
+typedef void (*RCC_ClockNotifier_t)(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
 
 /**
  * @defgroup RCC_API RCC APIs
@@ -122,10 +165,13 @@
  *
  * This function initializes the system clock configuration according to the desired settings.
  * It should be called early in the program to properly configure the clock system.
+ * The source, the PLL, the bus prescalers of RCC_config.h and the matching flash wait states are
+ * applied; the PLL is started, and the system clock switched to it, only once it is locked.
  *
  * @return Std_ReturnType
  * @retval E_OK     Clock initialization successful.
- * @retval E_NOT_OK Clock initialization failed.
+ * @retval E_NOT_OK Clock initialization failed (an oscillator or the PLL did not start, or PCLK1
+ *                  would exceed 36 MHz).
  */
 Std_ReturnType MCAL_RCC_InitSysClock(void);
 
@@ -155,6 +201,99 @@ Std_ReturnType MCAL_RCC_EnablePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId);
  */
 Std_ReturnType MCAL_RCC_DisablePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId);
 
+/**
+ * @brief Take a reference on a peripheral clock, enabling it for the first user.
+ *
+ * Drivers acquire their clock around a transfer, or for as long as the peripheral has to run on its
+ * own (a receiver, a running timer, a DMA transfer), and release it afterwards. The clock is gated
+ * when the last user releases it, so idle peripherals draw no current. The registers keep their
+ * contents while the clock is gated, but cannot be read or written.
+ *
+ * @param[in] Copy_BusId        RCC_AHB, RCC_APB1 or RCC_APB2.
+ * @param[in] Copy_PeripheralId The enable bit of the peripheral on that bus.
+ * @return Std_ReturnType
+ * @retval E_OK     The clock runs.
+ * @retval E_NOT_OK Invalid bus or peripheral, or the reference count is saturated.
+ *
+ * @note Safe to call from interrupts. MCAL_RCC_EnablePeripheral and MCAL_RCC_DisablePeripheral
+ *       bypass the reference counts: do not mix them with this for the same peripheral.
+ */
+Std_ReturnType MCAL_RCC_AcquirePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId);
+
+/**
+ * @brief Drop a reference taken with MCAL_RCC_AcquirePeripheral, gating the clock for the last user.
+ *
+ * @param[in] Copy_BusId        RCC_AHB, RCC_APB1 or RCC_APB2.
+ * @param[in] Copy_PeripheralId The enable bit of the peripheral on that bus.
+ * @return Std_ReturnType
+ * @retval E_OK     The reference was dropped.
+ * @retval E_NOT_OK Invalid bus or peripheral, or no reference is held.
+ */
+Std_ReturnType MCAL_RCC_ReleasePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId);
+
+/**
+ * @brief Switch to a performance profile at run time.
+ *
+ * The PLL, the flash wait states and the bus prescalers are reprogrammed in a safe order, and the
+ * registered drivers (UART, SPI, I2C, the timers and SysTick register themselves) recompute their
+ * dividers. Unused oscillators are stopped; the HSI always stays on since the flash programming
+ * needs it.
+ *
+ * @param[in] Copy_Profile RCC_PROFILE_72MHZ, RCC_PROFILE_36MHZ or RCC_PROFILE_8MHZ.
+ * @return Std_ReturnType
+ * @retval E_OK     The profile is running.
+ * @retval E_NOT_OK Unknown profile, RCC_HSE_FREQUENCY cannot give 72 MHz, or an oscillator or the
+ *                  PLL did not start (the clocks then stay on a valid, reported setting).
+ *
+ * @note Call from thread context, not while a driver is in the middle of a transfer.
+ */
+Std_ReturnType MCAL_RCC_SetProfile(u8 Copy_Profile);
+
+/**
+ * @brief Register a function to be called around every clock change.
+ *
+ * Registering the same function again has no effect.
+ *
+ * @param[in] Copy_pfNotifier The notifier.
+ * @return Std_ReturnType
+ * @retval E_OK     The notifier is registered.
+ * @retval E_NOT_OK NULL, or RCC_MAX_CLOCK_NOTIFIERS are already registered.
+ */
+Std_ReturnType MCAL_RCC_RegisterClockNotifier(RCC_ClockNotifier_t Copy_pfNotifier);
+
+/**
+ * @brief Get the system clock (SYSCLK) frequency.
+ *
+ * The frequencies are computed from the RCC registers once, on the first query, and kept up to
+ * date by MCAL_RCC_InitSysClock and MCAL_RCC_SetProfile, so a query only reads a variable. Drivers
+ * derive their baud rates, prescalers and delays from these instead of hardcoded clocks.
+ *
+ * @return The frequency in Hz.
+ */
+u32 MCAL_RCC_GetSysclk(void);
+
+/**
+ * @brief Get the AHB clock (HCLK) frequency: core, SysTick, DWT cycle counter and DMA.
+ *
+ * @return The frequency in Hz.
+ */
+u32 MCAL_RCC_GetHclk(void);
+
+/**
+ * @brief Get the APB1 clock (PCLK1) frequency: USART2/3, SPI2, I2C1/2 and TIM2..4.
+ *
+ * @return The frequency in Hz.
+ * @note The APB1 timers run at twice PCLK1 when the APB1 prescaler is not 1.
+ */
+u32 MCAL_RCC_GetPclk1(void);
+
+/**
+ * @brief Get the APB2 clock (PCLK2) frequency: USART1, SPI1, GPIO, ADC and TIM1.
+ *
+ * @return The frequency in Hz.
+ */
+u32 MCAL_RCC_GetPclk2(void);
+
 /**
  * @}
  */
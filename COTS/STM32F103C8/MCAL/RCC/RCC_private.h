@@ -1,8 +1,8 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 26 Aug 2023                *****************/
-/******* Version   : 0.1                        *****************/
-/******* File Name : BIT_private.h              *****************/
+/******* Version   : 0.4                        *****************/
+/******* File Name : RCC_private.h              *****************/
 /****************************************************************/
 #ifndef RCC_PRIVATE_H_
 #define RCC_PRIVATE_H_
@@ -87,6 +87,13 @@
  */
 #define RCC_CSR                 (*((volatile u32 *)0x40021024))
 
+/**
+ * @brief Flash Access Control Register (FLASH_ACR)
+ *
+ * Wait states and prefetch buffer; they must follow the system clock.
+ */
+#define RCC_FLASH_ACR           (*((volatile u32 *)0x40022000))
+
 /** @} */ // end of RCC Control Register (CR)
 
 /**
@@ -100,13 +107,49 @@
 #define RCC_CR_HSEON        16  /**< External High-Speed Clock Enable */
 #define RCC_CR_HSERDY       17  /**< External High-Speed Clock Ready */
 #define RCC_CR_HSEBYP       18  /**< External High-Speed Clock Bypass */
-#define RCC_CR_HSEPRE       19  /**< External High-Speed Clock Prescaler */
-#define RCC_CR_CSSON        24  /**< Clock Security System Enable */
+#define RCC_CR_CSSON        19  /**< Clock Security System Enable */
 #define RCC_CR_PLLON        24  /**< PLL Enable */
 #define RCC_CR_PLLRDY       25  /**< PLL Ready */
 
 /** @} */ // end of RCC_CR_Bit_Definitions
 
+/**
+ * @defgroup RCC_CFGR_Bit_Definitions RCC Configuration Register (RCC_CFGR) Bit Definitions
+ * @{
+ */
+
+#define RCC_CFGR_SW         0   /**< System clock switch (2 bits) */
+#define RCC_CFGR_SWS        2   /**< System clock switch status (2 bits) */
+#define RCC_CFGR_HPRE       4   /**< AHB prescaler (4 bits) */
+#define RCC_CFGR_PPRE1      8   /**< APB1 prescaler (3 bits) */
+#define RCC_CFGR_PPRE2      11  /**< APB2 prescaler (3 bits) */
+#define RCC_CFGR_PLLSRC     16  /**< PLL entry clock source: HSI / 2 or HSE */
+#define RCC_CFGR_PLLXTPRE   17  /**< HSE divider for the PLL entry */
+#define RCC_CFGR_PLLMUL     18  /**< PLL multiplication factor (4 bits) */
+
+#define RCC_CFGR_SW_MASK    (0x3UL << RCC_CFGR_SW)
+#define RCC_CFGR_SWS_MASK   (0x3UL << RCC_CFGR_SWS)
+
+/**< Fields written by a clock setting; USB, ADC and MCO fields are left alone */
+#define RCC_CFGR_TREE_MASK  ((0xFUL << RCC_CFGR_HPRE) | (0x7UL << RCC_CFGR_PPRE1) | (0x7UL << RCC_CFGR_PPRE2) | \
+                             (1UL << RCC_CFGR_PLLSRC) | (1UL << RCC_CFGR_PLLXTPRE) | (0xFUL << RCC_CFGR_PLLMUL))
+
+/** @} */ // end of RCC_CFGR_Bit_Definitions
+
+/**
+ * @defgroup RCC_FLASH_ACR_Bit_Definitions Flash Access Control Register Bit Definitions
+ * @{
+ */
+
+#define RCC_FLASH_ACR_LATENCY_MASK  0x7UL       /**< Wait states */
+#define RCC_FLASH_ACR_PRFTBE        (1UL << 4)  /**< Prefetch buffer enable */
+
+/**< Highest SYSCLK for 0 and 1 wait states; up to 72 MHz needs 2 */
+#define RCC_FLASH_0WS_MAX_CLK       24000000UL
+#define RCC_FLASH_1WS_MAX_CLK       48000000UL
+
+/** @} */ // end of RCC_FLASH_ACR_Bit_Definitions
+
 /**
  * @defgroup RCC_Clock_Source RCC Clock Source Macros
  * @{
@@ -128,5 +171,130 @@
 
 /** @} */ // end of RCC_Clock_Type
 
+/**
+ * @defgroup RCC_PLL_Source RCC PLL Source Macros
+ * @{
+ */
+
+#define RCC_PLL_SRC_HSI_DIV_2   0   /**< HSI / 2 */
+#define RCC_PLL_SRC_HSE         1   /**< HSE */
+#define RCC_PLL_SRC_HSE_DIV_2   2   /**< HSE / 2 */
+
+/** @} */ // end of RCC_PLL_Source
+
+/**
+ * @defgroup RCC_Prescalers RCC Bus Prescaler Macros
+ * @{
+ */
+
+#define RCC_AHB_DIV_1       1
+#define RCC_AHB_DIV_2       2
+#define RCC_AHB_DIV_4       4
+#define RCC_AHB_DIV_8       8
+#define RCC_AHB_DIV_16      16
+#define RCC_AHB_DIV_64      64
+#define RCC_AHB_DIV_128     128
+#define RCC_AHB_DIV_256     256
+#define RCC_AHB_DIV_512     512
+
+#define RCC_APB_DIV_1       1
+#define RCC_APB_DIV_2       2
+#define RCC_APB_DIV_4       4
+#define RCC_APB_DIV_8       8
+#define RCC_APB_DIV_16      16
+
+/** @} */ // end of RCC_Prescalers
+
+#define RCC_HSI_FREQUENCY       8000000UL
+#define RCC_PLL_MAX_CLK         72000000UL
+#define RCC_APB1_MAX_CLK        36000000UL
+
+/**< Oscillator start-up and clock switch time-out, in polling iterations */
+#define RCC_READY_TIMEOUT       0x10000UL
+
+/**
+ * @brief One clock tree: the system clock source, the PLL and the bus prescalers.
+ */
+typedef struct
+{
+    u8 Source;          /**< RCC_HSI, RCC_HSE or RCC_PLL */
+    u8 PllSource;       /**< RCC_PLL_SRC_x, when Source is RCC_PLL */
+    u8 PllMul;          /**< 2 .. 16, when Source is RCC_PLL */
+    u16 AhbDivider;     /**< RCC_AHB_DIV_x */
+    u8 Apb1Divider;     /**< RCC_APB_DIV_x */
+    u8 Apb2Divider;     /**< RCC_APB_DIV_x */
+} RCC_ClockSetting_t;
+
+/**< Both PLL profiles use the same multiplier; the 36 MHz one halves the HSE first */
+#define RCC_PROFILE_PLL_MUL     (RCC_PLL_MAX_CLK / RCC_HSE_FREQUENCY)
+
+/**< The HSI is 8 MHz whatever the crystal */
+#if RCC_HSE_FREQUENCY == 8000000UL
+#define RCC_PROFILE_8MHZ_SOURCE RCC_HSE
+#else
+#define RCC_PROFILE_8MHZ_SOURCE RCC_HSI
+#endif
+
+#define RCC_PROFILE_COUNT       3
+
+#define RCC_BUS_COUNT           3   /**< RCC_AHB, RCC_APB1 and RCC_APB2 */
+#define RCC_BUS_PERIPHERALS     32  /**< Enable bits per bus register */
+#define RCC_MAX_USERS           0xFFU
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Switch to a clock tree.
+ *
+ * The system clock first moves to the oscillator that feeds the new tree (16 MHz at most), where
+ * any wait state and prescaler combination is valid; the PLL, the flash wait states and the
+ * prescalers are changed there, then the PLL is selected. The registered drivers are notified
+ * before and after.
+ *
+ * @return E_OK, or E_NOT_OK when the setting is invalid or an oscillator or the PLL does not start.
+ */
+static Std_ReturnType RCC_ApplySetting(const RCC_ClockSetting_t *Copy_pSetting);
+
+/**
+ * @brief The current clocks, read back from the registers on the first call only.
+ */
+static const RCC_Clocks_t *RCC_GetClocks(void);
+
+/**
+ * @brief Compute the frequencies a setting gives.
+ */
+static void RCC_ComputeClocks(const RCC_ClockSetting_t *Copy_pSetting, RCC_Clocks_t *Copy_pClocks);
+
+/**
+ * @brief Read the setting the registers hold.
+ */
+static void RCC_ReadSetting(RCC_ClockSetting_t *Copy_pSetting);
+
+/**
+ * @brief Turn an oscillator on (RCC_HSI or RCC_HSE) and wait until it is stable.
+ */
+static Std_ReturnType RCC_StartOscillator(u8 Copy_Oscillator);
+
+/**
+ * @brief Select the system clock source and wait until the switch is done.
+ */
+static Std_ReturnType RCC_SwitchSystemClock(u8 Copy_Source);
+
+/**
+ * @brief Wait until the masked bits of a register read Copy_Value.
+ */
+static Std_ReturnType RCC_WaitFlag(volatile u32 *Copy_pRegister, u32 Copy_Mask, u32 Copy_Value);
+
+/**
+ * @brief Call every registered notifier.
+ */
+static void RCC_Notify(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
 
 #endif /* RCC_PRIVATE_H_ */
\ No newline at end of file
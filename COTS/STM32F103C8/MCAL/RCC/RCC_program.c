@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 26 Aug 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.4                        *****************/
 /******* File Name : RCC_program.c              *****************/
 /****************************************************************/
 
@@ -9,59 +9,55 @@
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
+#include "SCB_interface.h"
 #include "RCC_interface.h"
-#include "RCC_private.h"
 #include "RCC_config.h"
-/*****************************< Function Implementations *****************************/
-Std_ReturnType MCAL_RCC_InitSysClock(void)
+#include "RCC_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Indexed by RCC_PROFILE_x */
+static const RCC_ClockSetting_t RCC_Profiles[RCC_PROFILE_COUNT] =
 {
-    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
-
-    #if RCC_SYSCLK == RCC_HSE
-        
-        /**< Enable the external clock to be the source for the system clock. */
-        #if RCC_CLK_BYPASS == RCC_RC_CLK_
-            SET_BIT(RCC_CR, RCC_CR_HSEBYP); /**< Choose RC as a SYSCLK */
-        #elif RCC_CLK_BYPASS == RCC_CRYSTAL_CLK_
-            CLR_BIT(RCC_CR, RCC_CR_HSEBYP); /**< Choose CRYSTAL as a SYSCLK */
-        #else 
-            #error "Wrong Choice !!"
-        #endif /**< RCC_CLK_BYPASS */
+    { RCC_PLL, RCC_PLL_SRC_HSE,       RCC_PROFILE_PLL_MUL, RCC_AHB_DIV_1, RCC_APB_DIV_2, RCC_APB_DIV_1 },
+    { RCC_PLL, RCC_PLL_SRC_HSE_DIV_2, RCC_PROFILE_PLL_MUL, RCC_AHB_DIV_1, RCC_APB_DIV_1, RCC_APB_DIV_1 },
+    { RCC_PROFILE_8MHZ_SOURCE, 0,     0,                   RCC_AHB_DIV_1, RCC_APB_DIV_1, RCC_APB_DIV_1 }
+};
 
-        /**< Enable the High-Speed External clock. */
-        SET_BIT(RCC_CR, RCC_CR_HSEON);
+/**< Current clocks; the reset state is the HSI with every prescaler at 1 */
+static RCC_Clocks_t RCC_Clocks = { RCC_HSI_FREQUENCY, RCC_HSI_FREQUENCY, RCC_HSI_FREQUENCY, RCC_HSI_FREQUENCY };
 
-        /**< Wait until the High-Speed External clock is stable. */
-        while(!GET_BIT(RCC_CR, RCC_CR_HSERDY));
+/**< RCC_Clocks matches the registers: set by the first query or by a clock change (a bootloader may have left any tree) */
+static u8 RCC_ClocksValid = 0;
 
-        /**< Select High-Speed External clock as the system clock source. */
-        RCC_CFGR = 0x00000001;
+static RCC_ClockNotifier_t RCC_Notifiers[RCC_MAX_CLOCK_NOTIFIERS];
+static u8 RCC_NotifierCount = 0;
 
-        Local_FunctionStatus = E_OK;
-
-    #elif RCC_SYSCLK == RCC_HSI
-        
-        /**< Enable the High-Speed Internal clock. */
-        SET_BIT(RCC_CR, RCC_CR_HSION);
-
-        /**< Wait until the High-Speed Internal clock is stable. */
-        while(!GET_BIT(RCC_CR, RCC_CR_HSIRDY));
+/**< Users of each peripheral clock, indexed by bus and enable bit; the clock runs while non-zero */
+static u8 RCC_PeripheralUsers[RCC_BUS_COUNT][RCC_BUS_PERIPHERALS];
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_RCC_InitSysClock(void)
+{
+    #if RCC_SYSCLK == RCC_PLL
 
-        /**< Select High-Speed Internal clock as the system clock source. */
-        RCC_CFGR = 0x00000000;
+        #if (RCC_PLL_MUL < 2) || (RCC_PLL_MUL > 16)
+            #error "RCC_PLL_MUL must be between 2 and 16"
+        #endif
 
-        Local_FunctionStatus = E_OK;
+        const RCC_ClockSetting_t Local_Setting = { RCC_PLL, RCC_PLL_SOURCE, RCC_PLL_MUL, RCC_AHB_PRESCALER, RCC_APB1_PRESCALER, RCC_APB2_PRESCALER };
 
-    #elif RCC_SYSCLK == RCC_PLL
+    #elif (RCC_SYSCLK == RCC_HSE) || (RCC_SYSCLK == RCC_HSI)
 
-    // Placeholder for PLL configuration
+        const RCC_ClockSetting_t Local_Setting = { RCC_SYSCLK, 0, 0, RCC_AHB_PRESCALER, RCC_APB1_PRESCALER, RCC_APB2_PRESCALER };
 
     #else
         #error "Wrong Choice !!"
 
     #endif /**< RCC_SYSCLK */
 
-    return Local_FunctionStatus;
+    #if (RCC_CLK_BYPASS != RCC_RC_CLK_) && (RCC_CLK_BYPASS != RCC_CRYSTAL_CLK_)
+        #error "Wrong Choice !!"
+    #endif /**< RCC_CLK_BYPASS */
+
+    return RCC_ApplySetting(&Local_Setting);
 }
 
 Std_ReturnType MCAL_RCC_EnablePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId)
@@ -128,4 +124,387 @@ Std_ReturnType MCAL_RCC_DisablePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId)
     return Local_FunctionStatus;
 }
 
+Std_ReturnType MCAL_RCC_AcquirePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if ((Copy_BusId >= RCC_BUS_COUNT) || (Copy_PeripheralId >= RCC_BUS_PERIPHERALS))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Drivers acquire from thread and interrupt context alike */
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if (RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId] < RCC_MAX_USERS)
+    {
+        if (RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId] == 0)
+        {
+            MCAL_RCC_EnablePeripheral(Copy_BusId, Copy_PeripheralId);
+        }
+        RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId]++;
+        Local_FunctionStatus = E_OK;
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_RCC_ReleasePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if ((Copy_BusId >= RCC_BUS_COUNT) || (Copy_PeripheralId >= RCC_BUS_PERIPHERALS))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if (RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId] != 0)
+    {
+        RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId]--;
+        if (RCC_PeripheralUsers[Copy_BusId][Copy_PeripheralId] == 0)
+        {
+            MCAL_RCC_DisablePeripheral(Copy_BusId, Copy_PeripheralId);
+        }
+        Local_FunctionStatus = E_OK;
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_RCC_SetProfile(u8 Copy_Profile)
+{
+    if (Copy_Profile >= RCC_PROFILE_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    return RCC_ApplySetting(&RCC_Profiles[Copy_Profile]);
+}
+
+Std_ReturnType MCAL_RCC_RegisterClockNotifier(RCC_ClockNotifier_t Copy_pfNotifier)
+{
+    u8 Local_Index;
+
+    if (Copy_pfNotifier == NULL)
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Drivers register from their init function, which may run more than once */
+    for (Local_Index = 0; Local_Index < RCC_NotifierCount; Local_Index++)
+    {
+        if (RCC_Notifiers[Local_Index] == Copy_pfNotifier)
+        {
+            return E_OK;
+        }
+    }
+
+    if (RCC_NotifierCount >= RCC_MAX_CLOCK_NOTIFIERS)
+    {
+        return E_NOT_OK;
+    }
+
+    RCC_Notifiers[RCC_NotifierCount] = Copy_pfNotifier;
+    RCC_NotifierCount++;
+
+    return E_OK;
+}
+
+u32 MCAL_RCC_GetSysclk(void)
+{
+    return RCC_GetClocks()->SysClk;
+}
+
+u32 MCAL_RCC_GetHclk(void)
+{
+    return RCC_GetClocks()->HClk;
+}
+
+u32 MCAL_RCC_GetPclk1(void)
+{
+    return RCC_GetClocks()->PClk1;
+}
+
+u32 MCAL_RCC_GetPclk2(void)
+{
+    return RCC_GetClocks()->PClk2;
+}
+/*****************************< Private Functions *****************************/
+static Std_ReturnType RCC_ApplySetting(const RCC_ClockSetting_t *Copy_pSetting)
+{
+    Std_ReturnType Local_FunctionStatus;
+    RCC_ClockSetting_t Local_Actual;
+    RCC_Clocks_t Local_Previous = *RCC_GetClocks();
+    RCC_Clocks_t Local_New;
+    u32 Local_Cfgr;
+    u32 Local_Latency;
+    u8 Local_Oscillator;
+    u8 Local_Shift;
+
+    RCC_ComputeClocks(Copy_pSetting, &Local_New);
+
+    if ((Copy_pSetting->Source == RCC_PLL) &&
+        ((Copy_pSetting->PllMul < 2) || (Copy_pSetting->PllMul > 16) || (Local_New.SysClk > RCC_PLL_MAX_CLK)))
+    {
+        return E_NOT_OK;
+    }
+    if (Local_New.PClk1 > RCC_APB1_MAX_CLK)
+    {
+        return E_NOT_OK;
+    }
+
+    RCC_Notify(RCC_CLOCK_PRE_CHANGE, &Local_Previous, &Local_New);
+
+    /**< The oscillator that feeds the new tree */
+    if (Copy_pSetting->Source == RCC_PLL)
+    {
+        Local_Oscillator = (Copy_pSetting->PllSource == RCC_PLL_SRC_HSI_DIV_2) ? RCC_HSI : RCC_HSE;
+    }
+    else
+    {
+        Local_Oscillator = Copy_pSetting->Source;
+    }
+
+    Local_FunctionStatus = RCC_StartOscillator(Local_Oscillator);
+
+    /**< Run from the oscillator while the rest changes */
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = RCC_SwitchSystemClock(Local_Oscillator);
+    }
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        /**< Wait states for the new SYSCLK; the prefetch buffer stays on (required with an AHB prescaler) */
+        if (Local_New.SysClk <= RCC_FLASH_0WS_MAX_CLK)
+        {
+            Local_Latency = 0;
+        }
+        else if (Local_New.SysClk <= RCC_FLASH_1WS_MAX_CLK)
+        {
+            Local_Latency = 1;
+        }
+        else
+        {
+            Local_Latency = 2;
+        }
+        RCC_FLASH_ACR = (RCC_FLASH_ACR & ~RCC_FLASH_ACR_LATENCY_MASK) | RCC_FLASH_ACR_PRFTBE | Local_Latency;
+
+        /**< The PLL can only be reconfigured while it is off */
+        CLR_BIT(RCC_CR, RCC_CR_PLLON);
+        Local_FunctionStatus = RCC_WaitFlag(&RCC_CR, (1UL << RCC_CR_PLLRDY), 0);
+    }
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_Cfgr = 0;
+
+        /**< HPRE: 0xxx = 1, then 1000 = 2 up to 1011 = 16 and 1100 = 64 up to 1111 = 512 (there is no 32) */
+        if (Copy_pSetting->AhbDivider > 1)
+        {
+            for (Local_Shift = 0; (1UL << Local_Shift) < Copy_pSetting->AhbDivider; Local_Shift++);
+            Local_Cfgr |= (u32)(0x8U | (Local_Shift - ((Local_Shift > 5) ? 2U : 1U))) << RCC_CFGR_HPRE;
+        }
+
+        /**< PPREx: 0xx = 1, then 100 = 2 up to 111 = 16 */
+        if (Copy_pSetting->Apb1Divider > 1)
+        {
+            for (Local_Shift = 0; (1UL << Local_Shift) < Copy_pSetting->Apb1Divider; Local_Shift++);
+            Local_Cfgr |= (u32)(0x4U | (Local_Shift - 1U)) << RCC_CFGR_PPRE1;
+        }
+        if (Copy_pSetting->Apb2Divider > 1)
+        {
+            for (Local_Shift = 0; (1UL << Local_Shift) < Copy_pSetting->Apb2Divider; Local_Shift++);
+            Local_Cfgr |= (u32)(0x4U | (Local_Shift - 1U)) << RCC_CFGR_PPRE2;
+        }
+
+        if (Copy_pSetting->Source == RCC_PLL)
+        {
+            if (Copy_pSetting->PllSource != RCC_PLL_SRC_HSI_DIV_2)
+            {
+                Local_Cfgr |= (1UL << RCC_CFGR_PLLSRC);
+            }
+            if (Copy_pSetting->PllSource == RCC_PLL_SRC_HSE_DIV_2)
+            {
+                Local_Cfgr |= (1UL << RCC_CFGR_PLLXTPRE);
+            }
+            Local_Cfgr |= (u32)(Copy_pSetting->PllMul - 2U) << RCC_CFGR_PLLMUL;
+        }
+
+        RCC_CFGR = (RCC_CFGR & ~RCC_CFGR_TREE_MASK) | Local_Cfgr;
+
+        if (Copy_pSetting->Source == RCC_PLL)
+        {
+            SET_BIT(RCC_CR, RCC_CR_PLLON);
+            Local_FunctionStatus = RCC_WaitFlag(&RCC_CR, (1UL << RCC_CR_PLLRDY), (1UL << RCC_CR_PLLRDY));
+
+            if (Local_FunctionStatus == E_OK)
+            {
+                Local_FunctionStatus = RCC_SwitchSystemClock(RCC_PLL);
+            }
+        }
+    }
+
+    /**< Stop the HSE when nothing uses it any more; the HSI always stays on for the FPEC */
+    if ((Local_FunctionStatus == E_OK) && (Local_Oscillator == RCC_HSI))
+    {
+        CLR_BIT(RCC_CR, RCC_CR_HSEON);
+    }
+
+    /**< Publish what actually runs, which is the old or an intermediate tree after a failure */
+    RCC_ReadSetting(&Local_Actual);
+    RCC_ComputeClocks(&Local_Actual, &RCC_Clocks);
+    RCC_ClocksValid = 1;
+
+    RCC_Notify(RCC_CLOCK_POST_CHANGE, &Local_Previous, &RCC_Clocks);
+
+    return Local_FunctionStatus;
+}
+
+static const RCC_Clocks_t *RCC_GetClocks(void)
+{
+    RCC_ClockSetting_t Local_Actual;
+
+    if (RCC_ClocksValid == 0)
+    {
+        RCC_ReadSetting(&Local_Actual);
+        RCC_ComputeClocks(&Local_Actual, &RCC_Clocks);
+        RCC_ClocksValid = 1;
+    }
+
+    return &RCC_Clocks;
+}
+
+static void RCC_ComputeClocks(const RCC_ClockSetting_t *Copy_pSetting, RCC_Clocks_t *Copy_pClocks)
+{
+    u32 Local_SysClk;
+
+    switch (Copy_pSetting->Source)
+    {
+        case RCC_HSE:
+            Local_SysClk = RCC_HSE_FREQUENCY;
+            break;
+
+        case RCC_PLL:
+            if (Copy_pSetting->PllSource == RCC_PLL_SRC_HSE)
+            {
+                Local_SysClk = RCC_HSE_FREQUENCY * Copy_pSetting->PllMul;
+            }
+            else if (Copy_pSetting->PllSource == RCC_PLL_SRC_HSE_DIV_2)
+            {
+                Local_SysClk = (RCC_HSE_FREQUENCY / 2UL) * Copy_pSetting->PllMul;
+            }
+            else
+            {
+                Local_SysClk = (RCC_HSI_FREQUENCY / 2UL) * Copy_pSetting->PllMul;
+            }
+            break;
+
+        default:
+            Local_SysClk = RCC_HSI_FREQUENCY;
+            break;
+    }
+
+    Copy_pClocks->SysClk = Local_SysClk;
+    Copy_pClocks->HClk = Local_SysClk / Copy_pSetting->AhbDivider;
+    Copy_pClocks->PClk1 = Copy_pClocks->HClk / Copy_pSetting->Apb1Divider;
+    Copy_pClocks->PClk2 = Copy_pClocks->HClk / Copy_pSetting->Apb2Divider;
+}
+
+static void RCC_ReadSetting(RCC_ClockSetting_t *Copy_pSetting)
+{
+    u32 Local_Cfgr = RCC_CFGR;
+    u32 Local_Field;
+
+    Copy_pSetting->Source = (u8)((Local_Cfgr & RCC_CFGR_SWS_MASK) >> RCC_CFGR_SWS);
+
+    if (GET_BIT(Local_Cfgr, RCC_CFGR_PLLSRC) == 0)
+    {
+        Copy_pSetting->PllSource = RCC_PLL_SRC_HSI_DIV_2;
+    }
+    else
+    {
+        Copy_pSetting->PllSource = (GET_BIT(Local_Cfgr, RCC_CFGR_PLLXTPRE) == 0) ? RCC_PLL_SRC_HSE : RCC_PLL_SRC_HSE_DIV_2;
+    }
+
+    /**< 1111 is x16 as well */
+    Local_Field = (Local_Cfgr >> RCC_CFGR_PLLMUL) & 0xFUL;
+    Copy_pSetting->PllMul = (u8)((Local_Field == 0xFUL) ? 16U : (Local_Field + 2U));
+
+    Local_Field = (Local_Cfgr >> RCC_CFGR_HPRE) & 0xFUL;
+    Copy_pSetting->AhbDivider = (Local_Field < 8U) ? 1U : (u16)(1U << ((Local_Field & 0x7U) + ((Local_Field >= 0xCU) ? 2U : 1U)));
+
+    Local_Field = (Local_Cfgr >> RCC_CFGR_PPRE1) & 0x7UL;
+    Copy_pSetting->Apb1Divider = (Local_Field < 4U) ? 1U : (u8)(1U << ((Local_Field & 0x3U) + 1U));
+
+    Local_Field = (Local_Cfgr >> RCC_CFGR_PPRE2) & 0x7UL;
+    Copy_pSetting->Apb2Divider = (Local_Field < 4U) ? 1U : (u8)(1U << ((Local_Field & 0x3U) + 1U));
+}
+
+static Std_ReturnType RCC_StartOscillator(u8 Copy_Oscillator)
+{
+    if (Copy_Oscillator == RCC_HSE)
+    {
+        if (GET_BIT(RCC_CR, RCC_CR_HSERDY) == 0)
+        {
+            /**< HSEBYP can only be written while the HSE is off */
+            CLR_BIT(RCC_CR, RCC_CR_HSEON);
+
+            #if RCC_CLK_BYPASS == RCC_RC_CLK_
+                SET_BIT(RCC_CR, RCC_CR_HSEBYP); /**< Choose RC as a SYSCLK */
+            #else
+                CLR_BIT(RCC_CR, RCC_CR_HSEBYP); /**< Choose CRYSTAL as a SYSCLK */
+            #endif /**< RCC_CLK_BYPASS */
+
+            SET_BIT(RCC_CR, RCC_CR_HSEON);
+        }
+
+        return RCC_WaitFlag(&RCC_CR, (1UL << RCC_CR_HSERDY), (1UL << RCC_CR_HSERDY));
+    }
+
+    SET_BIT(RCC_CR, RCC_CR_HSION);
+
+    return RCC_WaitFlag(&RCC_CR, (1UL << RCC_CR_HSIRDY), (1UL << RCC_CR_HSIRDY));
+}
+
+static Std_ReturnType RCC_SwitchSystemClock(u8 Copy_Source)
+{
+    RCC_CFGR = (RCC_CFGR & ~RCC_CFGR_SW_MASK) | ((u32)Copy_Source << RCC_CFGR_SW);
+
+    return RCC_WaitFlag(&RCC_CFGR, RCC_CFGR_SWS_MASK, ((u32)Copy_Source << RCC_CFGR_SWS));
+}
+
+static Std_ReturnType RCC_WaitFlag(volatile u32 *Copy_pRegister, u32 Copy_Mask, u32 Copy_Value)
+{
+    u32 Local_Timeout = RCC_READY_TIMEOUT;
+
+    while ((*Copy_pRegister & Copy_Mask) != Copy_Value)
+    {
+        if (Local_Timeout == 0)
+        {
+            return E_NOT_OK;
+        }
+        Local_Timeout--;
+    }
+
+    return E_OK;
+}
+
+static void RCC_Notify(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew)
+{
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < RCC_NotifierCount; Local_Index++)
+    {
+        RCC_Notifiers[Local_Index](Copy_Event, Copy_pPrevious, Copy_pNew);
+    }
+}
 /*****************************< End of Function Implementations *****************************/
@@ -31,6 +31,28 @@
  */
 #define SCB_PRIORITY_GROUPING  SCB_16GROUP_0SUB
 
+/**
+ * @brief Vector Table Relocation
+ *
+ * When enabled, SCB_RelocateVectorTable copies the vector table to an SRAM buffer. Handlers can
+ * then be installed at runtime with SCB_SetIRQHandler. It is also needed for interrupts to be
+ * serviced while the flash is erased or programmed: the vectors are fetched from the table too.
+ *
+ * @note The value of this macro should be set to one of the following options:
+ * - SCB_VECTOR_TABLE_RELOCATION_ENABLED : Reserve the SRAM vector table.
+ * - SCB_VECTOR_TABLE_RELOCATION_DISABLED: No SRAM is reserved; SCB_RelocateVectorTable and
+ *                                         SCB_SetIRQHandler return E_NOT_OK.
+ */
+#define SCB_VECTOR_TABLE_RELOCATION     SCB_VECTOR_TABLE_RELOCATION_DISABLED
+
+/**
+ * @brief Number of Vector Table Entries
+ *
+ * This is the initial stack pointer, 15 system exceptions, and the peripheral interrupts of the
+ * device (43 on the STM32F103 medium-density line; 60 on the high-density line).
+ */
+#define SCB_VECTOR_TABLE_ENTRIES        (16 + 43)
+
 
 
 #endif /**< SCB_CONFIG_H_ */
\ No newline at end of file
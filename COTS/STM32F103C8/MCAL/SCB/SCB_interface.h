@@ -7,6 +7,27 @@
 #ifndef SCB_INTERFACE_H_
 #define SCB_INTERFACE_H_
 
+/**
+ * @brief Exception handler type, as stored in the vector table.
+ */
+typedef void (*SCB_Handler_t)(void);
+
+/**
+ * @name System Exception Numbers
+ * @brief Negative IRQ numbers accepted by SCB_SetIRQHandler for the system exceptions.
+ * @{
+ */
+#define SCB_NMI_IRQn            (-14)   /**< Non-maskable interrupt */
+#define SCB_HARDFAULT_IRQn      (-13)   /**< Hard fault */
+#define SCB_MEMMANAGE_IRQn      (-12)   /**< Memory management fault */
+#define SCB_BUSFAULT_IRQn       (-11)   /**< Bus fault */
+#define SCB_USAGEFAULT_IRQn     (-10)   /**< Usage fault */
+#define SCB_SVCALL_IRQn         (-5)    /**< Supervisor call */
+#define SCB_DEBUGMON_IRQn       (-4)    /**< Debug monitor */
+#define SCB_PENDSV_IRQn         (-2)    /**< Pendable service request */
+#define SCB_SYSTICK_IRQn        (-1)    /**< SysTick */
+/** @} */
+
 /*****************************< Function to enable/disable global interrupts *****************************/
 /**
  * @brief Set the Priority Grouping in the System Control Block (SCB).
@@ -47,6 +68,38 @@ void DisableGlobalInterrupts(void);
  */
 void EnableGlobalInterrupts(void);
 
+/**
+ * @brief Enter a nestable critical section.
+ *
+ * This function saves the current PRIMASK value and then disables global interrupts.
+ * The returned value must be handed back to SCB_ExitCriticalSection so that a
+ * critical section entered from an ISR or from another critical section does not
+ * re-enable interrupts prematurely.
+ *
+ * @return The PRIMASK value before interrupts were disabled.
+ *
+ * @see SCB_ExitCriticalSection
+ */
+u32 SCB_EnterCriticalSection(void);
+
+/**
+ * @brief Leave a critical section entered with SCB_EnterCriticalSection.
+ *
+ * This function restores the PRIMASK value saved by SCB_EnterCriticalSection.
+ *
+ * @param[in] Copy_PrimaskState The value returned by the matching SCB_EnterCriticalSection call.
+ *
+ * @return None
+ */
+void SCB_ExitCriticalSection(u32 Copy_PrimaskState);
+
+/**
+ * @brief Check whether the CPU is running an exception or interrupt handler.
+ *
+ * @return 1 in handler mode (IPSR holds an exception number), 0 in thread mode.
+ */
+u8 SCB_IsHandlerMode(void);
+
 /*****************************< Function to enable/disable specific faults *****************************/
 /**
  * @brief Enable the Memory Management Fault in the System Control Block (SCB).
@@ -107,6 +160,54 @@ void SCB_ClearBusFault(void);
  */
 void SCB_ClearUsageFault(void);
 
+/*****************************< Functions to relocate the vector table *****************************/
+/**
+ * @brief Copy the active vector table to SRAM and point VTOR at the copy.
+ *
+ * The table currently selected by VTOR (the flash table after reset, or the table handed over
+ * by a bootloader) is copied entry by entry, so every handler keeps working. After this call,
+ * handlers can be replaced at runtime with SCB_SetIRQHandler.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The vector table is in SRAM (calling it again does nothing).
+ * @retval E_NOT_OK SCB_VECTOR_TABLE_RELOCATION is disabled in SCB_config.h.
+ *
+ * @note Call this once at startup, before the handlers are registered.
+ */
+Std_ReturnType SCB_RelocateVectorTable(void);
+
+/**
+ * @brief Install a handler directly in the SRAM vector table.
+ *
+ * The core then branches straight to the handler, without going through a driver's callback
+ * array. The handler takes over the driver's handler, so it must clear the peripheral's pending
+ * flag itself (e.g. the EXTI pending bit).
+ *
+ * @param[in] Copy_IRQn      The peripheral IRQ number (NVIC_xxx_IRQn) or a system exception
+ *                           number (SCB_xxx_IRQn).
+ * @param[in] Copy_pfHandler The handler to install.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The handler is installed.
+ * @retval E_NOT_OK The vector table was not relocated, the number is out of range or the handler is NULL.
+ */
+Std_ReturnType SCB_SetIRQHandler(s16 Copy_IRQn, SCB_Handler_t Copy_pfHandler);
+
+/**
+ * @brief Point VTOR at a vector table.
+ *
+ * This is how a bootloader hands a clean vector table over to the application: it sets VTOR to
+ * the application's table before jumping to the application's reset handler.
+ *
+ * @param[in] Copy_Address The address of the vector table, in flash or SRAM. It must be aligned
+ *                         to the table size rounded up to a power of two (at least 128 bytes).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     VTOR now points at Copy_Address.
+ * @retval E_NOT_OK The address is not correctly aligned or is outside the VTOR range.
+ */
+Std_ReturnType SCB_SetVectorTableAddress(u32 Copy_Address);
+
 
 
 #endif /**< SCB_INTERFACE_H_ */
\ No newline at end of file
@@ -13,6 +13,7 @@
 /**< SCB Registers */
 #define SCB_CPUID           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x00))) /**< CPUID Base Register */
 #define SCB_ICSR            (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x04))) /**< Interrupt Control and State Register */
+#define SCB_VTOR            (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x08))) /**< Vector Table Offset Register */
 #define SCB_AIRCR           (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x0C))) /**< Application Interrupt and Reset Control Register */
 #define SCB_SCR             (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x10))) /**< System Control Register */
 #define SCB_CCR             (*((volatile u32 *)(SCB_BASE_ADDRESS + 0x14))) /**< Configuration and Control Register */
@@ -33,6 +34,40 @@
 #define SCB_AIRCR_PRIGROUP_POS      8          /**< Bit position for Priority Grouping */
 #define SCB_AIRCR_PRIGROUP_MASK     0x00000700 /**< Mask for Priority Grouping Bits */
 
+/**< VTOR table offset field (bits 29:7) */
+#define SCB_VTOR_TBLOFF_MASK        0x3FFFFF80U
+
+/**
+ * @brief Vector Table Relocation Options
+ * @{
+ */
+#define SCB_VECTOR_TABLE_RELOCATION_DISABLED    0   /**< The vector table stays where VTOR points */
+#define SCB_VECTOR_TABLE_RELOCATION_ENABLED     1   /**< The vector table can be copied to SRAM */
+/** @} */
+
+/**< Entries before IRQ 0: the initial stack pointer and the 15 system exceptions */
+#define SCB_SYSTEM_VECTORS          16
+
+/**< Lowest exception that can be replaced at runtime (NMI); the stack pointer and reset vectors cannot */
+#define SCB_FIRST_HANDLER_IRQn      (-14)
+
+/**< VTOR requires the table to be aligned to its size rounded up to a power of two, 128 bytes at least */
+#if (SCB_VECTOR_TABLE_ENTRIES * 4) <= 128
+#define SCB_VECTOR_TABLE_ALIGNMENT  128U
+#elif (SCB_VECTOR_TABLE_ENTRIES * 4) <= 256
+#define SCB_VECTOR_TABLE_ALIGNMENT  256U
+#elif (SCB_VECTOR_TABLE_ENTRIES * 4) <= 512
+#define SCB_VECTOR_TABLE_ALIGNMENT  512U
+#elif (SCB_VECTOR_TABLE_ENTRIES * 4) <= 1024
+#define SCB_VECTOR_TABLE_ALIGNMENT  1024U
+#else
+#error "SCB_VECTOR_TABLE_ENTRIES is larger than any Cortex-M3 vector table."
+#endif
+
+#if (SCB_VECTOR_TABLE_RELOCATION != SCB_VECTOR_TABLE_RELOCATION_ENABLED) && (SCB_VECTOR_TABLE_RELOCATION != SCB_VECTOR_TABLE_RELOCATION_DISABLED)
+#error "Invalid SCB_VECTOR_TABLE_RELOCATION value. Please choose SCB_VECTOR_TABLE_RELOCATION_ENABLED or SCB_VECTOR_TABLE_RELOCATION_DISABLED."
+#endif
+
 /**
  * @brief Priority Grouping Values
  * @{
@@ -10,8 +10,13 @@
 #include "BIT_MATH.h"
 /*****************************< MCAL *****************************/
 #include "SCB_interface.h"
-#include "SCB_private.h"
 #include "SCB_config.h"
+#include "SCB_private.h"
+/*****************************< Global Variable Section *****************************/
+#if SCB_VECTOR_TABLE_RELOCATION == SCB_VECTOR_TABLE_RELOCATION_ENABLED
+/**< Vector table copy in SRAM, selected by SCB_RelocateVectorTable */
+static SCB_Handler_t SCB_SRAMVectorTable[SCB_VECTOR_TABLE_ENTRIES] __attribute__((aligned(SCB_VECTOR_TABLE_ALIGNMENT)));
+#endif
 /*****************************< Function Implementations *****************************/
 void SCB_SetPriorityGrouping(u32 Copy_PriorityGrouping)
 {
@@ -29,6 +34,33 @@ void EnableGlobalInterrupts(void)
     __asm volatile ("cpsie i");
 }
 
+RAMFUNC u32 SCB_EnterCriticalSection(void)
+{
+    u32 Local_PrimaskState;
+
+    /**< Save the current PRIMASK value, then mask all configurable interrupts */
+    __asm volatile ("mrs %0, primask" : "=r" (Local_PrimaskState));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return Local_PrimaskState;
+}
+
+RAMFUNC void SCB_ExitCriticalSection(u32 Copy_PrimaskState)
+{
+    /**< Restore the PRIMASK value saved on entry */
+    __asm volatile ("msr primask, %0" : : "r" (Copy_PrimaskState) : "memory");
+}
+
+u8 SCB_IsHandlerMode(void)
+{
+    u32 Local_Ipsr;
+
+    /**< IPSR is 0 in thread mode and the active exception number in handler mode */
+    __asm volatile ("mrs %0, ipsr" : "=r" (Local_Ipsr));
+
+    return (Local_Ipsr != 0) ? 1 : 0;
+}
+
 void SCB_EnableMemFault(void)
 {
     /**< Enable the Memory Management Fault */
@@ -64,4 +96,72 @@ void SCB_ClearUsageFault(void)
     /**< Clear the Usage Fault */
     SCB_SHCSR &= ~(1 << SCB_SHCSR_USGFAULTENA_POS);
 }
+
+Std_ReturnType SCB_RelocateVectorTable(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_VECTOR_TABLE_RELOCATION == SCB_VECTOR_TABLE_RELOCATION_ENABLED
+    const SCB_Handler_t *Local_pActiveTable = (const SCB_Handler_t *)(SCB_VTOR & SCB_VTOR_TBLOFF_MASK);
+    u32 Local_PrimaskState;
+    u16 Local_Index;
+
+    if (Local_pActiveTable != SCB_SRAMVectorTable)
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        /**< Copy the active table so every installed handler keeps working */
+        for (Local_Index = 0; Local_Index < SCB_VECTOR_TABLE_ENTRIES; Local_Index++)
+        {
+            SCB_SRAMVectorTable[Local_Index] = Local_pActiveTable[Local_Index];
+        }
+
+        /**< The copy must be complete before the core fetches vectors from it */
+        __asm volatile ("dsb" : : : "memory");
+        SCB_VTOR = (u32)SCB_SRAMVectorTable;
+        __asm volatile ("dsb\n\tisb" : : : "memory");
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+    }
+
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType SCB_SetIRQHandler(s16 Copy_IRQn, SCB_Handler_t Copy_pfHandler)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_VECTOR_TABLE_RELOCATION == SCB_VECTOR_TABLE_RELOCATION_ENABLED
+    if ((Copy_pfHandler != NULL) && (Copy_IRQn >= SCB_FIRST_HANDLER_IRQn) &&
+        (Copy_IRQn < (SCB_VECTOR_TABLE_ENTRIES - SCB_SYSTEM_VECTORS)) &&
+        ((SCB_VTOR & SCB_VTOR_TBLOFF_MASK) == (u32)SCB_SRAMVectorTable))
+    {
+        /**< A single aligned word write: the vector is either the old or the new handler */
+        SCB_SRAMVectorTable[SCB_SYSTEM_VECTORS + Copy_IRQn] = Copy_pfHandler;
+        __asm volatile ("dsb" : : : "memory");
+
+        Local_FunctionStatus = E_OK;
+    }
+#else
+    (void)Copy_IRQn;
+    (void)Copy_pfHandler;
+#endif
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType SCB_SetVectorTableAddress(u32 Copy_Address)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (((Copy_Address & (SCB_VECTOR_TABLE_ALIGNMENT - 1U)) == 0) && ((Copy_Address & ~SCB_VTOR_TBLOFF_MASK) == 0))
+    {
+        __asm volatile ("dsb" : : : "memory");
+        SCB_VTOR = Copy_Address;
+        __asm volatile ("dsb\n\tisb" : : : "memory");
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
 /*****************************< End of Function Implementations *****************************/
@@ -278,6 +278,9 @@ void SPI_Init(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig);
  *       Ensure that the SPI peripheral and appropriate communication settings are configured
  *       before calling this function.
  *
+ * @note The driver manages the SPI clock itself: a master is clocked only for its transfers and
+ *       gated in between, a slave stays clocked from SPI_Init on.
+ *
  * @note Example Usage:
  * @code
  * /// Select the SPI peripheral (e.g., SPI2)
@@ -147,7 +147,6 @@
  * @}
  */
 
-
 /**
  * @brief SPI Control Register 1 Bits
  *
@@ -276,6 +275,36 @@ static void SPI_WaitForTransmissionComplete(SPI_RegDef_t *Copy_SPI);
  */
 static void SPI_DefaultInitiation(void);
 
+/**
+ * @brief Record an initialised SPI so that its baud rate follows the clock profile changes.
+ *
+ * @param[in] Copy_SPI The SPI peripheral.
+ */
+static void SPI_TrackPeripheral(SPI_t Copy_SPI);
+
+/**
+ * @brief Take a reference on the RCC clock of an SPI (see MCAL_RCC_AcquirePeripheral).
+ *
+ * @param[in] Copy_SPI The SPI peripheral.
+ */
+static void SPI_AcquireClock(SPI_t Copy_SPI);
+
+/**
+ * @brief Drop a reference taken with SPI_AcquireClock; the clock is gated with the last one.
+ *
+ * @param[in] Copy_SPI The SPI peripheral.
+ */
+static void SPI_ReleaseClock(SPI_t Copy_SPI);
+
+/**
+ * @brief RCC clock change notifier.
+ *
+ * Before the change, waits until the tracked masters are idle. After it, picks for each one the
+ * fastest baud rate divider that does not exceed the SCK frequency it was initialised with, so
+ * repeated profile switches do not drift.
+ */
+static void SPI_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
 /**
  * @}
  */
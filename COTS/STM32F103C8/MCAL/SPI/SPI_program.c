@@ -18,12 +18,29 @@
 #include "BIT_MATH.h"
 
 /*****************************< MCAL *****************************/
+/**< RCC */
+#include "RCC_interface.h"
 /**< GPIO */
 #include "GPIO_interface.h"
 /**< MCAL_SPI */
 #include "SPI_interface.h"
 #include "SPI_private.h"
 #include "SPI_config.h"
+/*****************************< Global Variable Section *****************************/
+/**
+ * @brief The SPI peripherals, in the order of the tracking state below. SPI1 is on APB2, the others on APB1.
+ */
+static const SPI_t SPI_Peripherals[3] = { SPI_1, SPI_2, SPI_3 };
+
+/**< RCC bus and enable bit of each of SPI_Peripherals */
+static const u8 SPI_ClockBus[3] = { RCC_APB2, RCC_APB1, RCC_APB1 };
+static const u8 SPI_ClockEnableBit[3] = { RCC_APB2ENR_SPI1EN, RCC_APB1ENR_SPI2EN, RCC_APB1ENR_SPI3EN };
+
+/**< Bit i set once SPI_Peripherals[i] has been initialised */
+static u8 SPI_TrackedMask = 0;
+
+/**< SCK frequency to keep across clock changes, set when the SPI is initialised */
+static u32 SPI_TargetClock[3] = { 0, 0, 0 };
 
 /**
  * @addtogroup SPI_Functions
@@ -54,6 +71,9 @@ void SPI_Init(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig)
   }
   else
   {
+    /**< Clock the SPI while it is configured; the registers keep their values while it is gated */
+    SPI_AcquireClock(Copy_SelectedSPI);
+
     /**< Set the data frame format */
     if (Copy_SPIConfig->DataFrame == SPI_DATA_FRAME_8BIT)
     {
@@ -135,6 +155,10 @@ void SPI_Init(SPI_t Copy_SelectedSPI, const SPI_config_t *Copy_SPIConfig)
     /**< Enable the SPI peripheral */
     SET_BIT(Copy_SelectedSPI->CR1, SPI_CR1_SPE);
 
+    /**< Follow the clock profile changes */
+    SPI_TrackPeripheral(Copy_SelectedSPI);
+
+    SPI_ReleaseClock(Copy_SelectedSPI);
   }
 }
 
@@ -144,6 +168,9 @@ void SPI_Transfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy_Siz
   /**< Iterator to loop on the data */
   u16 Local_Iterator;
 
+  /**< Clock the SPI for the transfer only */
+  SPI_AcquireClock(Copy_SPI);
+
   #if SPI_MODE == SPI_MASTER_MODE
     /**< Clear the slave select pin -> Enable the slave select pin */
     GPIO_SetPinValue(GPIO_PORTA, GPIO_PIN4, GPIO_LOW);
@@ -162,6 +189,8 @@ void SPI_Transfer(SPI_t Copy_SPI, u8 *Copy_TxData, u8 *Copy_RxData, u16 Copy_Siz
   /* Wait for the transmission to complete */
   SPI_WaitForTransmissionComplete(Copy_SPI);
 
+  SPI_ReleaseClock(Copy_SPI);
+
   #if SPI_MODE == SPI_MASTER_MODE
     /* Set the slave select pin -> Disable the slave select pin */
     GPIO_SetPinValue(GPIO_PORTA, GPIO_PIN4, GPIO_HIGH);
@@ -204,6 +233,9 @@ static void SPI_WaitForTransmissionComplete(SPI_RegDef_t *Copy_SPI)
 
 static void SPI_DefaultInitiation(void)
 { 
+  /**< Clock the SPI while it is configured */
+  SPI_AcquireClock(SPI_Default);
+
   /**< Set the data frame format to be 8-bit data frame */
   CLR_BIT(SPI_Default->CR1, SPI_CR1_DFF);
 
@@ -240,6 +272,114 @@ static void SPI_DefaultInitiation(void)
 
   /* Enable the SPI peripheral */
   SET_BIT(SPI_Default->CR1, SPI_CR1_SPE);
+
+  /* Follow the clock profile changes */
+  SPI_TrackPeripheral(SPI_Default);
+
+  SPI_ReleaseClock(SPI_Default);
+}
+
+static void SPI_TrackPeripheral(SPI_t Copy_SPI)
+{
+  u8 Local_Index;
+
+  for (Local_Index = 0; Local_Index < 3; Local_Index++)
+  {
+    if (SPI_Peripherals[Local_Index] == Copy_SPI)
+    {
+      /**< A slave must be clocked whenever its master may talk: it keeps a reference from its first initialisation */
+      if ((GET_BIT(SPI_TrackedMask, Local_Index) == 0) && (GET_BIT(Copy_SPI->CR1, SPI_CR1_MSTR) == 0))
+      {
+        SPI_AcquireClock(Copy_SPI);
+      }
+
+      SET_BIT(SPI_TrackedMask, Local_Index);
+
+      /**< Re-initialised: the new divider at the current clock is the reference, SCK = PCLK / 2^(BR + 1) */
+      SPI_TargetClock[Local_Index] = ((Local_Index == 0) ? MCAL_RCC_GetPclk2() : MCAL_RCC_GetPclk1()) >> (((Copy_SPI->CR1 & SPI_CR1_BR_MSK) >> 3) + 1);
+    }
+  }
+
+  MCAL_RCC_RegisterClockNotifier(SPI_ClockNotifier);
+}
+
+static void SPI_AcquireClock(SPI_t Copy_SPI)
+{
+  u8 Local_Index;
+
+  for (Local_Index = 0; Local_Index < 3; Local_Index++)
+  {
+    if (SPI_Peripherals[Local_Index] == Copy_SPI)
+    {
+      MCAL_RCC_AcquirePeripheral(SPI_ClockBus[Local_Index], SPI_ClockEnableBit[Local_Index]);
+    }
+  }
+}
+
+static void SPI_ReleaseClock(SPI_t Copy_SPI)
+{
+  u8 Local_Index;
+
+  for (Local_Index = 0; Local_Index < 3; Local_Index++)
+  {
+    if (SPI_Peripherals[Local_Index] == Copy_SPI)
+    {
+      MCAL_RCC_ReleasePeripheral(SPI_ClockBus[Local_Index], SPI_ClockEnableBit[Local_Index]);
+    }
+  }
+}
+
+static void SPI_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew)
+{
+  SPI_t Local_SPI;
+  u32 Local_NewClock;
+  u32 Local_BaudRate;
+  u8 Local_Index;
+
+  (void)Copy_pPrevious;
+
+  for (Local_Index = 0; Local_Index < 3; Local_Index++)
+  {
+    Local_SPI = SPI_Peripherals[Local_Index];
+
+    if (GET_BIT(SPI_TrackedMask, Local_Index) == 0)
+    {
+      continue;
+    }
+
+    /**< A master is gated between transfers: clock it to read and rewrite its registers */
+    SPI_AcquireClock(Local_SPI);
+
+    /**< Only masters generate SCK */
+    if (GET_BIT(Local_SPI->CR1, SPI_CR1_MSTR) != 0)
+    {
+      if (Copy_Event == RCC_CLOCK_PRE_CHANGE)
+      {
+        /* Do not change the clock in the middle of a frame */
+        SPI_WaitForTransmissionComplete(Local_SPI);
+      }
+      else
+      {
+        Local_NewClock = (Local_Index == 0) ? Copy_pNew->PClk2 : Copy_pNew->PClk1;
+
+        /**< SCK = PCLK / 2^(BR + 1) */
+        for (Local_BaudRate = 0; Local_BaudRate < 7; Local_BaudRate++)
+        {
+          if ((Local_NewClock >> (Local_BaudRate + 1)) <= SPI_TargetClock[Local_Index])
+          {
+            break;
+          }
+        }
+
+        /**< BR is only written while the SPI is disabled */
+        CLR_BIT(Local_SPI->CR1, SPI_CR1_SPE);
+        Local_SPI->CR1 = (Local_SPI->CR1 & ~SPI_CR1_BR_MSK) | (Local_BaudRate << 3);
+        SET_BIT(Local_SPI->CR1, SPI_CR1_SPE);
+      }
+    }
+
+    SPI_ReleaseClock(Local_SPI);
+  }
 }
 
 /**
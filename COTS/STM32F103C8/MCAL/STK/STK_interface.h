@@ -139,6 +139,9 @@ u32 MCAL_STK_GetElapsedCounts(void);
  *
  * @note The maximum delay achievable with this function, when the SysTick timer clock is 1 MHz, is approximately 16 seconds.
  *
+ * @warning This function reprograms and then stops the SysTick, so it must not be used while the SysTick drives a
+ *          periodic tick (SWTMR, OS). Use a software timer (SWTMR_StartOneShot) for delays in that case.
+ *
  * @return E_OK if the delay was successful, E_NOT_OK if an error occurred.
  */
 Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds);
@@ -153,10 +156,14 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds);
  * @param[in] Copy_Milliseconds The number of milliseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
  *
  * @note The maximum delay achievable with this function, when the SysTick timer clock is 1 MHz, is approximately 16 seconds.
- * 
+ * @note The delay is computed with integer arithmetic only.
+ *
+ * @warning This function reprograms and then stops the SysTick, so it must not be used while the SysTick drives a
+ *          periodic tick (SWTMR, OS). Use a software timer (SWTMR_StartOneShot) for delays in that case.
+ *
  * @return E_OK if the delay was successful, E_NOT_OK if an error occurred.
  */
-Std_ReturnType MCAL_STK_SetDelay_ms(f32 Copy_Milliseconds);
+Std_ReturnType MCAL_STK_SetDelay_ms(u32 Copy_Milliseconds);
 
 /**
  * @brief Configures the SysTick timer for a single-shot interval and associates a callback function.
@@ -106,13 +106,21 @@ typedef struct STK_RegDef_t {
  * @retval None
  */
 #if STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_DIV_1
-    #define STK_AHB_CLK       8000000   /**< Processor clock (AHB clock) divided by 1 */
+    #define STK_AHB_DIVIDER   1         /**< Processor clock (AHB clock) divided by 1 */
 #elif STK_CTRL_CLKSOURCE == STK_CTRL_CLKSOURCE_DIV_8
-    #define STK_AHB_CLK       1000000   /**< Processor clock (AHB clock) divided by 8 */
+    #define STK_AHB_DIVIDER   8         /**< Processor clock (AHB clock) divided by 8 */
 #else
     #error "You chose a wrong clock source for the SysTick"
 #endif
 
+/**< SysTick counter clock in Hz, from the clock tree RCC keeps */
+#define STK_CLOCK           (MCAL_RCC_GetHclk() / STK_AHB_DIVIDER)
+
+/**
+ * @brief RCC clock change notifier: follow the new HCLK and keep the period of a running interval.
+ */
+static void STK_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
 
 
 
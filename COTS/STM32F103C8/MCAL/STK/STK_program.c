@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 14 Sep 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.3                        *****************/
 /******* File Name : STK_program.c              *****************/
 /****************************************************************/
 
@@ -10,9 +10,10 @@
 #include "BIT_MATH.h"
 #include <stdint.h>
 /*****************************< MCAL *****************************/
+#include "RCC_interface.h"
 #include "STK_interface.h"
-#include "STK_private.h"
 #include "STK_config.h"
+#include "STK_private.h"
 /*****************************< Global Variable Section *****************************/
 static STK_CallbackFunc_t STK_Callback = NULL;
 static u8 STK_ModeOfInterval;
@@ -47,6 +48,9 @@ void MCAL_STK_xInit(u32 Copy_Ticks)
 
     /**< Load the initial value into the SysTick timer */
     STK->LOAD = Copy_Ticks;  
+
+    /**< Follow the clock profile changes */
+    MCAL_RCC_RegisterClockNotifier(STK_ClockNotifier);
 }
 
 void MCAL_STK_vInit(void)
@@ -71,6 +75,9 @@ void MCAL_STK_vInit(void)
     #else
         #error "Invalid STK_CTRL_TICKINT value. Please choose STK_CTRL_TICKINT_ENABLE or STK_CTRL_TICKINT_DISABLE."
     #endif  
+
+    /**< Follow the clock profile changes */
+    MCAL_RCC_RegisterClockNotifier(STK_ClockNotifier);
 }
 
 Std_ReturnType MCAL_STK_SetReloadValue(u32 Copy_ReloadValue)
@@ -153,7 +160,7 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds)
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
     /**< Calculate the number of ticks required for the given microseconds */ 
-    u32 TicksRequired = (Copy_Microseconds * (STK_AHB_CLK / 1000000));
+    u32 TicksRequired = (Copy_Microseconds * (STK_CLOCK / 1000000));
 
     /**< Check if the ticks required is within the valid range */ 
     if (TicksRequired <= STK_RELOAD_MAX) 
@@ -179,14 +186,14 @@ Std_ReturnType MCAL_STK_SetBusyWait(u32 Copy_Microseconds)
     return Local_FunctionStatus;
 }
 
-Std_ReturnType MCAL_STK_SetDelay_ms(f32 Copy_Milliseconds)
+Std_ReturnType MCAL_STK_SetDelay_ms(u32 Copy_Milliseconds)
 {
-    /**< Calculate the number of ticks required to wait for the specified number of milliseconds */
-    u32 Local_u32Ticks = (u32)((Copy_Milliseconds * STK_AHB_CLK) / 1000.0);
-
-    /**< Check if TicksRequired is within the valid range */
-    if (Local_u32Ticks <= STK_RELOAD_MAX)
+    /**< Check if the requested delay fits in the 24-bit reload register */
+    if (Copy_Milliseconds <= (STK_RELOAD_MAX / (STK_CLOCK / 1000)))
     {
+        /**< Calculate the number of ticks required to wait for the specified number of milliseconds */
+        u32 Local_u32Ticks = Copy_Milliseconds * (STK_CLOCK / 1000);
+
         /**< Configure SysTick timer with the calculated number of ticks */
         STK->LOAD = Local_u32Ticks;
 
@@ -222,7 +229,7 @@ Std_ReturnType MCAL_STK_SetIntervalSingle(u32 Microseconds, STK_CallbackFunc_t C
     	MCAL_STK_Reset();
     
         /* Calculate the number of ticks required to wait for the specified number of microseconds */
-    	u32 TicksRequired = (Microseconds * (STK_AHB_CLK / 1000000));
+    	u32 TicksRequired = (Microseconds * (STK_CLOCK / 1000000));
 
         /**< Check if the ticks required is within the valid range */
         if (TicksRequired <= STK_RELOAD_MAX)
@@ -263,7 +270,7 @@ Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, STK_CallbackF
     	MCAL_STK_Reset();
         
         /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_Ticks = (Copy_Microseconds * STK_AHB_CLK) / 1000000;
+        u32 Local_Ticks = (u32)(((u64)Copy_Microseconds * STK_CLOCK) / 1000000ULL);
     
         /**< Check if TicksRequired is within the valid range */
         if (Local_Ticks <= STK_RELOAD_MAX)
@@ -298,12 +305,57 @@ Std_ReturnType MCAL_STK_SetIntervalPeriodic(u32 Copy_Microseconds, STK_CallbackF
  * @} // End of Public_Functions
  */
 
+/**
+ * @defgroup Private_Functions Private Functions
+ * @{
+ */
+
+static void STK_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew)
+{
+    u32 Local_OldClock;
+    u32 Local_NewClock;
+    u64 Local_Reload;
+
+    if (Copy_Event != RCC_CLOCK_POST_CHANGE)
+    {
+        return;
+    }
+
+    Local_OldClock = Copy_pPrevious->HClk / STK_AHB_DIVIDER;
+    Local_NewClock = Copy_pNew->HClk / STK_AHB_DIVIDER;
+
+    /**< A running interval keeps its period: scale the reload value by the clock ratio */
+    if ((STK->CTRL & STK_CTRL_ENABLE_MASK) && (STK->CTRL & STK_CTRL_TICKINT_MASK))
+    {
+        Local_Reload = (((u64)STK->LOAD + 1ULL) * Local_NewClock) / Local_OldClock;
+
+        if (Local_Reload > ((u64)STK_RELOAD_MAX + 1ULL))
+        {
+            Local_Reload = (u64)STK_RELOAD_MAX + 1ULL;
+        }
+        else if (Local_Reload < 2ULL)
+        {
+            Local_Reload = 2ULL;
+        }
+
+        STK->LOAD = (u32)Local_Reload - 1UL;
+
+        /**< Restart the current period at the new rate */
+        STK->VAL = 0;
+    }
+}
+
+/**
+ * @} // End of Private_Functions
+ */
+
 /**
  * @defgroup IRQ_Handlers IRQ Handlers
  * @{
  */
 
-void SysTick_Handler(void)
+/**< Runs from SRAM (RAMFUNC) so the tick is not lost while the flash is busy */
+RAMFUNC void SysTick_Handler(void)
 {
     if(STK_Callback != NULL)
     {
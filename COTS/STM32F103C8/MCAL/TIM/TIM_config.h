@@ -0,0 +1,12 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.2                        *****************/
+/******* File Name : TIM_config.h               *****************/
+/****************************************************************/
+#ifndef TIM_CONFIG_H_
+#define TIM_CONFIG_H_
+
+/**< The timer clock is taken from RCC (MCAL_RCC_GetPclk1), nothing to configure here */
+
+#endif /**< TIM_CONFIG_H_ */
@@ -0,0 +1,280 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.3                        *****************/
+/******* File Name : TIM_interface.h            *****************/
+/****************************************************************/
+#ifndef TIM_INTERFACE_H_
+#define TIM_INTERFACE_H_
+
+/**
+ * @defgroup TIM_Configurations TIM Configurations
+ * @brief Configuration options for the general-purpose timers TIM2, TIM3 and TIM4.
+ * @{
+ */
+
+/**
+ * @brief Type Definition for the TIM update callback function.
+ *
+ * Called from the timer ISR when the counter overflows (reaches the auto-reload value).
+ */
+typedef void (*TIM_CallbackFunc_t)(void);
+
+/**
+ * @brief Type Definition for the TIM capture/compare callback function.
+ *
+ * Called from the timer ISR on a capture/compare event of a channel. For input capture
+ * channels, Copy_CaptureValue is the counter value latched on the edge; for output
+ * channels it is the current compare value.
+ */
+typedef void (*TIM_CaptureCallbackFunc_t)(u16 Copy_CaptureValue);
+
+/**
+ * @name TIM Instances
+ * @{
+ */
+#define TIM_2       0   /**< TIM2 (APB1, IRQ NVIC_TIM2_IRQn). */
+#define TIM_3       1   /**< TIM3 (APB1, IRQ NVIC_TIM3_IRQn). */
+#define TIM_4       2   /**< TIM4 (APB1, IRQ NVIC_TIM4_IRQn). */
+/** @} */
+
+/**
+ * @name TIM Channels
+ *
+ * Default (not remapped) pins: TIM2 CH1..CH4 = PA0..PA3, TIM3 CH1..CH4 = PA6, PA7, PB0, PB1,
+ * TIM4 CH1..CH4 = PB6..PB9. Output channels need the pin in alternate function mode, input
+ * channels in floating input or pull-up/pull-down mode.
+ * @{
+ */
+#define TIM_CHANNEL1    0   /**< Capture/compare channel 1. */
+#define TIM_CHANNEL2    1   /**< Capture/compare channel 2. */
+#define TIM_CHANNEL3    2   /**< Capture/compare channel 3. */
+#define TIM_CHANNEL4    3   /**< Capture/compare channel 4. */
+/** @} */
+
+/**
+ * @name TIM PWM Output Polarity
+ * @{
+ */
+#define TIM_PWM_ACTIVE_HIGH     0   /**< Output is high while the counter is below the compare value. */
+#define TIM_PWM_ACTIVE_LOW      1   /**< Output is low while the counter is below the compare value. */
+/** @} */
+
+/**
+ * @name TIM Input Capture Edge
+ * @{
+ */
+#define TIM_IC_RISING_EDGE      0   /**< Capture on the rising edge. */
+#define TIM_IC_FALLING_EDGE     1   /**< Capture on the falling edge. */
+/** @} */
+
+/** @} */  // TIM_Configurations
+
+/**
+ * @defgroup TIM_Control TIM Control Functions
+ * @brief Functions for configuring and controlling the general-purpose timers.
+ * @{
+ */
+
+/**
+ * @brief Configure a timer as an up-counting timebase.
+ *
+ * The prescaler is derived from the timer clock RCC reports so that the counter increments at Copy_TickFrequency,
+ * and the counter wraps (update event) every Copy_AutoReload + 1 ticks. The auto-reload register is
+ * preloaded, so later MCAL_TIM_SetAutoReload calls take effect at the next update event.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_TickFrequency Counter frequency in Hz; the timer clock (PCLK1, or 2 x PCLK1 when
+ *                               the APB1 prescaler is not 1) must be an integer multiple of it.
+ * @param[in] Copy_AutoReload Auto-reload value (period - 1).
+ *
+ * @note The driver manages the timer clock itself: it runs from the first call on a timer until
+ *       MCAL_TIM_Stop, which gates it; the configuration is kept and the next call clocks it again.
+ * @note The timer is left stopped; call MCAL_TIM_Start.
+ * @note The prescaler is recomputed after every MCAL_RCC_SetProfile and takes effect at the next
+ *       update event, so the tick frequency is kept as closely as the new clock allows.
+ *
+ * @return E_OK if the timer was configured, E_NOT_OK for an invalid timer or an unreachable frequency.
+ */
+Std_ReturnType MCAL_TIM_InitTimebase(u8 Copy_Timer, u32 Copy_TickFrequency, u16 Copy_AutoReload);
+
+/**
+ * @brief Start the counter of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ *
+ * @return E_OK if the timer was started, E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType MCAL_TIM_Start(u8 Copy_Timer);
+
+/**
+ * @brief Stop the counter of a timer and gate its clock.
+ *
+ * The registers keep their values, so MCAL_TIM_Start resumes with the same configuration.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ *
+ * @return E_OK if the timer was stopped, E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType MCAL_TIM_Stop(u8 Copy_Timer);
+
+/**
+ * @brief Set the counter value of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Value The new counter value.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType MCAL_TIM_SetCounter(u8 Copy_Timer, u16 Copy_Value);
+
+/**
+ * @brief Read the counter value of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[out] Copy_pValue Pointer to store the counter value.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or a NULL pointer.
+ */
+Std_ReturnType MCAL_TIM_GetCounter(u8 Copy_Timer, u16 *Copy_pValue);
+
+/**
+ * @brief Change the auto-reload (period) value of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_AutoReload The new auto-reload value, applied at the next update event.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType MCAL_TIM_SetAutoReload(u8 Copy_Timer, u16 Copy_AutoReload);
+
+/**
+ * @brief Configure a channel as a PWM output (PWM mode 1).
+ *
+ * The duty cycle is Copy_Compare / (auto-reload + 1). The compare register is preloaded, so
+ * MCAL_TIM_SetCompare updates are glitch-free and applied at the next period.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_Polarity TIM_PWM_ACTIVE_HIGH or TIM_PWM_ACTIVE_LOW.
+ * @param[in] Copy_Compare The initial compare value.
+ *
+ * @note Configure the timebase first with MCAL_TIM_InitTimebase.
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_InitPWM(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Polarity, u16 Copy_Compare);
+
+/**
+ * @brief Set the compare value (PWM duty) of a channel.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_Compare The new compare value.
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_SetCompare(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare);
+
+/**
+ * @brief Configure a channel as an input capture on its own input pin.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_Edge TIM_IC_RISING_EDGE or TIM_IC_FALLING_EDGE.
+ * @param[in] Copy_Filter Digital input filter (0 = none .. 15 = strongest).
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_InitInputCapture(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Edge, u8 Copy_Filter);
+
+/**
+ * @brief Configure a timer to measure a pulse on its channel 1 pin without CPU involvement (PWM input mode).
+ *
+ * Channel 1 captures the rising edge and channel 2 captures the falling edge of the same input,
+ * and the counter is reset on each rising edge. After a pulse, channel 2 holds the high time and
+ * channel 1 the period, both in counter ticks (read them with MCAL_TIM_GetCapture).
+ * This is well suited to ultrasonic echo timing.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Filter Digital input filter (0 = none .. 15 = strongest).
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_InitPWMInput(u8 Copy_Timer, u8 Copy_Filter);
+
+/**
+ * @brief Read the last captured value of a channel.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[out] Copy_pValue Pointer to store the captured value.
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_GetCapture(u8 Copy_Timer, u8 Copy_Channel, u16 *Copy_pValue);
+
+/**
+ * @brief Configure a timer to produce a single pulse on a channel.
+ *
+ * After MCAL_TIM_Start, the output stays inactive for Copy_Delay ticks, is active for Copy_PulseWidth
+ * ticks and then the counter stops by itself (one-pulse mode). Call MCAL_TIM_Start again for the next pulse.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_Delay Ticks from start to the pulse (at least 1).
+ * @param[in] Copy_PulseWidth Pulse width in ticks (at least 1).
+ *
+ * @note Configure the tick frequency first with MCAL_TIM_InitTimebase.
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters or if delay + width exceed the 16-bit counter.
+ */
+Std_ReturnType MCAL_TIM_InitOnePulse(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Delay, u16 Copy_PulseWidth);
+
+/**
+ * @brief Enable the update (overflow) interrupt of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_CallbackFunc Function called from the ISR on each update event.
+ *
+ * @note The timer IRQ must also be enabled in the NVIC.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer or a NULL callback.
+ */
+Std_ReturnType MCAL_TIM_EnableUpdateInterrupt(u8 Copy_Timer, TIM_CallbackFunc_t Copy_CallbackFunc);
+
+/**
+ * @brief Disable the update (overflow) interrupt of a timer.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType MCAL_TIM_DisableUpdateInterrupt(u8 Copy_Timer);
+
+/**
+ * @brief Enable the capture/compare interrupt of a channel.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_CallbackFunc Function called from the ISR with the captured/compare value.
+ *
+ * @note The timer IRQ must also be enabled in the NVIC.
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters or a NULL callback.
+ */
+Std_ReturnType MCAL_TIM_EnableCaptureCompareInterrupt(u8 Copy_Timer, u8 Copy_Channel, TIM_CaptureCallbackFunc_t Copy_CallbackFunc);
+
+/**
+ * @brief Disable the capture/compare interrupt of a channel.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ *
+ * @return E_OK on success, E_NOT_OK for invalid parameters.
+ */
+Std_ReturnType MCAL_TIM_DisableCaptureCompareInterrupt(u8 Copy_Timer, u8 Copy_Channel);
+
+/** @} */  // TIM_Control
+
+#endif /**< TIM_INTERFACE_H_ */
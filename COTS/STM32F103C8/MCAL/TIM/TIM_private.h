@@ -0,0 +1,136 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.3                        *****************/
+/******* File Name : TIM_private.h              *****************/
+/****************************************************************/
+#ifndef TIM_PRIVATE_H_
+#define TIM_PRIVATE_H_
+
+/*****************************< Register Definitions *****************************/
+#define TIM2_BASE_ADDRESS       0x40000000U
+#define TIM3_BASE_ADDRESS       0x40000400U
+#define TIM4_BASE_ADDRESS       0x40000800U
+
+/**< General-purpose timer register structure */
+typedef struct
+{
+    volatile u32 CR1;       /**< Control register 1 */
+    volatile u32 CR2;       /**< Control register 2 */
+    volatile u32 SMCR;      /**< Slave mode control register */
+    volatile u32 DIER;      /**< DMA/Interrupt enable register */
+    volatile u32 SR;        /**< Status register */
+    volatile u32 EGR;       /**< Event generation register */
+    volatile u32 CCMR[2];   /**< Capture/compare mode registers 1 and 2 */
+    volatile u32 CCER;      /**< Capture/compare enable register */
+    volatile u32 CNT;       /**< Counter */
+    volatile u32 PSC;       /**< Prescaler */
+    volatile u32 ARR;       /**< Auto-reload register */
+    volatile u32 RESERVED0; /**< Repetition counter (advanced timers only) */
+    volatile u32 CCR[4];    /**< Capture/compare registers 1 to 4 */
+    volatile u32 RESERVED1; /**< Break and dead-time register (advanced timers only) */
+    volatile u32 DCR;       /**< DMA control register */
+    volatile u32 DMAR;      /**< DMA address for full transfer */
+} TIM_RegDef_t;
+
+#define TIM2    ((TIM_RegDef_t *)TIM2_BASE_ADDRESS)
+#define TIM3    ((TIM_RegDef_t *)TIM3_BASE_ADDRESS)
+#define TIM4    ((TIM_RegDef_t *)TIM4_BASE_ADDRESS)
+
+/**< Number of timers handled by this driver */
+#define TIM_COUNT               3
+
+/**< Number of capture/compare channels per timer */
+#define TIM_CHANNELS_COUNT      4
+
+/*****************************< The following are defines for the bit fields in the TIM registers. *****************************/
+#define TIM_CR1_CEN             0x0001  /**< Counter enable */
+#define TIM_CR1_URS             0x0004  /**< Update request source: overflow only */
+#define TIM_CR1_OPM             0x0008  /**< One-pulse mode */
+#define TIM_CR1_ARPE            0x0080  /**< Auto-reload preload enable */
+
+#define TIM_SMCR_SMS_RESET      0x0004  /**< Slave mode: reset the counter on trigger */
+#define TIM_SMCR_TS_TI1FP1      0x0050  /**< Trigger selection: filtered timer input 1 */
+
+#define TIM_DIER_UIE            0x0001  /**< Update interrupt enable */
+#define TIM_DIER_CC1IE          0x0002  /**< Capture/compare 1 interrupt enable (CCxIE = CC1IE << channel) */
+
+#define TIM_SR_UIF              0x0001  /**< Update interrupt flag */
+#define TIM_SR_CC1IF            0x0002  /**< Capture/compare 1 interrupt flag (CCxIF = CC1IF << channel) */
+#define TIM_SR_IRQ_FLAGS        0x001F  /**< Update and capture/compare 1..4 interrupt flags */
+
+#define TIM_EGR_UG              0x0001  /**< Update generation */
+
+/**< CCMR fields of one channel; the channel field is shifted by TIM_CCMR_SHIFT(channel) */
+#define TIM_CCMR_SHIFT(CH)      (((CH) & 1U) * 8U)
+#define TIM_CCMR_CHANNEL_MASK   0x00FFU
+#define TIM_CCMR_CCS_OUTPUT     0x0000U /**< Channel is an output */
+#define TIM_CCMR_CCS_TI_SAME    0x0001U /**< Input mapped on its own timer input */
+#define TIM_CCMR_CCS_TI_OTHER   0x0002U /**< Input mapped on the neighbour input (TI2 for CH1, TI1 for CH2) */
+#define TIM_CCMR_OCPE           0x0008U /**< Output compare preload enable */
+#define TIM_CCMR_OCM_PWM1       0x0060U /**< Output compare mode: PWM mode 1 */
+#define TIM_CCMR_OCM_PWM2       0x0070U /**< Output compare mode: PWM mode 2 */
+#define TIM_CCMR_ICF_SHIFT      4U      /**< Input capture filter position */
+
+/**< CCER fields of one channel; the channel field is shifted by TIM_CCER_SHIFT(channel) */
+#define TIM_CCER_SHIFT(CH)      ((CH) * 4U)
+#define TIM_CCER_CHANNEL_MASK   0x000FU
+#define TIM_CCER_CCE            0x0001U /**< Capture/compare output enable */
+#define TIM_CCER_CCP            0x0002U /**< Polarity: active low / falling edge */
+
+/**< Parameter checks */
+#define TIM_IS_VALID_TIMER(T)       ((T) < TIM_COUNT)
+#define TIM_IS_VALID_CHANNEL(CH)    ((CH) < TIM_CHANNELS_COUNT)
+
+/**< TIM2..TIM4 enable bits are consecutive in RCC_APB1ENR, in the order of the timer indices */
+#define TIM_RCC_ENABLE_BIT(T)       (RCC_APB1ENR_TIM2EN + (T))
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Program the capture/compare mode and enable bits of one channel.
+ *
+ * @param[in] Copy_pTimer The timer registers.
+ * @param[in] Copy_Channel The channel (TIM_CHANNEL1 .. TIM_CHANNEL4).
+ * @param[in] Copy_CCMRField The channel field of CCMR (unshifted).
+ * @param[in] Copy_CCERField The channel field of CCER (unshifted).
+ */
+static void TIM_ConfigureChannel(TIM_RegDef_t *Copy_pTimer, u8 Copy_Channel, u32 Copy_CCMRField, u32 Copy_CCERField);
+
+/**
+ * @brief Common body of the TIM2..TIM4 interrupt handlers.
+ *
+ * Reads the pending and enabled flags once, clears them with a single write and runs the callbacks.
+ *
+ * @param[in] Copy_Timer The timer (TIM_2, TIM_3 or TIM_4).
+ */
+static void TIM_HandleIRQ(u8 Copy_Timer);
+
+/**
+ * @brief Clock a timer (until MCAL_TIM_Stop) and return its registers.
+ */
+static TIM_RegDef_t *TIM_GetRegisters(u8 Copy_Timer);
+
+/**
+ * @brief Give back the clock taken by TIM_GetRegisters.
+ */
+static void TIM_ReleaseClock(u8 Copy_Timer);
+
+/**
+ * @brief Clock feeding TIM2, TIM3 and TIM4: PCLK1 when the APB1 prescaler is 1, 2 x PCLK1 otherwise.
+ */
+static u32 TIM_GetInputClock(u32 Copy_HClk, u32 Copy_PClk1);
+
+/**
+ * @brief RCC clock change notifier: recompute the prescaler of every configured timebase.
+ */
+static void TIM_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< TIM_PRIVATE_H_ */
@@ -0,0 +1,443 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.3                        *****************/
+/******* File Name : TIM_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "RCC_interface.h"
+#include "SCB_interface.h"
+#include "TIM_interface.h"
+#include "TIM_config.h"
+#include "TIM_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Register blocks indexed by TIM_2, TIM_3 and TIM_4 */
+static TIM_RegDef_t *const TIM_Registers[TIM_COUNT] = {TIM2, TIM3, TIM4};
+
+/**< Update callbacks */
+static TIM_CallbackFunc_t TIM_UpdateCallback[TIM_COUNT] = {NULL};
+
+/**< Capture/compare callbacks */
+static TIM_CaptureCallbackFunc_t TIM_CaptureCallback[TIM_COUNT][TIM_CHANNELS_COUNT] = {{NULL}};
+
+/**< Counter frequency of each timebase, 0 while not configured; kept across clock changes */
+static u32 TIM_TickFrequency[TIM_COUNT] = {0};
+
+/**< Bit i set while timer i holds its RCC clock: from its first use until MCAL_TIM_Stop */
+static u8 TIM_ClockHeld = 0;
+/*****************************< Function Implementations *****************************/
+Std_ReturnType MCAL_TIM_InitTimebase(u8 Copy_Timer, u32 Copy_TickFrequency, u16 Copy_AutoReload)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    TIM_RegDef_t *Local_pTimer;
+    u32 Local_InputClock = TIM_GetInputClock(MCAL_RCC_GetHclk(), MCAL_RCC_GetPclk1());
+    u32 Local_Prescaler;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && (Copy_TickFrequency != 0) && (Copy_TickFrequency <= Local_InputClock) &&
+        ((Local_InputClock % Copy_TickFrequency) == 0))
+    {
+        Local_Prescaler = (Local_InputClock / Copy_TickFrequency) - 1;
+
+        if (Local_Prescaler <= 0xFFFF)
+        {
+            Local_pTimer = TIM_GetRegisters(Copy_Timer);
+
+            /**< Stopped, up-counting, edge-aligned, preloaded auto-reload, update interrupt on overflow only */
+            Local_pTimer->CR1 = TIM_CR1_ARPE | TIM_CR1_URS;
+            Local_pTimer->PSC = Local_Prescaler;
+            Local_pTimer->ARR = Copy_AutoReload;
+            Local_pTimer->CNT = 0;
+
+            /**< Load the prescaler and auto-reload shadow registers now */
+            Local_pTimer->EGR = TIM_EGR_UG;
+            Local_pTimer->SR = 0;
+
+            /**< Follow the clock profile changes */
+            TIM_TickFrequency[Copy_Timer] = Copy_TickFrequency;
+            MCAL_RCC_RegisterClockNotifier(TIM_ClockNotifier);
+
+            Local_FunctionStatus = E_OK;
+        }
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_Start(u8 Copy_Timer)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer))
+    {
+        TIM_GetRegisters(Copy_Timer)->CR1 |= TIM_CR1_CEN;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_Stop(u8 Copy_Timer)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer))
+    {
+        TIM_GetRegisters(Copy_Timer)->CR1 &= ~TIM_CR1_CEN;
+
+        /**< A stopped timer keeps its registers with the clock gated, until it is used again */
+        TIM_ReleaseClock(Copy_Timer);
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_SetCounter(u8 Copy_Timer, u16 Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer))
+    {
+        TIM_GetRegisters(Copy_Timer)->CNT = Copy_Value;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_GetCounter(u8 Copy_Timer, u16 *Copy_pValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && (Copy_pValue != NULL))
+    {
+        *Copy_pValue = (u16)TIM_GetRegisters(Copy_Timer)->CNT;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_SetAutoReload(u8 Copy_Timer, u16 Copy_AutoReload)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer))
+    {
+        TIM_GetRegisters(Copy_Timer)->ARR = Copy_AutoReload;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_InitPWM(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Polarity, u16 Copy_Compare)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    TIM_RegDef_t *Local_pTimer;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel) &&
+        ((Copy_Polarity == TIM_PWM_ACTIVE_HIGH) || (Copy_Polarity == TIM_PWM_ACTIVE_LOW)))
+    {
+        Local_pTimer = TIM_GetRegisters(Copy_Timer);
+
+        Local_pTimer->CCR[Copy_Channel] = Copy_Compare;
+        TIM_ConfigureChannel(Local_pTimer, Copy_Channel,
+                             TIM_CCMR_CCS_OUTPUT | TIM_CCMR_OCM_PWM1 | TIM_CCMR_OCPE,
+                             TIM_CCER_CCE | ((Copy_Polarity == TIM_PWM_ACTIVE_LOW) ? TIM_CCER_CCP : 0));
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_SetCompare(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Compare)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel))
+    {
+        TIM_GetRegisters(Copy_Timer)->CCR[Copy_Channel] = Copy_Compare;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_InitInputCapture(u8 Copy_Timer, u8 Copy_Channel, u8 Copy_Edge, u8 Copy_Filter)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel) && (Copy_Filter <= 0x0F) &&
+        ((Copy_Edge == TIM_IC_RISING_EDGE) || (Copy_Edge == TIM_IC_FALLING_EDGE)))
+    {
+        TIM_ConfigureChannel(TIM_GetRegisters(Copy_Timer), Copy_Channel,
+                             TIM_CCMR_CCS_TI_SAME | ((u32)Copy_Filter << TIM_CCMR_ICF_SHIFT),
+                             TIM_CCER_CCE | ((Copy_Edge == TIM_IC_FALLING_EDGE) ? TIM_CCER_CCP : 0));
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_InitPWMInput(u8 Copy_Timer, u8 Copy_Filter)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    TIM_RegDef_t *Local_pTimer;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && (Copy_Filter <= 0x0F))
+    {
+        Local_pTimer = TIM_GetRegisters(Copy_Timer);
+
+        /**< CH1 captures TI1 rising edges (period), CH2 captures TI1 falling edges (high time) */
+        TIM_ConfigureChannel(Local_pTimer, TIM_CHANNEL1,
+                             TIM_CCMR_CCS_TI_SAME | ((u32)Copy_Filter << TIM_CCMR_ICF_SHIFT),
+                             TIM_CCER_CCE);
+        TIM_ConfigureChannel(Local_pTimer, TIM_CHANNEL2,
+                             TIM_CCMR_CCS_TI_OTHER | ((u32)Copy_Filter << TIM_CCMR_ICF_SHIFT),
+                             TIM_CCER_CCE | TIM_CCER_CCP);
+
+        /**< Restart the counter on every rising edge of TI1 */
+        Local_pTimer->SMCR = TIM_SMCR_TS_TI1FP1 | TIM_SMCR_SMS_RESET;
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_GetCapture(u8 Copy_Timer, u8 Copy_Channel, u16 *Copy_pValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel) && (Copy_pValue != NULL))
+    {
+        *Copy_pValue = (u16)TIM_GetRegisters(Copy_Timer)->CCR[Copy_Channel];
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_InitOnePulse(u8 Copy_Timer, u8 Copy_Channel, u16 Copy_Delay, u16 Copy_PulseWidth)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    TIM_RegDef_t *Local_pTimer;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel) &&
+        (Copy_Delay != 0) && (Copy_PulseWidth != 0) && (((u32)Copy_Delay + Copy_PulseWidth - 1) <= 0xFFFF))
+    {
+        Local_pTimer = TIM_GetRegisters(Copy_Timer);
+
+        /**< PWM mode 2: inactive while CNT < CCR, active from CCR up to ARR, then the counter stops */
+        Local_pTimer->CR1 &= ~TIM_CR1_CEN;
+        Local_pTimer->CR1 |= TIM_CR1_OPM;
+        Local_pTimer->CCR[Copy_Channel] = Copy_Delay;
+        Local_pTimer->ARR = (u32)Copy_Delay + Copy_PulseWidth - 1;
+        Local_pTimer->CNT = 0;
+        TIM_ConfigureChannel(Local_pTimer, Copy_Channel, TIM_CCMR_CCS_OUTPUT | TIM_CCMR_OCM_PWM2, TIM_CCER_CCE);
+
+        /**< Load the shadow registers */
+        Local_pTimer->EGR = TIM_EGR_UG;
+        Local_pTimer->SR = 0;
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_EnableUpdateInterrupt(u8 Copy_Timer, TIM_CallbackFunc_t Copy_CallbackFunc)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && (Copy_CallbackFunc != NULL))
+    {
+        TIM_UpdateCallback[Copy_Timer] = Copy_CallbackFunc;
+        TIM_GetRegisters(Copy_Timer)->SR = ~(u32)TIM_SR_UIF;
+        TIM_GetRegisters(Copy_Timer)->DIER |= TIM_DIER_UIE;
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_DisableUpdateInterrupt(u8 Copy_Timer)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer))
+    {
+        TIM_GetRegisters(Copy_Timer)->DIER &= ~TIM_DIER_UIE;
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_EnableCaptureCompareInterrupt(u8 Copy_Timer, u8 Copy_Channel, TIM_CaptureCallbackFunc_t Copy_CallbackFunc)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel) && (Copy_CallbackFunc != NULL))
+    {
+        TIM_CaptureCallback[Copy_Timer][Copy_Channel] = Copy_CallbackFunc;
+        TIM_GetRegisters(Copy_Timer)->SR = ~((u32)TIM_SR_CC1IF << Copy_Channel);
+        TIM_GetRegisters(Copy_Timer)->DIER |= ((u32)TIM_DIER_CC1IE << Copy_Channel);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_TIM_DisableCaptureCompareInterrupt(u8 Copy_Timer, u8 Copy_Channel)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+
+    if (TIM_IS_VALID_TIMER(Copy_Timer) && TIM_IS_VALID_CHANNEL(Copy_Channel))
+    {
+        TIM_GetRegisters(Copy_Timer)->DIER &= ~((u32)TIM_DIER_CC1IE << Copy_Channel);
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+/*****************************< Private Functions *****************************/
+static void TIM_ConfigureChannel(TIM_RegDef_t *Copy_pTimer, u8 Copy_Channel, u32 Copy_CCMRField, u32 Copy_CCERField)
+{
+    u8 Local_CCMRShift = TIM_CCMR_SHIFT(Copy_Channel);
+    u8 Local_CCERShift = TIM_CCER_SHIFT(Copy_Channel);
+
+    /**< The channel must be disabled while its direction (CCxS) is changed */
+    Copy_pTimer->CCER &= ~(TIM_CCER_CHANNEL_MASK << Local_CCERShift);
+
+    Copy_pTimer->CCMR[Copy_Channel >> 1] = (Copy_pTimer->CCMR[Copy_Channel >> 1] & ~(TIM_CCMR_CHANNEL_MASK << Local_CCMRShift)) |
+                                           (Copy_CCMRField << Local_CCMRShift);
+
+    Copy_pTimer->CCER |= (Copy_CCERField << Local_CCERShift);
+}
+
+static void TIM_HandleIRQ(u8 Copy_Timer)
+{
+    TIM_RegDef_t *Local_pTimer = TIM_Registers[Copy_Timer];
+    u32 Local_Flags;
+    u8 Local_Channel;
+
+    /**< Only handle the events that are both pending and enabled */
+    Local_Flags = Local_pTimer->SR & Local_pTimer->DIER & TIM_SR_IRQ_FLAGS;
+
+    /**< The flags are rc_w0: writing 0 clears them, writing 1 leaves the others untouched */
+    Local_pTimer->SR = ~Local_Flags;
+
+    if ((Local_Flags & TIM_SR_UIF) && (TIM_UpdateCallback[Copy_Timer] != NULL))
+    {
+        TIM_UpdateCallback[Copy_Timer]();
+    }
+
+    for (Local_Channel = 0; Local_Channel < TIM_CHANNELS_COUNT; Local_Channel++)
+    {
+        if ((Local_Flags & ((u32)TIM_SR_CC1IF << Local_Channel)) && (TIM_CaptureCallback[Copy_Timer][Local_Channel] != NULL))
+        {
+            TIM_CaptureCallback[Copy_Timer][Local_Channel]((u16)Local_pTimer->CCR[Local_Channel]);
+        }
+    }
+}
+
+static TIM_RegDef_t *TIM_GetRegisters(u8 Copy_Timer)
+{
+    u32 Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if (GET_BIT(TIM_ClockHeld, Copy_Timer) == 0)
+    {
+        SET_BIT(TIM_ClockHeld, Copy_Timer);
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, TIM_RCC_ENABLE_BIT(Copy_Timer));
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    return TIM_Registers[Copy_Timer];
+}
+
+static void TIM_ReleaseClock(u8 Copy_Timer)
+{
+    u32 Local_PrimaskState = SCB_EnterCriticalSection();
+
+    if (GET_BIT(TIM_ClockHeld, Copy_Timer) != 0)
+    {
+        CLR_BIT(TIM_ClockHeld, Copy_Timer);
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, TIM_RCC_ENABLE_BIT(Copy_Timer));
+    }
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+}
+
+static u32 TIM_GetInputClock(u32 Copy_HClk, u32 Copy_PClk1)
+{
+    return (Copy_HClk == Copy_PClk1) ? Copy_PClk1 : (2UL * Copy_PClk1);
+}
+
+static void TIM_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew)
+{
+    u32 Local_InputClock;
+    u32 Local_Prescaler;
+    u8 Local_Timer;
+
+    (void)Copy_pPrevious;
+
+    if (Copy_Event != RCC_CLOCK_POST_CHANGE)
+    {
+        return;
+    }
+
+    Local_InputClock = TIM_GetInputClock(Copy_pNew->HClk, Copy_pNew->PClk1);
+
+    for (Local_Timer = 0; Local_Timer < TIM_COUNT; Local_Timer++)
+    {
+        if (TIM_TickFrequency[Local_Timer] == 0)
+        {
+            continue;
+        }
+
+        /**< Nearest prescaler when the new clock is not an exact multiple of the tick frequency */
+        Local_Prescaler = (Local_InputClock + (TIM_TickFrequency[Local_Timer] / 2UL)) / TIM_TickFrequency[Local_Timer];
+        if (Local_Prescaler == 0)
+        {
+            Local_Prescaler = 1;
+        }
+        else if (Local_Prescaler > 0x10000UL)
+        {
+            Local_Prescaler = 0x10000UL;
+        }
+
+        /**< PSC is preloaded: the running period ends at the old rate, without a glitch on the outputs */
+        /**< A stopped timer is clocked just for the write */
+        MCAL_RCC_AcquirePeripheral(RCC_APB1, TIM_RCC_ENABLE_BIT(Local_Timer));
+        TIM_Registers[Local_Timer]->PSC = Local_Prescaler - 1UL;
+        MCAL_RCC_ReleasePeripheral(RCC_APB1, TIM_RCC_ENABLE_BIT(Local_Timer));
+    }
+}
+
+/*****************************< IRQ Handlers *****************************/
+void TIM2_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM_2);
+}
+
+void TIM3_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM_3);
+}
+
+void TIM4_IRQHandler(void)
+{
+    TIM_HandleIRQ(TIM_4);
+}
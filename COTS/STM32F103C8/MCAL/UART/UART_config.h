@@ -66,6 +66,11 @@ typedef enum {
   BAUD_RATE_38400     /**< Baud rate of 38400 */
 } UART_BaudRate_t;
 
+/**
+ * @brief Size of the stack buffer MCAL_USART_Printf formats into, including the terminator.
+ */
+#define USART_PRINTF_BUFFER_SIZE    64
+
 /**
  * @}
  */
@@ -1,7 +1,7 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 32 Sep 2023                *****************/
-/******* Version   : 0.1                        *****************/
+/******* Version   : 0.3                        *****************/
 /******* File Name : UART_interface.h           *****************/
 /****************************************************************/
 #ifndef UART_INTERFACE_H_
@@ -12,7 +12,6 @@
  * @{
  */
 
-#define USART_CLK_SRC           8000000
 /**
  * @brief Enumeration for UART parity modes.
  *
@@ -135,6 +134,8 @@ typedef struct {
  * @return
  *     - E_OK: UART initialization successful.
  *     - E_NOT_OK: UART initialization failed or invalid configuration.
+ *
+ * @note The USART1 clock is acquired here and kept, since the receiver must run at all times.
  */
 Std_ReturnType MCAL_USART_Init(USART_Config_t *USARTConfig);
 
@@ -153,6 +154,21 @@ Std_ReturnType MCAL_USART_Init(USART_Config_t *USARTConfig);
  */
 Std_ReturnType MCAL_USART_Transmit(u8 *Data, u16 DataSize);
 
+/**
+ * @brief Formats a message and transmits it via the UART interface.
+ *
+ * This function formats the message with the FMT printf subset (%d %i %u %x %X %c %s %%
+ * and %q for Q16.16 values) into a stack buffer of USART_PRINTF_BUFFER_SIZE bytes and
+ * transmits it. Longer messages are truncated.
+ *
+ * @param[in] Format The format string.
+ *
+ * @return
+ *     - E_OK: Message transmitted.
+ *     - E_NOT_OK: Invalid format or nothing to transmit.
+ */
+Std_ReturnType MCAL_USART_Printf(const char *Format, ...);
+
 /**
  * @brief Receives data via the UART interface.
  *
@@ -88,5 +88,16 @@ typedef struct {
 #define USART_SR_FE         0x00000002 /**< Framing error */
 #define USART_SR_PE         0x00000001 /**< Parity error */
 
+/**
+ * @brief Program BRR for USART_BaudRate from the given USART clock.
+ *
+ * @param[in] Copy_Clock The USART1 input clock (PCLK2) in Hz.
+ */
+static void USART_SetBaudRate(u32 Copy_Clock);
+
+/**
+ * @brief RCC clock change notifier: let the last frame go out, then recompute BRR from PCLK2.
+ */
+static void USART_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew);
 
 #endif /**< UART_PRIVATE_H_ */
\ No newline at end of file
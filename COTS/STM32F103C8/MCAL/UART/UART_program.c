@@ -1,17 +1,24 @@
 /****************************************************************/
 /******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
 /******* Date      : 32 Sep 2023                *****************/
-/******* Version   : 0.2                        *****************/
+/******* Version   : 0.5                        *****************/
 /******* File Name : UART_interface.h           *****************/
 /****************************************************************/
 
+/*****************************< SYS *****************************/
+#include <stdarg.h>
 /*****************************< LIB *****************************/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "FMT.h"
 /*****************************< MCAL *****************************/
+#include "RCC_interface.h"
 #include "UART_interface.h"
 #include "UART_private.h"
 #include "UART_config.h"
+/*****************************< Global Variable Section *****************************/
+/**< Baud rate of the last MCAL_USART_Init, kept to recompute BRR when the clocks change */
+static u32 USART_BaudRate = 0;
 /*****************************< Function Implementations *****************************/
 Std_ReturnType MCAL_USART_Init(USART_Config_t *USARTConfig)
 {
@@ -19,6 +26,12 @@ Std_ReturnType MCAL_USART_Init(USART_Config_t *USARTConfig)
 	{
 		return E_INVALID_PARAMETER;
 	}
+  /**< The receiver is always enabled, so USART1 stays clocked from the first initialisation on */
+  if (USART_BaudRate == 0)
+  {
+    MCAL_RCC_AcquirePeripheral(RCC_APB2, RCC_APB2ENR_USART1EN);
+  }
+
   /**< Configure UART word length (data bits) */
   if (USARTConfig->WordLength == USART_WORD_LENGTH_8BIT)
   {
@@ -55,29 +68,11 @@ Std_ReturnType MCAL_USART_Init(USART_Config_t *USARTConfig)
   }
 
   /*********************< Configure UART baud rate *********************/
-  /**< Calculate the value of the USARTDIV register based on the desired baud rate */
-  f32 Local_f32USARTDIV = (f32)USART_CLK_SRC / (16 * USARTConfig->BaudRate);
-
-  /**< Calculate the integer (mantissa) and fractional parts of USARTDIV */
-  u16 Local_u16DIV_Mantissa = (u16)Local_f32USARTDIV;
-  u16 Local_u16DIV_Fraction = (u16)(((Local_f32USARTDIV - Local_u16DIV_Mantissa) * 16) + 0.5);
-
-  /**< Check if the fractional part requires carrying */
-  u8 Local_u8Carry = 0;
-  if (Local_u16DIV_Fraction >= 16)
-  {
-    Local_u16DIV_Fraction -= 16;
-    Local_u8Carry = 1;
-  }
+  USART_BaudRate = USARTConfig->BaudRate;
+  USART_SetBaudRate(MCAL_RCC_GetPclk2());   /**< USART1 is on APB2 */
 
-  /**< Adjust the mantissa if carry is required */
-  if (Local_u8Carry == 1)
-  {
-    Local_u16DIV_Mantissa += 1;
-  }
-
-  /**< Configure the Baud Rate Register (BRR) with calculated values */
-  USART1->BRR = (Local_u16DIV_Mantissa << 4) | Local_u16DIV_Fraction;
+  /**< Follow the clock profile changes */
+  MCAL_RCC_RegisterClockNotifier(USART_ClockNotifier);
   /*********************< End of Configure UART baud rate *********************/
 
   /**< Enable Transmitter */
@@ -116,6 +111,24 @@ Std_ReturnType MCAL_USART_Transmit(u8 *Data, u16 DataSize)
   return E_OK; /**< Define your success code */ 
 }
 
+Std_ReturnType MCAL_USART_Printf(const char *Format, ...)
+{
+  u8 Local_Message[USART_PRINTF_BUFFER_SIZE];
+  u16 Local_Length;
+  va_list Local_Args;
+
+  va_start(Local_Args, Format);
+  Local_Length = FMT_VFormat((char *)Local_Message, sizeof(Local_Message), Format, Local_Args);
+  va_end(Local_Args);
+
+  if (Local_Length == 0)
+  {
+    return E_NOT_OK;
+  }
+
+  return MCAL_USART_Transmit(Local_Message, Local_Length);
+}
+
 Std_ReturnType MCAL_USART_Receive(u8 *Data, u16 DataSize)
 {
   if (Data == NULL || DataSize == 0) 
@@ -136,3 +149,55 @@ Std_ReturnType MCAL_USART_Receive(u8 *Data, u16 DataSize)
 
   return E_OK; /**< Define your success code */ 
 }
+/*****************************< Private Functions *****************************/
+static void USART_SetBaudRate(u32 Copy_Clock)
+{
+  /**< Calculate the value of the USARTDIV register based on the desired baud rate */
+  f32 Local_f32USARTDIV = (f32)Copy_Clock / (16 * USART_BaudRate);
+
+  /**< Calculate the integer (mantissa) and fractional parts of USARTDIV */
+  u16 Local_u16DIV_Mantissa = (u16)Local_f32USARTDIV;
+  u16 Local_u16DIV_Fraction = (u16)(((Local_f32USARTDIV - Local_u16DIV_Mantissa) * 16) + 0.5);
+
+  /**< Check if the fractional part requires carrying */
+  u8 Local_u8Carry = 0;
+  if (Local_u16DIV_Fraction >= 16)
+  {
+    Local_u16DIV_Fraction -= 16;
+    Local_u8Carry = 1;
+  }
+
+  /**< Adjust the mantissa if carry is required */
+  if (Local_u8Carry == 1)
+  {
+    Local_u16DIV_Mantissa += 1;
+  }
+
+  /**< Configure the Baud Rate Register (BRR) with calculated values */
+  USART1->BRR = (Local_u16DIV_Mantissa << 4) | Local_u16DIV_Fraction;
+}
+
+static void USART_ClockNotifier(u8 Copy_Event, const RCC_Clocks_t *Copy_pPrevious, const RCC_Clocks_t *Copy_pNew)
+{
+  (void)Copy_pPrevious;
+
+  /**< Not initialised yet */
+  if (USART_BaudRate == 0)
+  {
+    return;
+  }
+
+  if (Copy_Event == RCC_CLOCK_PRE_CHANGE)
+  {
+    /**< A frame still shifting out would be sent at the wrong rate */
+    while ((USART1->CR1 & USART_CR1_TE) && !(USART1->SR & USART_SR_TC))
+    {
+      /**< Wait until the TC flag is set */
+    }
+  }
+  else
+  {
+    USART_SetBaudRate(Copy_pNew->PClk2);
+  }
+}
+/*****************************< End of Function Implementations *****************************/
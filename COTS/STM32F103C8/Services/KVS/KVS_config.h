@@ -0,0 +1,39 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : KVS_config.h               *****************/
+/****************************************************************/
+#ifndef KVS_CONFIG_H_
+#define KVS_CONFIG_H_
+
+/**
+ * @brief Address of the first flash page used by the store (page aligned).
+ *
+ * The store uses KVS_PAGE_COUNT consecutive pages of FPEC_PAGE_SIZE bytes. The default takes the
+ * last two pages of the 64 KB STM32F103C8.
+ *
+ * @note These pages must not hold code, and must lie at or after FPEC_APP_END_PAGE so that the
+ *       bootloader's FPEC_EraseAppArea keeps them; this is checked at compile time.
+ */
+#define KVS_FLASH_ADDRESS       0x0800F800UL
+
+/**
+ * @brief Number of flash pages (at least 2).
+ *
+ * One page is active; compaction moves the live records into the next page in turn, so the
+ * erases are spread evenly over all of them. More pages mean less wear per page.
+ */
+#define KVS_PAGE_COUNT          2
+
+/**
+ * @brief Number of keys. Keys are 0 .. KVS_MAX_KEYS - 1.
+ */
+#define KVS_MAX_KEYS            32
+
+/**
+ * @brief Largest value in bytes.
+ */
+#define KVS_MAX_VALUE_SIZE      64
+
+#endif /**< KVS_CONFIG_H_ */
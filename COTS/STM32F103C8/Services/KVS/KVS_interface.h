@@ -0,0 +1,92 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : KVS_interface.h            *****************/
+/****************************************************************/
+#ifndef KVS_INTERFACE_H_
+#define KVS_INTERFACE_H_
+
+/**
+ * @addtogroup PublicFunctions
+ * @{
+ */
+
+/**
+ * @brief Mount the flash key-value store.
+ *
+ * Finds the active page, finishes or discards a compaction interrupted by a reset, erases stale
+ * pages, and scans the records of the active page once to build the RAM index. Blank flash is
+ * formatted.
+ *
+ * Records are only ever appended. A record cut short by a power failure fails its CRC and is
+ * ignored (the page is then treated as full, so the next write compacts it). A compaction only
+ * becomes visible once its new page is marked valid, and the old page is erased after that, so
+ * after a reset at any point either the old or the new contents are found, never a mixture.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The store is ready.
+ * @retval E_NOT_OK A flash erase or program failed.
+ *
+ * @note Call from thread context; the CPU stalls while the flash is erased or programmed.
+ */
+Std_ReturnType KVS_Init(void);
+
+/**
+ * @brief Read a value.
+ *
+ * The RAM index gives the record directly, so the cost is a copy from memory-mapped flash.
+ *
+ * @param[in] Copy_Key The key.
+ * @param[out] Copy_pValue Buffer for the value.
+ * @param[in] Copy_BufferSize Size of Copy_pValue in bytes.
+ * @param[out] Copy_pLength Receives the value length; may be NULL.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The value was copied.
+ * @retval E_NOT_OK The key has no value, is out of range, or the buffer is too small.
+ */
+Std_ReturnType KVS_Read(u16 Copy_Key, void *Copy_pValue, u16 Copy_BufferSize, u16 *Copy_pLength);
+
+/**
+ * @brief Write a value.
+ *
+ * The record is appended to the active page. Writing the value a key already holds does not touch
+ * the flash. When the page is full, the live records are compacted into the next page together
+ * with the new one.
+ *
+ * @param[in] Copy_Key The key (0 .. KVS_MAX_KEYS - 1).
+ * @param[in] Copy_pValue The value.
+ * @param[in] Copy_Length Value length (1 .. KVS_MAX_VALUE_SIZE).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The value is stored.
+ * @retval E_NOT_OK Invalid arguments, no room even after compaction, or a flash failure.
+ */
+Std_ReturnType KVS_Write(u16 Copy_Key, const void *Copy_pValue, u16 Copy_Length);
+
+/**
+ * @brief Delete a value (a tombstone record is appended; compaction drops both).
+ *
+ * @param[in] Copy_Key The key.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The key has no value any more.
+ * @retval E_NOT_OK Invalid key or a flash failure.
+ */
+Std_ReturnType KVS_Delete(u16 Copy_Key);
+
+/**
+ * @brief Erase every value.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     The store is empty.
+ * @retval E_NOT_OK A flash erase or program failed.
+ */
+Std_ReturnType KVS_Format(void);
+
+/**
+ * @} (End of PublicFunctions)
+ */
+
+#endif /**< KVS_INTERFACE_H_ */
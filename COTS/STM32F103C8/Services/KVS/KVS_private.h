@@ -0,0 +1,104 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : KVS_private.h              *****************/
+/****************************************************************/
+#ifndef KVS_PRIVATE_H_
+#define KVS_PRIVATE_H_
+
+#if KVS_PAGE_COUNT < 2
+#error "KVS_PAGE_COUNT must be at least 2"
+#endif
+
+#if (KVS_FLASH_ADDRESS % FPEC_PAGE_SIZE) != 0
+#error "KVS_FLASH_ADDRESS must be page aligned"
+#endif
+
+#if (KVS_FLASH_ADDRESS < (FPEC_FLASH_BASE + (FPEC_APP_END_PAGE * FPEC_PAGE_SIZE))) || \
+    ((KVS_FLASH_ADDRESS + (KVS_PAGE_COUNT * FPEC_PAGE_SIZE)) > (FPEC_FLASH_BASE + FPEC_FLASH_SIZE))
+#error "The KVS pages must lie between FPEC_APP_END_PAGE and the end of flash, outside the area FPEC_EraseAppArea erases"
+#endif
+
+/**
+ * @brief Page status, the first half-word of a page.
+ *
+ * Each transition only clears bits, so it is a single half-word program: erased -> receiving
+ * (compaction in progress) -> valid.
+ */
+#define KVS_PAGE_ERASED         0xFFFFU
+#define KVS_PAGE_RECEIVING      0xEEEEU
+#define KVS_PAGE_VALID          0x0000U
+
+/**
+ * @brief Page header: status, a reserved half-word, and the 32-bit sequence number that orders
+ *        the pages (and counts compactions).
+ */
+#define KVS_HEADER_SIZE         8U
+
+/**
+ * @brief Record: key, value length, value padded to a half-word, CRC-16 of all of them.
+ *
+ * An erased key (0xFFFF) marks the end of the log. A length of 0 is a tombstone.
+ */
+#define KVS_RECORD_OVERHEAD     6U
+#define KVS_RECORD_SIZE(LENGTH) (KVS_RECORD_OVERHEAD + (((u32)(LENGTH) + 1U) & ~1UL))
+#define KVS_KEY_ERASED          0xFFFFU
+
+#define KVS_PAGE_ADDRESS(PAGE)  (KVS_FLASH_ADDRESS + ((u32)(PAGE) * FPEC_PAGE_SIZE))
+
+/**< CRC-16/CCITT-FALSE */
+#define KVS_CRC_INIT            0xFFFFU
+#define KVS_CRC_POLY            0x1021U
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Append a record, compacting first when it does not fit.
+ *
+ * @param[in] Copy_Key The key.
+ * @param[in] Copy_pValue The value, or NULL for a tombstone.
+ * @param[in] Copy_Length The value length, 0 for a tombstone.
+ */
+static Std_ReturnType KVS_Append(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length);
+
+/**
+ * @brief Move the live records and the new record into the next page, then erase the old page.
+ */
+static Std_ReturnType KVS_Compact(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length);
+
+/**
+ * @brief Build a record in KVS_RecordBuffer.
+ *
+ * @return The record size in half-words.
+ */
+static u16 KVS_BuildRecord(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length);
+
+/**
+ * @brief Scan the active page: fill the index and find the free offset.
+ */
+static void KVS_Scan(void);
+
+/**
+ * @brief Erase a page unless it is already blank.
+ */
+static Std_ReturnType KVS_ErasePage(u8 Copy_Page);
+
+/**
+ * @brief Program a page header.
+ */
+static Std_ReturnType KVS_WriteHeader(u8 Copy_Page, u16 Copy_Status, u32 Copy_Sequence);
+
+/**
+ * @brief CRC-16 of a byte run, continuing from Copy_Crc.
+ */
+static u16 KVS_Crc16(u16 Copy_Crc, const u8 *Copy_pData, u32 Copy_Length);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< KVS_PRIVATE_H_ */
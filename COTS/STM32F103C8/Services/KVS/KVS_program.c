@@ -0,0 +1,409 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : KVS_program.c              *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "FPEC_interface.h"
+#include "FPEC_config.h"
+/*****************************< SERVICES *****************************/
+#include "KVS_interface.h"
+#include "KVS_config.h"
+#include "KVS_private.h"
+/*****************************< Global Variable Section *****************************/
+/**< Active page, its sequence number and the first free byte */
+static u8 KVS_ActivePage = 0;
+static u32 KVS_Sequence = 0;
+static u32 KVS_FreeOffset = FPEC_PAGE_SIZE;
+
+/**< RAM index: byte offset of the latest record of each key in the active page, 0 when the key has no value */
+static u16 KVS_Index[KVS_MAX_KEYS];
+
+/**< A record is assembled here, then programmed in one run */
+static u16 KVS_RecordBuffer[KVS_RECORD_SIZE(KVS_MAX_VALUE_SIZE) / 2U];
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+/**
+ * @addtogroup PublicFunctions
+ * @{
+ */
+
+Std_ReturnType KVS_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_Page;
+    u8 Local_Found = 0;
+    u16 Local_Status;
+    u32 Local_Sequence;
+
+    /**< The valid page with the newest sequence number is the active one (two valid pages: the
+         reset hit between the end of a compaction and the erase of its source) */
+    for (Local_Page = 0; Local_Page < KVS_PAGE_COUNT; Local_Page++)
+    {
+        Local_Status = *((volatile u16 *)KVS_PAGE_ADDRESS(Local_Page));
+        Local_Sequence = *((volatile u32 *)(KVS_PAGE_ADDRESS(Local_Page) + 4U));
+
+        if ((Local_Status == KVS_PAGE_VALID) &&
+            ((Local_Found == 0) || ((s32)(Local_Sequence - KVS_Sequence) > 0)))
+        {
+            KVS_ActivePage = Local_Page;
+            KVS_Sequence = Local_Sequence;
+            Local_Found = 1;
+        }
+    }
+
+    if (Local_Found == 0)
+    {
+        /**< Blank flash (or nothing recoverable): start empty */
+        return KVS_Format();
+    }
+
+    /**< Anything else is stale: an old valid page, an interrupted compaction, or an interrupted erase */
+    for (Local_Page = 0; Local_Page < KVS_PAGE_COUNT; Local_Page++)
+    {
+        if (Local_Page != KVS_ActivePage)
+        {
+            Local_FunctionStatus &= KVS_ErasePage(Local_Page);
+        }
+    }
+
+    KVS_Scan();
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType KVS_Read(u16 Copy_Key, void *Copy_pValue, u16 Copy_BufferSize, u16 *Copy_pLength)
+{
+    const u8 *Local_pRecord;
+    u8 *Local_pValue = (u8 *)Copy_pValue;
+    u16 Local_Length;
+    u16 Local_Index;
+
+    if ((Copy_Key >= KVS_MAX_KEYS) || (Copy_pValue == NULL) || (KVS_Index[Copy_Key] == 0))
+    {
+        return E_NOT_OK;
+    }
+
+    Local_pRecord = (const u8 *)(KVS_PAGE_ADDRESS(KVS_ActivePage) + KVS_Index[Copy_Key]);
+    Local_Length = ((const u16 *)Local_pRecord)[1];
+
+    if (Local_Length > Copy_BufferSize)
+    {
+        return E_NOT_OK;
+    }
+
+    for (Local_Index = 0; Local_Index < Local_Length; Local_Index++)
+    {
+        Local_pValue[Local_Index] = Local_pRecord[4U + Local_Index];
+    }
+
+    if (Copy_pLength != NULL)
+    {
+        *Copy_pLength = Local_Length;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType KVS_Write(u16 Copy_Key, const void *Copy_pValue, u16 Copy_Length)
+{
+    const u8 *Local_pValue = (const u8 *)Copy_pValue;
+    const u8 *Local_pRecord;
+    u16 Local_Index;
+
+    if ((Copy_Key >= KVS_MAX_KEYS) || (Copy_pValue == NULL) || (Copy_Length == 0) || (Copy_Length > KVS_MAX_VALUE_SIZE))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< Rewriting the current value would only wear the flash */
+    if (KVS_Index[Copy_Key] != 0)
+    {
+        Local_pRecord = (const u8 *)(KVS_PAGE_ADDRESS(KVS_ActivePage) + KVS_Index[Copy_Key]);
+        if (((const u16 *)Local_pRecord)[1] == Copy_Length)
+        {
+            for (Local_Index = 0; (Local_Index < Copy_Length) && (Local_pRecord[4U + Local_Index] == Local_pValue[Local_Index]); Local_Index++)
+            {
+            }
+            if (Local_Index == Copy_Length)
+            {
+                return E_OK;
+            }
+        }
+    }
+
+    return KVS_Append(Copy_Key, Local_pValue, Copy_Length);
+}
+
+Std_ReturnType KVS_Delete(u16 Copy_Key)
+{
+    if (Copy_Key >= KVS_MAX_KEYS)
+    {
+        return E_NOT_OK;
+    }
+
+    if (KVS_Index[Copy_Key] == 0)
+    {
+        return E_OK;
+    }
+
+    return KVS_Append(Copy_Key, NULL, 0);
+}
+
+Std_ReturnType KVS_Format(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_Page;
+    u16 Local_Key;
+
+    for (Local_Page = 0; Local_Page < KVS_PAGE_COUNT; Local_Page++)
+    {
+        Local_FunctionStatus &= KVS_ErasePage(Local_Page);
+    }
+
+    for (Local_Key = 0; Local_Key < KVS_MAX_KEYS; Local_Key++)
+    {
+        KVS_Index[Local_Key] = 0;
+    }
+
+    /**< Keep counting from the last sequence number so the compaction count survives a format */
+    KVS_ActivePage = 0;
+    KVS_Sequence++;
+    KVS_FreeOffset = FPEC_PAGE_SIZE;
+
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = KVS_WriteHeader(0, KVS_PAGE_VALID, KVS_Sequence);
+        if (Local_FunctionStatus == E_OK)
+        {
+            KVS_FreeOffset = KVS_HEADER_SIZE;
+        }
+    }
+
+    return Local_FunctionStatus;
+}
+
+/**
+ * @} (End of PublicFunctions)
+ */
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+static Std_ReturnType KVS_Append(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length)
+{
+    u16 Local_HalfWords;
+
+    if ((KVS_FreeOffset + KVS_RECORD_SIZE(Copy_Length)) > FPEC_PAGE_SIZE)
+    {
+        return KVS_Compact(Copy_Key, Copy_pValue, Copy_Length);
+    }
+
+    Local_HalfWords = KVS_BuildRecord(Copy_Key, Copy_pValue, Copy_Length);
+
+    if (FPEC_ProgramHalfWords(KVS_PAGE_ADDRESS(KVS_ActivePage) + KVS_FreeOffset, KVS_RecordBuffer, Local_HalfWords) != FPEC_STATUS_OK)
+    {
+        /**< The space may hold part of a record now: stop appending here, the next write compacts */
+        KVS_FreeOffset = FPEC_PAGE_SIZE;
+        return E_NOT_OK;
+    }
+
+    KVS_Index[Copy_Key] = (Copy_Length != 0) ? (u16)KVS_FreeOffset : 0;
+    KVS_FreeOffset += (u32)Local_HalfWords * 2U;
+
+    return E_OK;
+}
+
+static Std_ReturnType KVS_Compact(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length)
+{
+    u32 Local_Source = KVS_PAGE_ADDRESS(KVS_ActivePage);
+    u8 Local_Target = (u8)((KVS_ActivePage + 1U) % KVS_PAGE_COUNT);
+    u32 Local_Destination = KVS_PAGE_ADDRESS(Local_Target);
+    u32 Local_Offset = KVS_HEADER_SIZE;
+    u32 Local_Size;
+    u16 Local_HalfWords;
+    u16 Local_Key;
+
+    /**< Check the room first, so a store that cannot take the value is left untouched */
+    for (Local_Key = 0; Local_Key < KVS_MAX_KEYS; Local_Key++)
+    {
+        if ((Local_Key != Copy_Key) && (KVS_Index[Local_Key] != 0))
+        {
+            Local_Offset += KVS_RECORD_SIZE(*((const u16 *)(Local_Source + KVS_Index[Local_Key] + 2U)));
+        }
+    }
+    if ((Copy_Length != 0) && ((Local_Offset + KVS_RECORD_SIZE(Copy_Length)) > FPEC_PAGE_SIZE))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< 1. Claim the target: a reset from here on leaves it receiving, and Init discards it */
+    if ((KVS_ErasePage(Local_Target) != E_OK) ||
+        (KVS_WriteHeader(Local_Target, KVS_PAGE_RECEIVING, KVS_Sequence + 1U) != E_OK))
+    {
+        return E_NOT_OK;
+    }
+
+    /**< 2. Copy the latest record of every other live key, straight from flash */
+    Local_Offset = KVS_HEADER_SIZE;
+    for (Local_Key = 0; Local_Key < KVS_MAX_KEYS; Local_Key++)
+    {
+        if ((Local_Key != Copy_Key) && (KVS_Index[Local_Key] != 0))
+        {
+            Local_Size = KVS_RECORD_SIZE(*((const u16 *)(Local_Source + KVS_Index[Local_Key] + 2U)));
+            if (FPEC_ProgramHalfWords(Local_Destination + Local_Offset, (const u16 *)(Local_Source + KVS_Index[Local_Key]), Local_Size / 2U) != FPEC_STATUS_OK)
+            {
+                return E_NOT_OK;
+            }
+            Local_Offset += Local_Size;
+        }
+    }
+
+    /**< 3. The new record (a deleted key is simply not copied) */
+    if (Copy_Length != 0)
+    {
+        Local_HalfWords = KVS_BuildRecord(Copy_Key, Copy_pValue, Copy_Length);
+        if (FPEC_ProgramHalfWords(Local_Destination + Local_Offset, KVS_RecordBuffer, Local_HalfWords) != FPEC_STATUS_OK)
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    /**< 4. Commit: from now on Init picks the target (newer sequence) */
+    if (KVS_WriteHeader(Local_Target, KVS_PAGE_VALID, KVS_Sequence + 1U) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+
+    KVS_ActivePage = Local_Target;
+    KVS_Sequence++;
+    KVS_Scan();
+
+    /**< 5. Retire the source; a reset before this only leaves a stale page for Init to erase */
+    return KVS_ErasePage((u8)((Local_Source - KVS_FLASH_ADDRESS) / FPEC_PAGE_SIZE));
+}
+
+static u16 KVS_BuildRecord(u16 Copy_Key, const u8 *Copy_pValue, u16 Copy_Length)
+{
+    u8 *Local_pBytes = (u8 *)KVS_RecordBuffer;
+    u16 Local_HalfWords = (u16)(KVS_RECORD_SIZE(Copy_Length) / 2U);
+    u16 Local_Index;
+    u16 Local_Crc;
+
+    KVS_RecordBuffer[0] = Copy_Key;
+    KVS_RecordBuffer[1] = Copy_Length;
+    for (Local_Index = 0; Local_Index < Copy_Length; Local_Index++)
+    {
+        Local_pBytes[4U + Local_Index] = Copy_pValue[Local_Index];
+    }
+    if (Copy_Length & 1U)
+    {
+        /**< Padding stays erased */
+        Local_pBytes[4U + Copy_Length] = 0xFF;
+    }
+
+    Local_Crc = KVS_Crc16(KVS_CRC_INIT, Local_pBytes, 4U + (u32)Copy_Length);
+    KVS_RecordBuffer[Local_HalfWords - 1U] = Local_Crc;
+
+    return Local_HalfWords;
+}
+
+static void KVS_Scan(void)
+{
+    u32 Local_Page = KVS_PAGE_ADDRESS(KVS_ActivePage);
+    u32 Local_Offset = KVS_HEADER_SIZE;
+    const u16 *Local_pRecord;
+    u16 Local_Key;
+    u16 Local_Length;
+    u32 Local_Size;
+
+    for (Local_Key = 0; Local_Key < KVS_MAX_KEYS; Local_Key++)
+    {
+        KVS_Index[Local_Key] = 0;
+    }
+
+    while ((Local_Offset + KVS_RECORD_OVERHEAD) <= FPEC_PAGE_SIZE)
+    {
+        Local_pRecord = (const u16 *)(Local_Page + Local_Offset);
+        Local_Key = Local_pRecord[0];
+        Local_Length = Local_pRecord[1];
+
+        if (Local_Key == KVS_KEY_ERASED)
+        {
+            /**< End of the log */
+            KVS_FreeOffset = Local_Offset;
+            return;
+        }
+
+        Local_Size = KVS_RECORD_SIZE(Local_Length);
+        if ((Local_Length > KVS_MAX_VALUE_SIZE) || ((Local_Offset + Local_Size) > FPEC_PAGE_SIZE) ||
+            (KVS_Crc16(KVS_CRC_INIT, (const u8 *)Local_pRecord, 4U + (u32)Local_Length) != Local_pRecord[(Local_Size / 2U) - 1U]))
+        {
+            /**< Torn record: the log cannot be trusted past it, so the page takes no more appends */
+            break;
+        }
+
+        if (Local_Key < KVS_MAX_KEYS)
+        {
+            KVS_Index[Local_Key] = (Local_Length != 0) ? (u16)Local_Offset : 0;
+        }
+        Local_Offset += Local_Size;
+    }
+
+    KVS_FreeOffset = FPEC_PAGE_SIZE;
+}
+
+static Std_ReturnType KVS_ErasePage(u8 Copy_Page)
+{
+    u32 Local_Address;
+
+    for (Local_Address = KVS_PAGE_ADDRESS(Copy_Page); Local_Address < KVS_PAGE_ADDRESS(Copy_Page + 1U); Local_Address += 4U)
+    {
+        if (*((volatile u32 *)Local_Address) != 0xFFFFFFFFUL)
+        {
+            return (FPEC_ErasePage(KVS_PAGE_ADDRESS(Copy_Page)) == FPEC_STATUS_OK) ? E_OK : E_NOT_OK;
+        }
+    }
+
+    /**< Already blank: save an erase cycle */
+    return E_OK;
+}
+
+static Std_ReturnType KVS_WriteHeader(u8 Copy_Page, u16 Copy_Status, u32 Copy_Sequence)
+{
+    u16 Local_Header[KVS_HEADER_SIZE / 2U];
+
+    Local_Header[0] = Copy_Status;
+    Local_Header[1] = 0xFFFFU;
+    Local_Header[2] = (u16)Copy_Sequence;
+    Local_Header[3] = (u16)(Copy_Sequence >> 16);
+
+    /**< Re-programming an existing header only changes the status half-word; the rest already matches */
+    return (FPEC_ProgramHalfWords(KVS_PAGE_ADDRESS(Copy_Page), Local_Header, KVS_HEADER_SIZE / 2U) == FPEC_STATUS_OK) ? E_OK : E_NOT_OK;
+}
+
+static u16 KVS_Crc16(u16 Copy_Crc, const u8 *Copy_pData, u32 Copy_Length)
+{
+    u8 Local_Bit;
+
+    while (Copy_Length-- != 0)
+    {
+        Copy_Crc ^= (u16)((u16)*Copy_pData++ << 8);
+        for (Local_Bit = 0; Local_Bit < 8; Local_Bit++)
+        {
+            Copy_Crc = (Copy_Crc & 0x8000U) ? (u16)((Copy_Crc << 1) ^ KVS_CRC_POLY) : (u16)(Copy_Crc << 1);
+        }
+    }
+
+    return Copy_Crc;
+}
+
+/**
+ * @} (End of PrivateFunctions)
+ */
@@ -0,0 +1,37 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SWTMR_config.h             *****************/
+/****************************************************************/
+#ifndef SWTMR_CONFIG_H_
+#define SWTMR_CONFIG_H_
+
+/**
+ * @brief Duration of one software timer tick in microseconds.
+ */
+#define SWTMR_TICK_US           1000UL
+
+/**
+ * @brief Selects what drives SWTMR_ProcessTick.
+ *
+ * @param SWTMR_TICK_SOURCE_STK The service owns the SysTick in periodic mode.
+ * @param SWTMR_TICK_SOURCE_EXTERNAL The application calls SWTMR_ProcessTick itself.
+ */
+#define SWTMR_TICK_SOURCE       SWTMR_TICK_SOURCE_STK
+
+/**
+ * @brief Number of levels in the timing wheel.
+ *
+ * Each level has 2^SWTMR_WHEEL_BITS slots. The longest delay that can be programmed is
+ * 2^(SWTMR_WHEEL_LEVELS * SWTMR_WHEEL_BITS) - 1 ticks (about 4.6 hours with 4 levels,
+ * 6 bits and a 1 ms tick).
+ */
+#define SWTMR_WHEEL_LEVELS      4
+
+/**
+ * @brief Number of index bits per wheel level (64 slots per level by default).
+ */
+#define SWTMR_WHEEL_BITS        6
+
+#endif /**< SWTMR_CONFIG_H_ */
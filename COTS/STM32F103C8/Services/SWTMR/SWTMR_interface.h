@@ -0,0 +1,170 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SWTMR_interface.h          *****************/
+/****************************************************************/
+#ifndef SWTMR_INTERFACE_H_
+#define SWTMR_INTERFACE_H_
+
+/**
+ * @addtogroup SWTMR SWTMR_Configuration
+ * @{
+ */
+
+/**
+ * @brief Typedef for software timer callback functions.
+ *
+ * The callback receives the context pointer registered with SWTMR_Create, so one
+ * function can serve many timers (e.g. one timeout handler per UART channel).
+ *
+ * @note Callbacks run in the context that calls SWTMR_ProcessTick (the SysTick ISR
+ *       by default), so they must be short and must not block. The tick processing
+ *       runs from SRAM; a callback that must also run while the flash is erased or
+ *       programmed has to be declared RAMFUNC, with everything it calls.
+ */
+typedef void (*SWTMR_Callback_t)(void *Copy_pvContext);
+
+/**
+ * @brief A software timer object.
+ *
+ * Timers are allocated by the user (statically or inside a driver's own state) and
+ * linked directly into the timing wheel, so the service needs no pool and inserting
+ * or cancelling a timer is O(1) regardless of how many timers are running.
+ *
+ * @note The members are managed by the service; only access them through the API.
+ */
+typedef struct SWTMR_Timer_t {
+    struct SWTMR_Timer_t *pNext;    /**< Next timer in the same wheel slot. */
+    struct SWTMR_Timer_t **ppPrev;  /**< Link that points to this timer, NULL when the timer is not running. */
+    u32 Expiry;                     /**< Absolute tick at which the timer expires. */
+    u32 Period;                     /**< Reload period in ticks, 0 for one-shot timers. */
+    SWTMR_Callback_t pfCallback;    /**< Function called on expiry. */
+    void *pvContext;                /**< User context handed to the callback. */
+} SWTMR_Timer_t;
+
+/**
+ * @} (End of SWTMR_Configuration)
+ */
+
+/**
+ * @addtogroup PublicFunctions
+ * @{
+ */
+
+/**
+ * @brief Initialize the software timer service.
+ *
+ * This function clears the timing wheel and, when SWTMR_TICK_SOURCE is SWTMR_TICK_SOURCE_STK,
+ * starts the SysTick in periodic mode with a period of SWTMR_TICK_US microseconds.
+ *
+ * @note With SWTMR_TICK_SOURCE_EXTERNAL the application must call SWTMR_ProcessTick once
+ *       every SWTMR_TICK_US microseconds (e.g. from a TIM update interrupt or an OS task).
+ *
+ * @return
+ *     - E_OK if the service was initialized.
+ *     - E_NOT_OK if the tick source could not be configured.
+ */
+Std_ReturnType SWTMR_Init(void);
+
+/**
+ * @brief Bind a callback and its context to a timer object.
+ *
+ * @param[out] Copy_pTimer Pointer to the timer object to initialize.
+ * @param[in] Copy_pfCallback Function called when the timer expires.
+ * @param[in] Copy_pvContext Context pointer handed to the callback (may be NULL).
+ *
+ * @note A running timer is stopped first. The object must start zeroed (a static, or a
+ *       cleared variable) before its first SWTMR_Create.
+ *
+ * @return
+ *     - E_OK if the timer was initialized.
+ *     - E_NOT_OK if a NULL timer or callback is provided.
+ */
+Std_ReturnType SWTMR_Create(SWTMR_Timer_t *Copy_pTimer, SWTMR_Callback_t Copy_pfCallback, void *Copy_pvContext);
+
+/**
+ * @brief Start (or restart) a timer that expires once.
+ *
+ * @param[in,out] Copy_pTimer Pointer to a timer created with SWTMR_Create.
+ * @param[in] Copy_Ticks Delay in ticks, from 1 to SWTMR_MAX_TICKS.
+ *
+ * @note The callback runs after at least Copy_Ticks full tick periods.
+ * @note Starting a running timer restarts it with the new delay.
+ *
+ * @return
+ *     - E_OK if the timer was started.
+ *     - E_NOT_OK if the timer is NULL or the delay is out of range.
+ */
+Std_ReturnType SWTMR_StartOneShot(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks);
+
+/**
+ * @brief Start (or restart) a timer that expires every Copy_Ticks ticks.
+ *
+ * @param[in,out] Copy_pTimer Pointer to a timer created with SWTMR_Create.
+ * @param[in] Copy_Ticks Period in ticks, from 1 to SWTMR_MAX_TICKS.
+ *
+ * @note The next expiry is computed from the previous expiry, not from the time the callback ran,
+ *       so a periodic timer does not drift.
+ *
+ * @return
+ *     - E_OK if the timer was started.
+ *     - E_NOT_OK if the timer is NULL or the period is out of range.
+ */
+Std_ReturnType SWTMR_StartPeriodic(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks);
+
+/**
+ * @brief Stop a running timer.
+ *
+ * @param[in,out] Copy_pTimer Pointer to the timer to stop.
+ *
+ * @note Stopping a timer that is not running has no effect. This function may be called from
+ *       the timer's own callback to end a periodic timer.
+ *
+ * @return
+ *     - E_OK if the timer is stopped.
+ *     - E_NOT_OK if a NULL timer is provided.
+ */
+Std_ReturnType SWTMR_Stop(SWTMR_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Check whether a timer is running.
+ *
+ * @param[in] Copy_pTimer Pointer to the timer.
+ *
+ * @return 1 if the timer is running, 0 otherwise.
+ */
+u8 SWTMR_IsActive(const SWTMR_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Convert a duration in milliseconds to software timer ticks.
+ *
+ * @param[in] Copy_Milliseconds The duration to convert.
+ *
+ * @return The number of ticks, rounded up so the delay is never shorter than requested.
+ *         Durations longer than SWTMR_MAX_TICKS give SWTMR_MAX_TICKS + 1, which the start functions reject.
+ */
+u32 SWTMR_MsToTicks(u32 Copy_Milliseconds);
+
+/**
+ * @brief Get the number of ticks processed since SWTMR_Init.
+ *
+ * @return The current tick count (wraps around after 2^32 ticks).
+ */
+u32 SWTMR_GetTickCount(void);
+
+/**
+ * @brief Advance the timing wheel by one tick and run the expired callbacks.
+ *
+ * This function is registered as the SysTick callback when SWTMR_TICK_SOURCE is
+ * SWTMR_TICK_SOURCE_STK. Otherwise it must be called from the selected tick source.
+ *
+ * @return None.
+ */
+void SWTMR_ProcessTick(void);
+
+/**
+ * @} (End of PublicFunctions)
+ */
+
+#endif /**< SWTMR_INTERFACE_H_ */
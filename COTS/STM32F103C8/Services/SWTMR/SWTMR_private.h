@@ -0,0 +1,86 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SWTMR_private.h            *****************/
+/****************************************************************/
+#ifndef SWTMR_PRIVATE_H_
+#define SWTMR_PRIVATE_H_
+
+/**
+ * @brief Options for SWTMR_TICK_SOURCE.
+ */
+#define SWTMR_TICK_SOURCE_STK           0
+#define SWTMR_TICK_SOURCE_EXTERNAL      1
+
+#if (SWTMR_TICK_SOURCE != SWTMR_TICK_SOURCE_STK) && (SWTMR_TICK_SOURCE != SWTMR_TICK_SOURCE_EXTERNAL)
+#error "SWTMR_TICK_SOURCE must be SWTMR_TICK_SOURCE_STK or SWTMR_TICK_SOURCE_EXTERNAL"
+#endif
+
+#if (SWTMR_TICK_US == 0) || (SWTMR_TICK_US > 4000000UL)
+#error "SWTMR_TICK_US must be between 1 and 4000000"
+#endif
+
+#if (SWTMR_WHEEL_LEVELS * SWTMR_WHEEL_BITS) > 31
+#error "The timing wheel must span less than 2^31 ticks"
+#endif
+
+/**
+ * @brief Timing wheel geometry.
+ */
+#define SWTMR_WHEEL_SIZE        (1UL << SWTMR_WHEEL_BITS)
+#define SWTMR_WHEEL_MASK        (SWTMR_WHEEL_SIZE - 1UL)
+
+/**
+ * @brief Longest delay or period accepted by the start functions, in ticks.
+ */
+#define SWTMR_MAX_TICKS         ((1UL << (SWTMR_WHEEL_LEVELS * SWTMR_WHEEL_BITS)) - 1UL)
+
+/**
+ * @brief Slot index of an expiry tick at a given wheel level.
+ */
+#define SWTMR_SLOT_INDEX(TICK, LEVEL)   (((TICK) >> ((LEVEL) * SWTMR_WHEEL_BITS)) & SWTMR_WHEEL_MASK)
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+/**
+ * @brief Link a timer into the wheel slot matching its expiry.
+ *
+ * @param[in,out] Copy_pTimer The timer to insert; its Expiry must be set.
+ *
+ * @note Must be called with interrupts disabled.
+ */
+static void SWTMR_Insert(SWTMR_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Unlink a running timer from whatever list holds it.
+ *
+ * @param[in,out] Copy_pTimer The timer to remove.
+ *
+ * @note Must be called with interrupts disabled.
+ */
+static void SWTMR_Unlink(SWTMR_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Re-insert every timer of one slot into the lower levels.
+ *
+ * @param[in] Copy_Level The wheel level to cascade (1 or higher).
+ * @param[in] Copy_Index The slot index within that level.
+ *
+ * @return The slot index, so a zero result tells the caller to cascade the next level.
+ */
+static u32 SWTMR_Cascade(u8 Copy_Level, u32 Copy_Index);
+
+/**
+ * @brief Common body of SWTMR_StartOneShot and SWTMR_StartPeriodic.
+ */
+static Std_ReturnType SWTMR_Start(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks, u32 Copy_Period);
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+
+#endif /**< SWTMR_PRIVATE_H_ */
@@ -0,0 +1,318 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SWTMR_program.c            *****************/
+/****************************************************************/
+
+/*****************************< LIB *****************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/*****************************< MCAL *****************************/
+#include "STK_interface.h"
+#include "SCB_interface.h"
+/*****************************< SERVICES *****************************/
+#include "SWTMR_interface.h"
+#include "SWTMR_config.h"
+#include "SWTMR_private.h"
+/*****************************< Global Variable Section *****************************/
+/**
+ * @brief The timing wheel.
+ *
+ * Level 0 holds timers expiring within the next SWTMR_WHEEL_SIZE ticks, one slot per tick.
+ * Every higher level is SWTMR_WHEEL_SIZE times coarser; its slots are cascaded (re-inserted
+ * into the lower levels) each time the level below wraps around.
+ */
+static SWTMR_Timer_t *SWTMR_Wheel[SWTMR_WHEEL_LEVELS][SWTMR_WHEEL_SIZE];
+
+/**
+ * @brief The next tick to be processed.
+ */
+static volatile u32 SWTMR_CurrentTick = 0;
+/****************************************< FUNCTIONS IMPLEMENTATION ****************************************/
+/**
+ * @addtogroup PublicFunctions
+ * @{
+ */
+
+Std_ReturnType SWTMR_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_OK;
+    u8 Local_Level;
+    u32 Local_Index;
+
+    /**< Empty every slot of the wheel */
+    for (Local_Level = 0; Local_Level < SWTMR_WHEEL_LEVELS; Local_Level++)
+    {
+        for (Local_Index = 0; Local_Index < SWTMR_WHEEL_SIZE; Local_Index++)
+        {
+            SWTMR_Wheel[Local_Level][Local_Index] = NULL;
+        }
+    }
+
+    SWTMR_CurrentTick = 0;
+
+#if SWTMR_TICK_SOURCE == SWTMR_TICK_SOURCE_STK
+    /**< Let the SysTick drive the wheel */
+    MCAL_STK_vInit();
+    Local_FunctionStatus = MCAL_STK_SetIntervalPeriodic(SWTMR_TICK_US, SWTMR_ProcessTick);
+#endif
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType SWTMR_Create(SWTMR_Timer_t *Copy_pTimer, SWTMR_Callback_t Copy_pfCallback, void *Copy_pvContext)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if ((Copy_pTimer != NULL) && (Copy_pfCallback != NULL))
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        /**< Re-creating a running timer (a driver initialized again) takes it out of the wheel first */
+        if (Copy_pTimer->ppPrev != NULL)
+        {
+            SWTMR_Unlink(Copy_pTimer);
+        }
+
+        Copy_pTimer->pNext = NULL;
+        Copy_pTimer->ppPrev = NULL;
+        Copy_pTimer->Expiry = 0;
+        Copy_pTimer->Period = 0;
+        Copy_pTimer->pfCallback = Copy_pfCallback;
+        Copy_pTimer->pvContext = Copy_pvContext;
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType SWTMR_StartOneShot(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks)
+{
+    return SWTMR_Start(Copy_pTimer, Copy_Ticks, 0);
+}
+
+Std_ReturnType SWTMR_StartPeriodic(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks)
+{
+    return SWTMR_Start(Copy_pTimer, Copy_Ticks, Copy_Ticks);
+}
+
+Std_ReturnType SWTMR_Stop(SWTMR_Timer_t *Copy_pTimer)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if (Copy_pTimer != NULL)
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        if (Copy_pTimer->ppPrev != NULL)
+        {
+            SWTMR_Unlink(Copy_pTimer);
+        }
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+u8 SWTMR_IsActive(const SWTMR_Timer_t *Copy_pTimer)
+{
+    return ((Copy_pTimer != NULL) && (Copy_pTimer->ppPrev != NULL)) ? 1 : 0;
+}
+
+u32 SWTMR_MsToTicks(u32 Copy_Milliseconds)
+{
+    u32 Local_Ticks;
+
+    /**< Split the duration so the conversion to microseconds never overflows:
+         every SWTMR_TICK_US milliseconds are exactly 1000 ticks */
+    Local_Ticks = Copy_Milliseconds / SWTMR_TICK_US;
+
+    if (Local_Ticks > (SWTMR_MAX_TICKS / 1000UL))
+    {
+        return SWTMR_MAX_TICKS + 1UL;
+    }
+
+    Local_Ticks = (Local_Ticks * 1000UL) + ((((Copy_Milliseconds % SWTMR_TICK_US) * 1000UL) + SWTMR_TICK_US - 1UL) / SWTMR_TICK_US);
+
+    return (Local_Ticks > SWTMR_MAX_TICKS) ? (SWTMR_MAX_TICKS + 1UL) : Local_Ticks;
+}
+
+u32 SWTMR_GetTickCount(void)
+{
+    return SWTMR_CurrentTick;
+}
+
+RAMFUNC void SWTMR_ProcessTick(void)
+{
+    SWTMR_Timer_t *Local_pExpired;
+    SWTMR_Timer_t *Local_pTimer;
+    u32 Local_PrimaskState;
+    u32 Local_Index;
+    u8 Local_Level;
+
+    Local_PrimaskState = SCB_EnterCriticalSection();
+
+    Local_Index = SWTMR_CurrentTick & SWTMR_WHEEL_MASK;
+
+    /**< When level 0 wraps, pull the next slot of each coarser level down, stopping at the first level that did not wrap */
+    if (Local_Index == 0)
+    {
+        for (Local_Level = 1; Local_Level < SWTMR_WHEEL_LEVELS; Local_Level++)
+        {
+            if (SWTMR_Cascade(Local_Level, SWTMR_SLOT_INDEX(SWTMR_CurrentTick, Local_Level)) != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    /**< Move the expired slot to a local list so callbacks can start timers in the same slot safely */
+    Local_pExpired = SWTMR_Wheel[0][Local_Index];
+    SWTMR_Wheel[0][Local_Index] = NULL;
+    if (Local_pExpired != NULL)
+    {
+        Local_pExpired->ppPrev = &Local_pExpired;
+    }
+
+    SWTMR_CurrentTick++;
+
+    SCB_ExitCriticalSection(Local_PrimaskState);
+
+    /**< Run the expired timers one at a time; a timer stopped meanwhile simply leaves the local list */
+    while (1)
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        Local_pTimer = Local_pExpired;
+        if (Local_pTimer == NULL)
+        {
+            SCB_ExitCriticalSection(Local_PrimaskState);
+            break;
+        }
+
+        SWTMR_Unlink(Local_pTimer);
+
+        /**< Re-arm periodic timers before the callback so the callback may stop them */
+        if (Local_pTimer->Period != 0)
+        {
+            Local_pTimer->Expiry += Local_pTimer->Period;
+            SWTMR_Insert(Local_pTimer);
+        }
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+
+        Local_pTimer->pfCallback(Local_pTimer->pvContext);
+    }
+}
+
+/**
+ * @} (End of PublicFunctions)
+ */
+
+/**
+ * @addtogroup PrivateFunctions
+ * @{
+ */
+
+static Std_ReturnType SWTMR_Start(SWTMR_Timer_t *Copy_pTimer, u32 Copy_Ticks, u32 Copy_Period)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PrimaskState;
+
+    if ((Copy_pTimer != NULL) && (Copy_pTimer->pfCallback != NULL) && (Copy_Ticks != 0) && (Copy_Ticks <= SWTMR_MAX_TICKS))
+    {
+        Local_PrimaskState = SCB_EnterCriticalSection();
+
+        /**< Restart the timer if it is already running */
+        if (Copy_pTimer->ppPrev != NULL)
+        {
+            SWTMR_Unlink(Copy_pTimer);
+        }
+
+        Copy_pTimer->Expiry = SWTMR_CurrentTick + Copy_Ticks;
+        Copy_pTimer->Period = Copy_Period;
+        SWTMR_Insert(Copy_pTimer);
+
+        SCB_ExitCriticalSection(Local_PrimaskState);
+
+        Local_FunctionStatus = E_OK;
+    }
+
+    return Local_FunctionStatus;
+}
+
+RAMFUNC static void SWTMR_Insert(SWTMR_Timer_t *Copy_pTimer)
+{
+    u32 Local_Delta = Copy_pTimer->Expiry - SWTMR_CurrentTick;
+    SWTMR_Timer_t **Local_ppSlot;
+    u8 Local_Level = 0;
+
+    if ((s32)Local_Delta < 0)
+    {
+        /**< Already late: expire on the next processed tick */
+        Local_ppSlot = &SWTMR_Wheel[0][SWTMR_CurrentTick & SWTMR_WHEEL_MASK];
+    }
+    else
+    {
+        /**< Pick the finest level whose span covers the remaining delay */
+        while ((Local_Level < (SWTMR_WHEEL_LEVELS - 1)) && (Local_Delta >= (SWTMR_WHEEL_SIZE << (Local_Level * SWTMR_WHEEL_BITS))))
+        {
+            Local_Level++;
+        }
+
+        Local_ppSlot = &SWTMR_Wheel[Local_Level][SWTMR_SLOT_INDEX(Copy_pTimer->Expiry, Local_Level)];
+    }
+
+    /**< Link at the head of the slot */
+    Copy_pTimer->pNext = *Local_ppSlot;
+    if (Copy_pTimer->pNext != NULL)
+    {
+        Copy_pTimer->pNext->ppPrev = &Copy_pTimer->pNext;
+    }
+    *Local_ppSlot = Copy_pTimer;
+    Copy_pTimer->ppPrev = Local_ppSlot;
+}
+
+RAMFUNC static void SWTMR_Unlink(SWTMR_Timer_t *Copy_pTimer)
+{
+    *Copy_pTimer->ppPrev = Copy_pTimer->pNext;
+    if (Copy_pTimer->pNext != NULL)
+    {
+        Copy_pTimer->pNext->ppPrev = Copy_pTimer->ppPrev;
+    }
+
+    Copy_pTimer->pNext = NULL;
+    Copy_pTimer->ppPrev = NULL;
+}
+
+RAMFUNC static u32 SWTMR_Cascade(u8 Copy_Level, u32 Copy_Index)
+{
+    SWTMR_Timer_t *Local_pTimer = SWTMR_Wheel[Copy_Level][Copy_Index];
+    SWTMR_Timer_t *Local_pNext;
+
+    SWTMR_Wheel[Copy_Level][Copy_Index] = NULL;
+
+    /**< Every timer of the slot now falls within the span of a finer level */
+    while (Local_pTimer != NULL)
+    {
+        Local_pNext = Local_pTimer->pNext;
+        SWTMR_Insert(Local_pTimer);
+        Local_pTimer = Local_pNext;
+    }
+
+    return Copy_Index;
+}
+
+/**
+ * @} (End of PrivateFunctions)
+ */
+/****************************************< End of FUNCTIONS IMPLEMENTATION ****************************************/
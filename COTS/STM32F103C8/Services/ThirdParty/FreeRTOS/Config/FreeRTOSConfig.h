@@ -39,10 +39,18 @@
  * See http://www.freertos.org/a00110.html
  *----------------------------------------------------------*/
 
+/* The core clock is read from the RCC clock tree (MCAL_RCC_GetHclk) instead of
+being hardcoded, so the tick rate is right whatever RCC_config.h selects.  The
+declaration is kept away from the assemblers that include this file. */
+#if defined( __ICCARM__ ) || defined( __CC_ARM ) || defined( __GNUC__ )
+	#include <stdint.h>
+	extern uint32_t MCAL_RCC_GetHclk( void );
+#endif
+
 #define configUSE_PREEMPTION		1
 #define configUSE_IDLE_HOOK			0
 #define configUSE_TICK_HOOK			0
-#define configCPU_CLOCK_HZ			( ( unsigned long ) 72000000 )
+#define configCPU_CLOCK_HZ			( ( unsigned long ) MCAL_RCC_GetHclk() )
 #define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES		( 5 )
 #define configMINIMAL_STACK_SIZE	( ( unsigned short ) 120 )
@@ -0,0 +1,503 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : I2C_slave_test.c           *****************/
+/****************************************************************/
+
+/**
+ * Host test of the I2C slave register map, driven by a simulated master.
+ *
+ * The I2C1 registers are plain memory mapped at their STM32F103 address, and the RCC, GPIO, DMA,
+ * DWT and SCB drivers are stubbed. The simulated master plays the events the hardware would
+ * raise for each bus transfer (ADDR with or without TRA, RXNE per byte received, TXE/BTF per byte
+ * acknowledged, STOPF, AF on the NACK of the last byte read) and calls the interrupt handlers.
+ * Fixed sequences check the documented behaviour; random transfers are then checked against a
+ * model of the register map.
+ *
+ * Usage: I2C_slave_test [transfers] [seed]
+ */
+
+/**< The driver is built into the test so its state can be inspected between events */
+#include "../../MCAL/I2C/I2C_program.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/*****************************< Stubs *****************************/
+#define SIM_MAP_BASE            (I2C1_BASE_ADDRESS & ~0xFFFUL)
+#define SIM_MAP_SIZE            0x1000UL
+
+static s32 Sim_ClockUsers = 0;          /**< Acquire minus release of the I2C1 clock */
+static u32 Sim_Cycles = 0;
+
+Std_ReturnType MCAL_RCC_AcquirePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId) {
+    (void)Copy_BusId;
+    (void)Copy_PeripheralId;
+    Sim_ClockUsers++;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_RCC_ReleasePeripheral(u8 Copy_BusId, u8 Copy_PeripheralId) {
+    (void)Copy_BusId;
+    (void)Copy_PeripheralId;
+    Sim_ClockUsers--;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_RCC_RegisterClockNotifier(RCC_ClockNotifier_t Copy_pfNotifier) {
+    (void)Copy_pfNotifier;
+    return E_OK;
+}
+
+u32 MCAL_RCC_GetPclk1(void) {
+    return 8000000UL;
+}
+
+Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinMode) {
+    (void)Copy_PortId;
+    (void)Copy_PinId;
+    (void)Copy_PinMode;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 Copy_PinValue) {
+    (void)Copy_PortId;
+    (void)Copy_PinId;
+    (void)Copy_PinValue;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortId, u8 Copy_PinId, u8 *Copy_PinReturnValue) {
+    (void)Copy_PortId;
+    (void)Copy_PinId;
+    *Copy_PinReturnValue = GPIO_HIGH;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_ConfigureChannel(u8 Copy_Channel, const DMA_ChannelConfig_t *Copy_pConfig, DMA_CallbackFunc_t Copy_pfCallback) {
+    (void)Copy_Channel;
+    (void)Copy_pConfig;
+    (void)Copy_pfCallback;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_Start(u8 Copy_Channel, u32 Copy_PeripheralAddress, const volatile void *Copy_pMemory, u16 Copy_Count) {
+    (void)Copy_Channel;
+    (void)Copy_PeripheralAddress;
+    (void)Copy_pMemory;
+    (void)Copy_Count;
+    return E_OK;
+}
+
+Std_ReturnType MCAL_DMA_Stop(u8 Copy_Channel) {
+    (void)Copy_Channel;
+    return E_OK;
+}
+
+void MCAL_DWT_Init(void) {
+}
+
+/**< Every read advances the clock, so the bounded waits on the register memory end */
+u32 MCAL_DWT_GetCycles(void) {
+    Sim_Cycles += 100U;
+    return Sim_Cycles;
+}
+
+u32 MCAL_DWT_UsToCycles(u32 Copy_Microseconds) {
+    return Copy_Microseconds * 8U;
+}
+
+void MCAL_DWT_DelayUs(u32 Copy_Microseconds) {
+    Sim_Cycles += MCAL_DWT_UsToCycles(Copy_Microseconds);
+}
+
+u32 SCB_EnterCriticalSection(void) {
+    return 0;
+}
+
+void SCB_ExitCriticalSection(u32 Copy_PrimaskState) {
+    (void)Copy_PrimaskState;
+}
+
+/*****************************< Simulated master *****************************/
+static u32 Sim_Random(void) {
+    static u32 Local_State = 0x6D2B79F5UL;
+
+    /**< xorshift32 */
+    Local_State ^= Local_State << 13;
+    Local_State ^= Local_State >> 17;
+    Local_State ^= Local_State << 5;
+    return Local_State;
+}
+
+/**< Raise an event interrupt with the given status; returns the data register afterwards */
+static u8 Sim_Event(u32 Copy_SR1, u32 Copy_SR2, u8 Copy_Data) {
+    I2C1->SR1 = Copy_SR1;
+    I2C1->SR2 = Copy_SR2;
+    I2C1->DR = Copy_Data;
+    I2C1_EV_IRQHandler();
+    return (u8)I2C1->DR;
+}
+
+static void Sim_Error(u32 Copy_SR1) {
+    I2C1->SR1 = Copy_SR1;
+    I2C1_ER_IRQHandler();
+}
+
+/**< Address the slave for writing and send the register number, without a stop */
+static void Sim_WritePointer(u8 Copy_Register) {
+    (void)Sim_Event(I2C_SR1_ADDR, I2C_SR2_BUSY, 0);
+    (void)Sim_Event(I2C_SR1_RXNE, I2C_SR2_BUSY, Copy_Register);
+}
+
+static void Sim_WriteBytes(const u8 *Copy_pData, u8 Copy_Count) {
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++) {
+        (void)Sim_Event(I2C_SR1_RXNE, I2C_SR2_BUSY, Copy_pData[Local_Index]);
+    }
+}
+
+static void Sim_Stop(void) {
+    (void)Sim_Event(I2C_SR1_STOPF, 0, 0);
+}
+
+/**< Address the slave for reading (after a start or a repeated start), read, NACK the last byte and stop */
+static void Sim_Read(u8 *Copy_pData, u8 Copy_Count) {
+    u8 Local_Index;
+
+    Copy_pData[0] = Sim_Event(I2C_SR1_ADDR, I2C_SR2_TRA | I2C_SR2_BUSY, 0);
+    for (Local_Index = 1; Local_Index < Copy_Count; Local_Index++) {
+        Copy_pData[Local_Index] = Sim_Event(I2C_SR1_TXE | I2C_SR1_BTF, I2C_SR2_TRA | I2C_SR2_BUSY, 0);
+    }
+    Sim_Error(I2C_SR1_AF);
+}
+
+/*****************************< Test *****************************/
+static u8 Test_Control[16];             /**< 0x00..0x0F read/write */
+static u8 Test_Status[4];               /**< 0x10..0x13 read-only */
+static u8 Test_Command[8];              /**< 0x20..0x27 write-only */
+static u8 Test_Top[8];                  /**< 0xF8..0xFF read/write, for the pointer wrap */
+
+static const I2C_SlaveRegion_t Test_Regions[] = {
+    { 0x00, sizeof(Test_Control), I2C_SLAVE_ACCESS_READ_WRITE, Test_Control },
+    { 0x10, sizeof(Test_Status),  I2C_SLAVE_ACCESS_READ,       Test_Status  },
+    { 0x20, sizeof(Test_Command), I2C_SLAVE_ACCESS_WRITE,      Test_Command },
+    { 0xF8, sizeof(Test_Top),     I2C_SLAVE_ACCESS_READ_WRITE, Test_Top     },
+};
+
+static u32 Test_Callbacks = 0;
+static u8 Test_CallbackFirst = 0;
+static u8 Test_CallbackCount = 0;
+
+static void Test_WriteCallback(u8 Copy_FirstRegister, u8 Copy_Count) {
+    Test_Callbacks++;
+    Test_CallbackFirst = Copy_FirstRegister;
+    Test_CallbackCount = Copy_Count;
+}
+
+static const I2C_SlaveMap_t Test_Map = { Test_Regions, sizeof(Test_Regions) / sizeof(Test_Regions[0]), Test_WriteCallback };
+
+static u32 Test_Errors = 0;
+
+#define TEST_CHECK(COND, ...)                                               \
+    do {                                                                    \
+        if (!(COND)) {                                                      \
+            Test_Errors++;                                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);                     \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+            if (Test_Errors > 20U) {                                        \
+                exit(1);                                                    \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+/**< Backing memory of a register, or NULL when it is unmapped */
+static u8 *Test_Register(u8 Copy_Register, u8 *Copy_pAccess) {
+    u8 Local_Index;
+
+    for (Local_Index = 0; Local_Index < (sizeof(Test_Regions) / sizeof(Test_Regions[0])); Local_Index++) {
+        const I2C_SlaveRegion_t *Local_pRegion = &Test_Regions[Local_Index];
+
+        if ((Copy_Register >= Local_pRegion->FirstRegister) &&
+            (Copy_Register < (Local_pRegion->FirstRegister + Local_pRegion->Count))) {
+            *Copy_pAccess = Local_pRegion->Access;
+            return &Local_pRegion->pData[Copy_Register - Local_pRegion->FirstRegister];
+        }
+    }
+    *Copy_pAccess = 0;
+    return NULL;
+}
+
+static void Test_Init(void) {
+    I2C_Config_t Local_Config = {0};
+
+    Local_Config.ClockSpeed = 100000UL;
+    Local_Config.SpeedMode = I2C_SPEED_STANDARD;
+    Local_Config.Mode = I2C_Mode_I2C;
+    Local_Config.OwnAddress1 = 0x42;
+    Local_Config.Ack = DISABLE;
+
+    TEST_CHECK(I2C_Init(&Local_Config) == E_OK, "I2C_Init failed");
+    TEST_CHECK(I2C1->OAR1 == (I2C_OAR1_BIT14 | (0x42UL << I2C_OAR1_ADD_SHIFT)), "own address 0x%08X", (unsigned)I2C1->OAR1);
+    TEST_CHECK((I2C1->CR1 & I2C_CR1_ACK) == 0, "ACK set without a slave map");
+    TEST_CHECK(Sim_ClockUsers == 0, "I2C1 clock left on after I2C_Init");
+}
+
+static void Test_StartStop(void) {
+    I2C_SlaveMap_t Local_BadMap = { NULL, 1, NULL };
+
+    TEST_CHECK(I2C_SlaveStart(NULL) == E_NOT_OK, "NULL map accepted");
+    TEST_CHECK(I2C_SlaveStart(&Local_BadMap) == E_NOT_OK, "NULL region table accepted");
+    TEST_CHECK(Sim_ClockUsers == 0, "a refused map acquired the clock");
+
+    TEST_CHECK(I2C_SlaveStart(&Test_Map) == E_OK, "I2C_SlaveStart failed");
+    TEST_CHECK(I2C_SlaveStart(&Test_Map) == E_OK, "I2C_SlaveStart again failed");
+    TEST_CHECK(Sim_ClockUsers == 1, "the clock is acquired %d times by the slave", (int)Sim_ClockUsers);
+    TEST_CHECK(I2C1->CR1 & I2C_CR1_ACK, "ACK not set by I2C_SlaveStart");
+
+    I2C_SlaveStop();
+    I2C_SlaveStop();
+    TEST_CHECK(Sim_ClockUsers == 0, "the clock is still acquired %d times after I2C_SlaveStop", (int)Sim_ClockUsers);
+    TEST_CHECK((I2C1->CR1 & I2C_CR1_ACK) == 0, "ACK left set by I2C_SlaveStop");
+
+    TEST_CHECK(I2C_SlaveStart(&Test_Map) == E_OK, "I2C_SlaveStart failed");
+}
+
+static void Test_Sequences(void) {
+    static const u8 Local_Data[] = { 0x11, 0x22, 0x33, 0x44 };
+    u8 Local_Read[8];
+    u32 Local_Callbacks;
+
+    /**< Write with auto-increment, then a stop */
+    Local_Callbacks = Test_Callbacks;
+    Sim_WritePointer(0x02);
+    TEST_CHECK(I2C1->CR2 & I2C_CR2_ITBUFEN, "ITBUFEN not set for a slave write");
+    Sim_WriteBytes(Local_Data, 4);
+    TEST_CHECK(Test_Callbacks == Local_Callbacks, "callback before the end of the write");
+    Sim_Stop();
+    TEST_CHECK(memcmp(&Test_Control[2], Local_Data, 4) == 0, "write with auto-increment");
+    TEST_CHECK((Test_Callbacks == Local_Callbacks + 1U) && (Test_CallbackFirst == 0x02) && (Test_CallbackCount == 4),
+               "write callback %u (0x%02X, %u)", Test_Callbacks - Local_Callbacks, Test_CallbackFirst, Test_CallbackCount);
+    TEST_CHECK((I2C1->CR2 & I2C_CR2_ITBUFEN) == 0, "ITBUFEN left set after a stop");
+
+    /**< A read after a stop continues from the pointer */
+    Sim_Read(Local_Read, 2);
+    TEST_CHECK((Local_Read[0] == 0x00) && (Local_Read[1] == 0x00), "read after a stop: %02X %02X", Local_Read[0], Local_Read[1]);
+    TEST_CHECK(I2C_SlaveState == I2C_SLAVE_IDLE, "AF did not end the slave read");
+
+    /**< Register read: pointer write, repeated start, read; no callback for a pointer-only write */
+    Local_Callbacks = Test_Callbacks;
+    Sim_WritePointer(0x01);
+    Sim_Read(Local_Read, 5);
+    TEST_CHECK((Local_Read[0] == 0x00) && (memcmp(&Local_Read[1], Local_Data, 4) == 0), "register read");
+    TEST_CHECK(Test_Callbacks == Local_Callbacks, "callback for a pointer-only write");
+    TEST_CHECK((I2C1->CR2 & I2C_CR2_ITBUFEN) == 0, "ITBUFEN set during a slave read");
+
+    /**< A repeated start ends a write, and its callback comes before the read */
+    Sim_WritePointer(0x08);
+    Sim_WriteBytes(Local_Data, 1);
+    Sim_WritePointer(0x09);
+    TEST_CHECK((Test_Callbacks == Local_Callbacks + 1U) && (Test_CallbackFirst == 0x08) && (Test_CallbackCount == 1),
+               "repeated start did not end the write");
+    Sim_WriteBytes(&Local_Data[1], 1);
+    Sim_Read(Local_Read, 1);
+    TEST_CHECK((Test_Callbacks == Local_Callbacks + 2U) && (Test_CallbackFirst == 0x09) && (Test_CallbackCount == 1),
+               "repeated start into a read did not end the write");
+    TEST_CHECK((Test_Control[8] == 0x11) && (Test_Control[9] == 0x22) && (Local_Read[0] == Test_Control[10]), "write, write, read");
+
+    /**< The last byte and the stop in one interrupt */
+    Sim_WritePointer(0x0C);
+    (void)Sim_Event(I2C_SR1_RXNE | I2C_SR1_STOPF, I2C_SR2_BUSY, 0x5A);
+    TEST_CHECK((Test_Control[12] == 0x5A) && (Test_CallbackFirst == 0x0C) && (Test_CallbackCount == 1), "RXNE and STOPF together");
+
+    /**< Read-only and unmapped registers drop writes; unmapped and write-only registers read 0xFF */
+    memset(Test_Status, 0xA5, sizeof(Test_Status));
+    Sim_WritePointer(0x0F);
+    Sim_WriteBytes(Local_Data, 4);
+    Sim_Stop();
+    TEST_CHECK((Test_Control[15] == 0x11) && (Test_Status[0] == 0xA5) && (Test_Status[1] == 0xA5) && (Test_Status[2] == 0xA5),
+               "write across a read-only region");
+    TEST_CHECK((Test_CallbackFirst == 0x0F) && (Test_CallbackCount == 4), "dropped bytes not counted in the callback");
+    Sim_WritePointer(0x13);
+    Sim_Read(Local_Read, 3);
+    TEST_CHECK((Local_Read[0] == 0xA5) && (Local_Read[1] == I2C_SLAVE_FILL_BYTE) && (Local_Read[2] == I2C_SLAVE_FILL_BYTE),
+               "read across unmapped registers: %02X %02X %02X", Local_Read[0], Local_Read[1], Local_Read[2]);
+    Sim_WritePointer(0x20);
+    Sim_WriteBytes(Local_Data, 2);
+    Sim_Read(Local_Read, 2);
+    TEST_CHECK((Test_Command[0] == 0x11) && (Test_Command[1] == 0x22), "write-only registers not written");
+    TEST_CHECK((Local_Read[0] == I2C_SLAVE_FILL_BYTE) && (Local_Read[1] == I2C_SLAVE_FILL_BYTE), "write-only registers readable");
+
+    /**< The pointer wraps at 255 */
+    Sim_WritePointer(0xFE);
+    Sim_WriteBytes(Local_Data, 3);
+    Sim_Stop();
+    TEST_CHECK((Test_Top[6] == 0x11) && (Test_Top[7] == 0x22) && (Test_Control[0] == 0x33), "write across the wrap");
+    Sim_WritePointer(0xFF);
+    Sim_Read(Local_Read, 2);
+    TEST_CHECK((Local_Read[0] == 0x22) && (Local_Read[1] == 0x33), "read across the wrap");
+
+    /**< A bus error ends the write with the bytes received so far; later bytes are ignored */
+    Local_Callbacks = Test_Callbacks;
+    Sim_WritePointer(0x04);
+    Sim_WriteBytes(&Local_Data[2], 2);
+    Sim_Error(I2C_SR1_BERR);
+    TEST_CHECK((Test_Callbacks == Local_Callbacks + 1U) && (Test_CallbackFirst == 0x04) && (Test_CallbackCount == 2),
+               "bus error during a write");
+    (void)Sim_Event(I2C_SR1_RXNE, I2C_SR2_BUSY, 0xEE);
+    TEST_CHECK((Test_Control[6] != 0xEE) && (Test_Callbacks == Local_Callbacks + 1U), "byte after a bus error written");
+    Sim_Stop();
+}
+
+/**< A master transaction queued while the slave is addressed waits for its start condition */
+static void Test_AlongsideMaster(void) {
+    static const u8 Local_Data[] = { 0x77, 0x66 };
+    u8 Local_Byte = 0x3C;
+    I2C_Transaction_t Local_Transaction = {0};
+    u8 Local_Read;
+
+    Local_Transaction.Address = 0x50;
+    Local_Transaction.pWriteData = &Local_Byte;
+    Local_Transaction.WriteLength = 1;
+
+    Sim_WritePointer(0x06);
+    TEST_CHECK(I2C_Submit(&Local_Transaction) == E_OK, "I2C_Submit failed");
+    TEST_CHECK(I2C1->CR1 & I2C_CR1_START, "start not requested");
+    Sim_WriteBytes(Local_Data, 2);
+    Sim_Stop();
+    TEST_CHECK((Test_Control[6] == 0x77) && (Test_Control[7] == 0x66), "slave write with a queued master transaction");
+    TEST_CHECK(Local_Transaction.Status == I2C_STATUS_PENDING, "master transaction ended by slave events");
+
+    /**< The start condition makes the interface master: SB, ADDR, TXE, BTF */
+    I2C1->CR1 &= ~I2C_CR1_START;
+    TEST_CHECK(Sim_Event(I2C_SR1_SB, I2C_SR2_MSL | I2C_SR2_BUSY, 0) == (0x50 << 1), "address not sent on SB");
+    (void)Sim_Event(I2C_SR1_ADDR, I2C_SR2_MSL | I2C_SR2_BUSY | I2C_SR2_TRA, 0);
+    TEST_CHECK(Sim_Event(I2C_SR1_TXE, I2C_SR2_MSL | I2C_SR2_BUSY | I2C_SR2_TRA, 0) == 0x3C, "data not sent on TXE");
+    (void)Sim_Event(I2C_SR1_TXE | I2C_SR1_BTF, I2C_SR2_MSL | I2C_SR2_BUSY | I2C_SR2_TRA, 0);
+    TEST_CHECK(Local_Transaction.Status == I2C_STATUS_DONE, "master transaction status %u", Local_Transaction.Status);
+    TEST_CHECK(I2C1->CR1 & I2C_CR1_ACK, "slave ACK not restored after a master transaction");
+    TEST_CHECK(Sim_ClockUsers == 1, "the clock is acquired %d times after the master transaction", (int)Sim_ClockUsers);
+    I2C1->CR1 &= ~I2C_CR1_STOP;
+
+    /**< The slave answers again, from where its pointer was left */
+    Sim_Read(&Local_Read, 1);
+    TEST_CHECK(Local_Read == Test_Control[8], "slave read after a master transaction");
+}
+
+/**< Random transfers against a model of the register map */
+static void Test_Random(u32 Copy_Transfers) {
+    u8 Local_Model[256];
+    u8 Local_Data[40];
+    u8 Local_Read[40];
+    u8 Local_Pointer = 0;
+    u8 Local_Access;
+    u8 *Local_pRegister;
+    u32 Local_Transfer;
+    u32 Local_Callbacks;
+    u16 Local_Register;
+    u8 Local_Count;
+    u8 Local_Index;
+
+    /**< The slave's pointer is unknown here: set it first */
+    Sim_WritePointer(Local_Pointer);
+    Sim_Stop();
+    for (Local_Register = 0; Local_Register < 256U; Local_Register++) {
+        Local_pRegister = Test_Register((u8)Local_Register, &Local_Access);
+        Local_Model[Local_Register] = (Local_pRegister != NULL) ? *Local_pRegister : 0;
+    }
+
+    for (Local_Transfer = 0; Local_Transfer < Copy_Transfers; Local_Transfer++) {
+        u32 Local_Kind = Sim_Random() % 4U;
+
+        Local_Count = (u8)(Sim_Random() % sizeof(Local_Data));
+        if (Local_Kind != 3U) {
+            /**< 0: write and stop, 1: write then repeated start, 2: pointer then read */
+            Local_Pointer = (u8)Sim_Random();
+            Local_Callbacks = Test_Callbacks;
+            Sim_WritePointer(Local_Pointer);
+            if (Local_Kind != 2U) {
+                for (Local_Index = 0; Local_Index < Local_Count; Local_Index++) {
+                    Local_Data[Local_Index] = (u8)Sim_Random();
+                }
+                Sim_WriteBytes(Local_Data, Local_Count);
+                if (Local_Kind == 0U) {
+                    Sim_Stop();
+                } else {
+                    Sim_WritePointer(Local_Pointer);
+                    Sim_Stop();
+                }
+                for (Local_Index = 0; Local_Index < Local_Count; Local_Index++) {
+                    (void)Test_Register((u8)(Local_Pointer + Local_Index), &Local_Access);
+                    if (Local_Access & I2C_SLAVE_ACCESS_WRITE) {
+                        Local_Model[(u8)(Local_Pointer + Local_Index)] = Local_Data[Local_Index];
+                    }
+                }
+                TEST_CHECK((Local_Count == 0) ? (Test_Callbacks == Local_Callbacks) :
+                           ((Test_Callbacks == Local_Callbacks + 1U) && (Test_CallbackFirst == Local_Pointer) && (Test_CallbackCount == Local_Count)),
+                           "transfer %u: write callback", Local_Transfer);
+                if (Local_Kind == 0U) {
+                    Local_Pointer = (u8)(Local_Pointer + Local_Count);
+                }
+                continue;
+            }
+        }
+
+        /**< 2 and 3 (a read from the current pointer after a stop) */
+        if (Local_Count == 0) {
+            Local_Count = 1;
+        }
+        Sim_Read(Local_Read, Local_Count);
+        for (Local_Index = 0; Local_Index < Local_Count; Local_Index++) {
+            u8 Local_Expected;
+
+            (void)Test_Register(Local_Pointer, &Local_Access);
+            Local_Expected = (Local_Access & I2C_SLAVE_ACCESS_READ) ? Local_Model[Local_Pointer] : I2C_SLAVE_FILL_BYTE;
+            TEST_CHECK(Local_Read[Local_Index] == Local_Expected, "transfer %u: register 0x%02X read 0x%02X, expected 0x%02X",
+                       Local_Transfer, Local_Pointer, Local_Read[Local_Index], Local_Expected);
+            Local_Pointer++;
+        }
+    }
+
+    for (Local_Register = 0; Local_Register < 256U; Local_Register++) {
+        Local_pRegister = Test_Register((u8)Local_Register, &Local_Access);
+        if (Local_pRegister != NULL) {
+            TEST_CHECK(*Local_pRegister == Local_Model[Local_Register], "register 0x%02X holds 0x%02X, expected 0x%02X",
+                       Local_Register, *Local_pRegister, Local_Model[Local_Register]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    u32 Local_Transfers = (argc > 1) ? (u32)strtoul(argv[1], NULL, 0) : 100000UL;
+    u32 Local_Seed = (argc > 2) ? (u32)strtoul(argv[2], NULL, 0) : 0;
+    void *Local_pMap;
+
+    while (Local_Seed-- != 0) {
+        (void)Sim_Random();
+    }
+
+    Local_pMap = mmap((void *)(uintptr_t)SIM_MAP_BASE, SIM_MAP_SIZE, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (Local_pMap != (void *)(uintptr_t)SIM_MAP_BASE) {
+        printf("cannot map the I2C1 registers at 0x%08lX\n", (unsigned long)SIM_MAP_BASE);
+        return 2;
+    }
+
+    Test_Init();
+    Test_StartStop();
+    Test_Sequences();
+    Test_AlongsideMaster();
+    Test_Random(Local_Transfers);
+
+    I2C_SlaveStop();
+    TEST_CHECK(Sim_ClockUsers == 0, "the clock is still acquired %d times at the end", (int)Sim_ClockUsers);
+
+    printf("%u random transfers, %u write callbacks, %u errors\n", Local_Transfers, Test_Callbacks, Test_Errors);
+
+    return (Test_Errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,355 @@
+/****************************************************************/
+/******* Author    : Mahmoud Abdelraouf Mahmoud *****************/
+/******* Date      : 19 Oct 2026                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : KVS_test.c                 *****************/
+/****************************************************************/
+
+/**
+ * Host test of the KVS service against a simulated flash.
+ *
+ * The FPEC driver is replaced by a model of the STM32F103 flash: an erase sets a whole page to
+ * 0xFF, a program can only clear bits of an erased half-word (or write 0x0000 over anything), and
+ * every erase is counted per page. The model can cut the power in the middle of any flash
+ * operation: the interrupted half-word is left with only some of its bits programmed, and an
+ * interrupted erase leaves each word of the page either erased or untouched. The test then
+ * "reboots" (clears the service's RAM state and calls KVS_Init) and checks that every key holds
+ * its last committed value, the key being written holding either its old or its new value.
+ *
+ * Usage: KVS_test [writes] [seed]
+ */
+
+/**< The service is built into the test so its RAM state can be cleared on a simulated reset */
+#include "../../Services/KVS/KVS_program.c"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/*****************************< Simulated flash *****************************/
+#define SIM_MAP_BASE            (KVS_FLASH_ADDRESS & ~0xFFFUL)
+#define SIM_MAP_SIZE            (((KVS_FLASH_ADDRESS - SIM_MAP_BASE) + (KVS_PAGE_COUNT * FPEC_PAGE_SIZE) + 0xFFFUL) & ~0xFFFUL)
+#define SIM_STORE_END           (KVS_FLASH_ADDRESS + (KVS_PAGE_COUNT * FPEC_PAGE_SIZE))
+
+static u32 Sim_EraseCount[KVS_PAGE_COUNT];
+static u32 Sim_OpsUntilPowerFail = 0;     /**< 0: no power failure armed */
+static u32 Sim_PowerFails = 0;
+static jmp_buf Sim_PowerFailJump;
+
+static u32 Sim_Random(void)
+{
+    static u32 Local_State = 0x2545F491UL;
+
+    /**< xorshift32 */
+    Local_State ^= Local_State << 13;
+    Local_State ^= Local_State >> 17;
+    Local_State ^= Local_State << 5;
+    return Local_State;
+}
+
+static void Sim_Seed(u32 Copy_Seed)
+{
+    u32 Local_Index;
+
+    for (Local_Index = 0; Local_Index < (Copy_Seed & 0xFFFFUL); Local_Index++)
+    {
+        (void)Sim_Random();
+    }
+}
+
+/**< Count one flash operation; returns 1 when the power fails during it */
+static u8 Sim_PowerFailsNow(void)
+{
+    if ((Sim_OpsUntilPowerFail != 0) && (--Sim_OpsUntilPowerFail == 0))
+    {
+        Sim_PowerFails++;
+        return 1;
+    }
+    return 0;
+}
+
+u8 FPEC_ErasePage(u32 Copy_PageAddress)
+{
+    u32 *Local_pWord;
+    u32 Local_Index;
+
+    if ((Copy_PageAddress < KVS_FLASH_ADDRESS) || (Copy_PageAddress >= SIM_STORE_END))
+    {
+        return FPEC_STATUS_INVALID_ADDRESS;
+    }
+
+    Copy_PageAddress &= ~(FPEC_PAGE_SIZE - 1UL);
+    Local_pWord = (u32 *)(uintptr_t)Copy_PageAddress;
+    Sim_EraseCount[(Copy_PageAddress - KVS_FLASH_ADDRESS) / FPEC_PAGE_SIZE]++;
+
+    if (Sim_PowerFailsNow())
+    {
+        for (Local_Index = 0; Local_Index < (FPEC_PAGE_SIZE / 4U); Local_Index++)
+        {
+            if (Sim_Random() & 1U)
+            {
+                Local_pWord[Local_Index] = 0xFFFFFFFFUL;
+            }
+        }
+        longjmp(Sim_PowerFailJump, 1);
+    }
+
+    memset(Local_pWord, 0xFF, FPEC_PAGE_SIZE);
+
+    return FPEC_STATUS_OK;
+}
+
+u8 FPEC_ProgramHalfWords(u32 Copy_Address, const u16 *Copy_pData, u32 Copy_Count)
+{
+    u16 *Local_pFlash = (u16 *)(uintptr_t)Copy_Address;
+    u32 Local_Index;
+
+    if ((Copy_pData == NULL) || ((Copy_Address & 1UL) != 0) || (Copy_Address < KVS_FLASH_ADDRESS) ||
+        (Copy_Address >= SIM_STORE_END) || (Copy_Count > ((SIM_STORE_END - Copy_Address) / 2UL)))
+    {
+        return FPEC_STATUS_INVALID_ADDRESS;
+    }
+
+    for (Local_Index = 0; Local_Index < Copy_Count; Local_Index++)
+    {
+        if (Local_pFlash[Local_Index] == Copy_pData[Local_Index])
+        {
+            continue;
+        }
+        if ((Local_pFlash[Local_Index] != 0xFFFFU) && (Copy_pData[Local_Index] != 0x0000U))
+        {
+            return FPEC_STATUS_PROGRAM_ERROR;
+        }
+        if (Sim_PowerFailsNow())
+        {
+            /**< Only some of the bits to be cleared made it */
+            Local_pFlash[Local_Index] &= (u16)(Copy_pData[Local_Index] | (u16)Sim_Random());
+            longjmp(Sim_PowerFailJump, 1);
+        }
+        Local_pFlash[Local_Index] = Copy_pData[Local_Index];
+    }
+
+    return FPEC_STATUS_OK;
+}
+
+/*****************************< Test *****************************/
+/**< Keys used by the random writes: their largest values must fit in one page together */
+#define TEST_KEYS               12U
+#define TEST_FAIL_PERIOD        97U     /**< Mean number of writes between two power failures */
+#define TEST_REBOOT_PERIOD      1000U   /**< Mean number of writes between two clean reboots */
+
+typedef struct {
+    u16 Length;                         /**< 0 when the key has no value */
+    u8 Value[KVS_MAX_VALUE_SIZE];
+} Test_Value_t;
+
+static Test_Value_t Test_Model[TEST_KEYS];
+static u32 Test_Errors = 0;
+
+#define TEST_CHECK(COND, ...)                                               \
+    do {                                                                    \
+        if (!(COND)) {                                                      \
+            Test_Errors++;                                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);                     \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+            if (Test_Errors > 20U) {                                        \
+                exit(1);                                                    \
+            }                                                               \
+        }                                                                   \
+    } while (0)
+
+/**< Simulated reset: lose the RAM state, then let KVS_Init rebuild it from the flash */
+static void Test_Reboot(void)
+{
+    KVS_ActivePage = 0;
+    KVS_Sequence = 0;
+    KVS_FreeOffset = FPEC_PAGE_SIZE;
+    memset(KVS_Index, 0, sizeof(KVS_Index));
+    memset(KVS_RecordBuffer, 0, sizeof(KVS_RecordBuffer));
+
+    TEST_CHECK(KVS_Init() == E_OK, "KVS_Init failed after a reset");
+}
+
+static u8 Test_Matches(const Test_Value_t *Copy_pExpected, u16 Copy_Key)
+{
+    u8 Local_Value[KVS_MAX_VALUE_SIZE];
+    u16 Local_Length = 0;
+
+    if (KVS_Read(Copy_Key, Local_Value, sizeof(Local_Value), &Local_Length) != E_OK)
+    {
+        return (Copy_pExpected->Length == 0) ? 1 : 0;
+    }
+
+    return ((Local_Length == Copy_pExpected->Length) && (memcmp(Local_Value, Copy_pExpected->Value, Local_Length) == 0)) ? 1 : 0;
+}
+
+static void Test_CheckAll(u32 Copy_Write)
+{
+    u16 Local_Key;
+
+    for (Local_Key = 0; Local_Key < TEST_KEYS; Local_Key++)
+    {
+        TEST_CHECK(Test_Matches(&Test_Model[Local_Key], Local_Key), "write %u: key %u lost its value", Copy_Write, Local_Key);
+    }
+}
+
+static void Test_Arguments(void)
+{
+    u8 Local_Value[KVS_MAX_VALUE_SIZE + 1] = {0};
+    u16 Local_Length;
+
+    TEST_CHECK(KVS_Write(KVS_MAX_KEYS, Local_Value, 1) == E_NOT_OK, "key out of range accepted");
+    TEST_CHECK(KVS_Write(0, Local_Value, 0) == E_NOT_OK, "empty value accepted");
+    TEST_CHECK(KVS_Write(0, Local_Value, KVS_MAX_VALUE_SIZE + 1) == E_NOT_OK, "oversized value accepted");
+    TEST_CHECK(KVS_Write(0, NULL, 1) == E_NOT_OK, "NULL value accepted");
+    TEST_CHECK(KVS_Read(KVS_MAX_KEYS, Local_Value, sizeof(Local_Value), &Local_Length) == E_NOT_OK, "read of a key out of range");
+    TEST_CHECK(KVS_Delete(KVS_MAX_KEYS) == E_NOT_OK, "delete of a key out of range");
+
+    /**< A buffer too small for the value is refused */
+    TEST_CHECK(KVS_Write(0, Local_Value, 8) == E_OK, "write failed");
+    TEST_CHECK(KVS_Read(0, Local_Value, 7, &Local_Length) == E_NOT_OK, "read into a short buffer");
+    TEST_CHECK(KVS_Delete(0) == E_OK, "delete failed");
+    TEST_CHECK(KVS_Read(0, Local_Value, sizeof(Local_Value), &Local_Length) == E_NOT_OK, "deleted key still readable");
+}
+
+int main(int argc, char *argv[])
+{
+    u32 Local_Writes = (argc > 1) ? (u32)strtoul(argv[1], NULL, 0) : 200000UL;
+    u32 Local_Write;
+    u32 Local_Compactions;
+    static u32 Local_PhaseStart[KVS_PAGE_COUNT];
+    u32 Local_Min;
+    u32 Local_Max;
+    u8 Local_Page;
+    u16 Local_Index;
+    Std_ReturnType Local_Status;
+    void *Local_pMap;
+
+    /* volatile: these are read again after a longjmp out of a simulated power failure */
+    volatile u16 Local_Key = 0;
+    volatile u8 Local_Pending = 0;
+    volatile u32 Local_Retries = 0;
+    static Test_Value_t Local_New;
+
+    if (argc > 2)
+    {
+        Sim_Seed((u32)strtoul(argv[2], NULL, 0));
+    }
+
+    Local_pMap = mmap((void *)(uintptr_t)SIM_MAP_BASE, SIM_MAP_SIZE, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (Local_pMap != (void *)(uintptr_t)SIM_MAP_BASE)
+    {
+        printf("cannot map the simulated flash at 0x%08lX\n", (unsigned long)SIM_MAP_BASE);
+        return 2;
+    }
+
+    /**< Factory state: non-blank garbage, as left by earlier firmware */
+    memset((void *)(uintptr_t)KVS_FLASH_ADDRESS, 0x5A, KVS_PAGE_COUNT * FPEC_PAGE_SIZE);
+    Test_Reboot();
+    Test_Arguments();
+    Test_Reboot();
+    Test_CheckAll(0);
+
+    for (Local_Write = 1; Local_Write <= Local_Writes; Local_Write++)
+    {
+        /**< The last tenth runs without power failures to measure the wear spread */
+        if (Local_Write == ((Local_Writes / 10U) * 9U))
+        {
+            memcpy(Local_PhaseStart, Sim_EraseCount, sizeof(Local_PhaseStart));
+        }
+        if ((Local_Write < ((Local_Writes / 10U) * 9U)) && ((Sim_Random() % TEST_FAIL_PERIOD) == 0))
+        {
+            Sim_OpsUntilPowerFail = 1U + (Sim_Random() % 200U);
+        }
+
+        Local_Key = (u16)(Sim_Random() % TEST_KEYS);
+        if ((Sim_Random() % 10U) == 0)
+        {
+            Local_New.Length = 0;
+        }
+        else
+        {
+            Local_New.Length = (u16)(1U + (Sim_Random() % KVS_MAX_VALUE_SIZE));
+            for (Local_Index = 0; Local_Index < Local_New.Length; Local_Index++)
+            {
+                Local_New.Value[Local_Index] = (u8)Sim_Random();
+            }
+        }
+
+        if (setjmp(Sim_PowerFailJump) != 0)
+        {
+            /**< Power failed inside the flash driver: reset and check that the write was atomic */
+            Sim_OpsUntilPowerFail = 0;
+            Test_Reboot();
+            if (Local_Pending)
+            {
+                if (Test_Matches(&Local_New, Local_Key))
+                {
+                    Test_Model[Local_Key] = Local_New;
+                }
+                else
+                {
+                    TEST_CHECK(Test_Matches(&Test_Model[Local_Key], Local_Key),
+                               "write %u: key %u is neither its old nor its new value after a power failure", Local_Write, Local_Key);
+                }
+            }
+            Local_Pending = 0;
+            Test_CheckAll(Local_Write);
+            continue;
+        }
+
+        Local_Pending = 1;
+        Local_Status = (Local_New.Length != 0) ? KVS_Write(Local_Key, Local_New.Value, Local_New.Length) : KVS_Delete(Local_Key);
+        if (Local_Status != E_OK)
+        {
+            /**< Only a page left with a torn record by a power failure can refuse a write, and then only once */
+            TEST_CHECK(Sim_PowerFails != 0, "write %u: key %u refused without any power failure", Local_Write, Local_Key);
+            TEST_CHECK(Test_Matches(&Test_Model[Local_Key], Local_Key), "write %u: a refused write changed key %u", Local_Write, Local_Key);
+            Local_Retries++;
+            Local_Status = (Local_New.Length != 0) ? KVS_Write(Local_Key, Local_New.Value, Local_New.Length) : KVS_Delete(Local_Key);
+            TEST_CHECK(Local_Status == E_OK, "write %u: retry of key %u failed", Local_Write, Local_Key);
+        }
+        Local_Pending = 0;
+        Sim_OpsUntilPowerFail = 0;
+
+        if (Local_Status == E_OK)
+        {
+            Test_Model[Local_Key] = Local_New;
+        }
+        TEST_CHECK(Test_Matches(&Test_Model[Local_Key], Local_Key), "write %u: key %u does not read back", Local_Write, Local_Key);
+
+        if ((Sim_Random() % TEST_REBOOT_PERIOD) == 0)
+        {
+            Test_Reboot();
+            Test_CheckAll(Local_Write);
+        }
+    }
+
+    Test_Reboot();
+    Test_CheckAll(Local_Writes);
+
+    /**< Wear leveling: compaction moves to the next page in turn, so the erases of the fault-free
+         phase are spread evenly (at most one apart) */
+    Local_Min = 0xFFFFFFFFUL;
+    Local_Max = 0;
+    Local_Compactions = 0;
+    for (Local_Page = 0; Local_Page < KVS_PAGE_COUNT; Local_Page++)
+    {
+        u32 Local_Erases = Sim_EraseCount[Local_Page] - Local_PhaseStart[Local_Page];
+
+        Local_Min = (Local_Erases < Local_Min) ? Local_Erases : Local_Min;
+        Local_Max = (Local_Erases > Local_Max) ? Local_Erases : Local_Max;
+        Local_Compactions += Local_Erases;
+        printf("page %u: %u erases (%u in the fault-free phase)\n", Local_Page, Sim_EraseCount[Local_Page], Local_Erases);
+    }
+    TEST_CHECK(Local_Compactions != 0, "the fault-free phase never compacted");
+    TEST_CHECK((Local_Max - Local_Min) <= 1U, "uneven wear: %u to %u erases per page", Local_Min, Local_Max);
+
+    printf("%u writes, %u power failures, %u retried writes, %u errors\n", Local_Writes, Sim_PowerFails, Local_Retries, Test_Errors);
+
+    return (Test_Errors == 0) ? 0 : 1;
+}